@@ -0,0 +1,37 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// 벤치마크 공용 시간 측정 도구
+
+inline int64_t benchNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 표본 백분위수 (samples는 정렬됨)
+inline double benchPercentile(std::vector<int64_t>& samples, double percentile) {
+    if (samples.empty()) return 0.0;
+    std::sort(samples.begin(), samples.end());
+    size_t index = static_cast<size_t>(percentile / 100.0 * (samples.size() - 1) + 0.5);
+    return static_cast<double>(samples[std::min(index, samples.size() - 1)]);
+}
+
+// 명령행 "--name value" 옵션 (없으면 기본값)
+inline std::string benchOption(int argc, char** argv, const std::string& name, const std::string& fallback) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (name == argv[i]) return argv[i + 1];
+    }
+    return fallback;
+}
+
+// 컴파일러가 측정 대상 계산을 지우지 못하게 함
+template <typename T>
+inline void benchKeep(const T& value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
@@ -0,0 +1,155 @@
+// HTTP/1.1 요청별 핸들 / HTTP/1.1 연결 풀 / HTTP/2 다중화 처리량 비교
+//
+//   python3 standin/h2_standin.py --delay-ms 2 &
+//   ./bench_http2 --url https://127.0.0.1:18443/api/v3/ticker/price --ca standin/localhost.crt --requests 2048
+//
+// HTTP/2는 TLS + ALPN으로 협상한다 (libcurl 7.88.x는 평문 prior knowledge 연결에서 두 번째 스트림부터 실패).
+// 동시 요청 수(1, 8, 64)마다 그 수만큼의 요청을 한꺼번에 보내고 모두 끝나면 다음 묶음을 보낸다.
+// 각 방식은 한 묶음으로 예열한 뒤 측정하며, connects는 측정 구간에서 새로 맺은 연결 수다
+
+#include "async_http_client.h"
+#include "connection_pool.h"
+#include "bench_common.h"
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+struct ModeResult {
+    long requests = 0;
+    long failures = 0;
+    long connects = 0;
+    int64_t elapsedNs = 0;
+    std::vector<int64_t> batchNs;
+};
+
+static bool succeeded(const HttpResponse& response) {
+    return response.curlCode == CURLE_OK && response.statusCode == 200;
+}
+
+// 요청마다 새 핸들과 새 연결 (연결 풀 도입 전 방식)
+static void freshBatch(ConnectionPool& pool, CURLM* multi, const HttpRequest& request, int concurrency, ModeResult& result) {
+    std::vector<HttpResponse> responses(concurrency);
+    std::vector<CURL*> handles(concurrency);
+    for (int i = 0; i < concurrency; i++) {
+        handles[i] = curl_easy_init();
+        pool.configure(handles[i], request, &responses[i], true);
+        curl_easy_setopt(handles[i], CURLOPT_SHARE, nullptr);
+        curl_easy_setopt(handles[i], CURLOPT_FRESH_CONNECT, 1L);
+        curl_easy_setopt(handles[i], CURLOPT_FORBID_REUSE, 1L);
+        curl_easy_setopt(handles[i], CURLOPT_PRIVATE, &responses[i]);
+        curl_multi_add_handle(multi, handles[i]);
+    }
+
+    int running = 0;
+    do {
+        curl_multi_perform(multi, &running);
+        if (running) {
+            curl_multi_poll(multi, nullptr, 0, 100, nullptr);
+        }
+    } while (running);
+
+    int remaining = 0;
+    while (CURLMsg* message = curl_multi_info_read(multi, &remaining)) {
+        if (message->msg != CURLMSG_DONE) continue;
+        HttpResponse* response = nullptr;
+        curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &response);
+        response->curlCode = message->data.result;
+    }
+
+    for (int i = 0; i < concurrency; i++) {
+        pool.recordResult(handles[i], responses[i]);
+        curl_multi_remove_handle(multi, handles[i]);
+        curl_easy_cleanup(handles[i]);
+        result.requests++;
+        if (!succeeded(responses[i])) result.failures++;
+    }
+}
+
+static void clientBatch(AsyncHttpClient& client, const HttpRequest& request, int concurrency, ModeResult& result) {
+    std::vector<std::future<HttpResponse>> pending;
+    pending.reserve(concurrency);
+    for (int i = 0; i < concurrency; i++) {
+        pending.push_back(client.submit(request));
+    }
+    for (auto& future : pending) {
+        HttpResponse response = future.get();
+        result.requests++;
+        if (!succeeded(response)) result.failures++;
+    }
+}
+
+static ModeResult runMode(const std::string& mode, const std::string& url, const std::string& ca_file,
+                          int concurrency, int batches) {
+    auto pool = std::make_shared<ConnectionPool>();
+    pool->setCaFile(ca_file);
+    HttpRequest request;
+    request.url = url;
+    request.timeout = 10;
+    request.http2 = (mode == "http2");
+
+    std::unique_ptr<AsyncHttpClient> client;
+    CURLM* multi = nullptr;
+    if (mode == "http1-fresh") {
+        multi = curl_multi_init();
+    } else {
+        client = std::make_unique<AsyncHttpClient>(pool);
+    }
+
+    auto batch = [&](ModeResult& result) {
+        if (multi) {
+            freshBatch(*pool, multi, request, concurrency, result);
+        } else {
+            clientBatch(*client, request, concurrency, result);
+        }
+    };
+
+    ModeResult warmup;
+    batch(warmup);
+
+    ModeResult result;
+    long handshakes_before = pool->getStats().handshakes;
+    int64_t start = benchNanos();
+    for (int i = 0; i < batches; i++) {
+        int64_t batch_start = benchNanos();
+        batch(result);
+        result.batchNs.push_back(benchNanos() - batch_start);
+    }
+    result.elapsedNs = benchNanos() - start;
+    result.connects = pool->getStats().handshakes - handshakes_before;
+
+    if (multi) {
+        curl_multi_cleanup(multi);
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    std::string url = benchOption(argc, argv, "--url", "https://127.0.0.1:18443/api/v3/ticker/price");
+    std::string ca_file = benchOption(argc, argv, "--ca", "standin/localhost.crt");
+    int total = std::stoi(benchOption(argc, argv, "--requests", "2048"));
+
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+    std::cout << "target: " << url << " (CA " << ca_file << ")" << std::endl;
+    std::cout << std::left << std::setw(14) << "mode" << std::right << std::setw(6) << "conc"
+              << std::setw(10) << "requests" << std::setw(7) << "fail" << std::setw(11) << "req/s"
+              << std::setw(13) << "p50 batch" << std::setw(13) << "p99 batch" << std::setw(10) << "connects" << std::endl;
+
+    const char* modes[] = {"http1-fresh", "http1-pooled", "http2"};
+    for (int concurrency : {1, 8, 64}) {
+        int batches = std::max(8, total / concurrency);
+        for (const char* mode : modes) {
+            ModeResult result = runMode(mode, url, ca_file, concurrency, batches);
+            double seconds = result.elapsedNs / 1e9;
+            std::cout << std::left << std::setw(14) << mode << std::right << std::setw(6) << concurrency
+                      << std::setw(10) << result.requests << std::setw(7) << result.failures
+                      << std::setw(11) << std::fixed << std::setprecision(0) << result.requests / seconds
+                      << std::setw(10) << std::setprecision(2) << benchPercentile(result.batchNs, 50) / 1e6 << " ms"
+                      << std::setw(10) << benchPercentile(result.batchNs, 99) / 1e6 << " ms"
+                      << std::setw(10) << result.connects << std::endl;
+        }
+    }
+
+    curl_global_cleanup();
+    return 0;
+}
@@ -0,0 +1,182 @@
+// JSON 구조 문자 색인 / JSONDocument 파싱 / JSONArrayStream 처리량 (GB/s), 구현별 비교
+//
+//   ./bench_json_scan --data data --seconds 0.5
+//
+// 입력은 data/ 의 exchangeInfo 응답(현물, 선물)이다 (data/gen_exchange_info.py로 생성한 고정 시드 데이터).
+// 측정 전에 이 CPU에서 쓸 수 있는 모든 구현(avx2 / sse4.2 / sse2 / scalar)의 색인이 스칼라 구현과 같은지,
+// 파싱 결과 심볼 수가 같은지 확인하고, 다르면 실패로 종료한다.
+// 작은 메시지(bookTicker 이벤트 한 건) 파싱 ns/메시지도 함께 출력한다
+
+#include "json_parser.h"
+#include "json_scanner.h"
+#include "bench_common.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+struct Payload {
+    std::string name;
+    std::string json;
+};
+
+static bool loadPayload(const std::string& path, const std::string& name, std::vector<Payload>& payloads) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "cannot open " << path << " (run from bench/ or pass --data)" << std::endl;
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    payloads.push_back({name, buffer.str()});
+    return true;
+}
+
+// 색인 결과가 스칼라 구현과 같은지, 모든 구현에서 같은 수의 심볼을 읽는지 확인
+static bool verify(const std::vector<Payload>& payloads, const std::vector<const char*>& implementations) {
+    for (const Payload& payload : payloads) {
+        JSONScanner::useImplementation("scalar");
+        JSONScanner::StructuralIndex expected;
+        JSONScanner::buildStructuralIndex(payload.json.data(), payload.json.size(), expected);
+        size_t expected_symbols = JSONDocument(payload.json).root()["symbols"].size();
+        if (expected_symbols == 0) {
+            std::cerr << payload.name << ": no symbols parsed" << std::endl;
+            return false;
+        }
+
+        for (const char* implementation : implementations) {
+            JSONScanner::useImplementation(implementation);
+            JSONScanner::StructuralIndex index;
+            JSONScanner::buildStructuralIndex(payload.json.data(), payload.json.size(), index);
+            if (index.count != expected.count || index.stringError != expected.stringError ||
+                !std::equal(expected.positions.begin(), expected.positions.begin() + expected.count,
+                            index.positions.begin())) {
+                std::cerr << payload.name << ": " << implementation << " index differs from scalar" << std::endl;
+                return false;
+            }
+            JSONDocument doc(payload.json);
+            if (!doc.ok() || doc.root()["symbols"].size() != expected_symbols) {
+                std::cerr << payload.name << ": " << implementation << " parse differs (error at "
+                          << doc.errorOffset() << ")" << std::endl;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// seconds 동안 반복한 호출당 시간 (세 번 측정해 가장 빠른 값)
+template <typename Fn>
+static double nanosPerCall(double seconds, Fn&& fn) {
+    fn();
+    long iterations = 1;
+    int64_t start = benchNanos();
+    fn();
+    int64_t once = std::max<int64_t>(benchNanos() - start, 1);
+    iterations = std::max<long>(1, static_cast<long>(seconds * 1e9 / 3 / once));
+
+    double best = 0.0;
+    for (int round = 0; round < 3; round++) {
+        start = benchNanos();
+        for (long i = 0; i < iterations; i++) {
+            fn();
+        }
+        double per_call = static_cast<double>(benchNanos() - start) / iterations;
+        if (round == 0 || per_call < best) best = per_call;
+    }
+    return best;
+}
+
+static void printRow(const std::string& payload, const char* implementation, const char* stage, size_t bytes, double nanos) {
+    std::cout << std::left << std::setw(10) << payload << std::setw(9) << implementation << std::setw(24) << stage
+              << std::right << std::fixed << std::setprecision(1) << std::setw(12) << nanos / 1e3 << " us"
+              << std::setprecision(2) << std::setw(9) << bytes / nanos << " GB/s" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    std::string data_dir = benchOption(argc, argv, "--data", "data");
+    double seconds = std::stod(benchOption(argc, argv, "--seconds", "0.5"));
+    size_t chunk = std::stoul(benchOption(argc, argv, "--chunk", "16384"));
+
+    std::vector<Payload> payloads;
+    if (!loadPayload(data_dir + "/exchange_info_spot.json", "spot", payloads) ||
+        !loadPayload(data_dir + "/exchange_info_futures.json", "futures", payloads)) {
+        return 1;
+    }
+
+    std::vector<const char*> implementations = JSONScanner::availableImplementations();
+    if (!verify(payloads, implementations)) {
+        return 1;
+    }
+    std::cout << "verified: structural index of";
+    for (const char* implementation : implementations) std::cout << " " << implementation;
+    std::cout << " matches scalar on all payloads" << std::endl;
+    for (const Payload& payload : payloads) {
+        std::cout << payload.name << ": " << payload.json.size() << " bytes" << std::endl;
+    }
+    std::cout << std::endl;
+
+    std::cout << std::left << std::setw(10) << "payload" << std::setw(9) << "impl" << std::setw(24) << "stage"
+              << std::right << std::setw(15) << "per pass" << std::setw(14) << "throughput" << std::endl;
+    for (const Payload& payload : payloads) {
+        const char* data = payload.json.data();
+        const size_t n = payload.json.size();
+        for (const char* implementation : implementations) {
+            JSONScanner::useImplementation(implementation);
+
+            // 1단계만: 구조 문자 색인 (문서 전체를 한 번에)
+            JSONScanner::StructuralIndex index;
+            double index_nanos = nanosPerCall(seconds, [&]() {
+                index.reset();
+                JSONScanner::buildStructuralIndex(data, n, index);
+                benchKeep(index.count);
+            });
+            printRow(payload.name, implementation, "structural index", n, index_nanos);
+
+            // 전체 문서 파싱 (색인 + 토큰화, 버퍼 재사용)
+            JSONDocument doc;
+            double parse_nanos = nanosPerCall(seconds, [&]() {
+                bool ok = doc.parse(payload.json);
+                benchKeep(ok);
+            });
+            printRow(payload.name, implementation, "JSONDocument::parse", n, parse_nanos);
+
+            // 심볼 정보 로드 경로: 청크 단위 입력 + 요소별 파싱과 필드 읽기
+            double stream_nanos = nanosPerCall(seconds, [&]() {
+                size_t filters = 0;
+                JSONArrayStream stream("symbols", [&](JSONValue symbol) {
+                    benchKeep(symbol["symbol"].raw());
+                    for (JSONValue filter : symbol["filters"]) {
+                        filters += filter["filterType"].raw().size();
+                    }
+                    return true;
+                });
+                for (size_t offset = 0; offset < n; offset += chunk) {
+                    stream.feed(data + offset, std::min(chunk, n - offset));
+                }
+                benchKeep(filters);
+            });
+            printRow(payload.name, implementation, "JSONArrayStream symbols", n, stream_nanos);
+        }
+        std::cout << std::endl;
+    }
+
+    // 작은 메시지: 시세 스트림 이벤트 한 건 (문서가 작아도 색인 단계가 손해가 아닌지)
+    const std::string event =
+        "{\"stream\":\"btcusdt@bookTicker\",\"data\":{\"e\":\"bookTicker\",\"u\":400900217,\"E\":1568014460893,"
+        "\"T\":1568014460891,\"s\":\"BTCUSDT\",\"b\":\"25.35190000\",\"B\":\"31.21000000\",\"a\":\"25.36520000\","
+        "\"A\":\"40.66000000\"}}";
+    std::cout << "bookTicker event (" << event.size() << " bytes)" << std::endl;
+    for (const char* implementation : implementations) {
+        JSONScanner::useImplementation(implementation);
+        JSONDocument doc;
+        double nanos = nanosPerCall(seconds, [&]() {
+            bool ok = doc.parse(event);
+            benchKeep(ok);
+        });
+        std::cout << std::left << std::setw(10) << "" << std::setw(9) << implementation << std::setw(24) << "JSONDocument::parse"
+                  << std::right << std::fixed << std::setprecision(1) << std::setw(12) << nanos << " ns" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,114 @@
+// WebSocket 시세 스트림 수신 처리량 / 최신 시세 테이블 읽기 / REST vs 스트림 getCurrentPrice 비교
+//
+//   python3 standin/ws_standin.py --port 18090 --rate 0 &
+//   python3 standin/ws_standin.py --port 18091 --rate 1000 &
+//   python3 standin/h2_standin.py --delay-ms 2 &
+//   ./bench_market_stream --flood ws://127.0.0.1:18090 --stream ws://127.0.0.1:18091 --rest http://127.0.0.1:18080
+//
+// 수신 처리량은 대역 서버가 제한 없이 보낼 때(--flood) MarketDataStream이 해석해 테이블에 반영한 메시지 수다.
+// getCurrentPrice는 같은 BinanceAPI로 스트림 시작 전(REST 왕복)과 후(테이블 조회)를 각각 측정하며,
+// 이때는 실제 거래소처럼 속도가 제한된 스트림(--stream)을 쓴다 (CPU가 적으면 무제한 수신이 호출 스레드를 밀어냄)
+
+#include "binance_api.h"
+#include "market_data_stream.h"
+#include "bench_common.h"
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+static bool waitLive(const MarketDataStream& stream, int timeout_ms) {
+    int64_t deadline = benchNanos() + static_cast<int64_t>(timeout_ms) * 1000000;
+    while (benchNanos() < deadline) {
+        if (stream.isLive() && stream.messageCount() > 0) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+static void printLatency(const char* label, long calls, long failures, std::vector<int64_t>& samples) {
+    std::cout << std::left << std::setw(28) << label << std::right << std::setw(9) << calls
+              << std::setw(7) << failures << std::fixed << std::setprecision(2)
+              << std::setw(12) << benchPercentile(samples, 50) / 1e3 << " us"
+              << std::setw(12) << benchPercentile(samples, 99) / 1e3 << " us" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    std::string flood_url = benchOption(argc, argv, "--flood", "ws://127.0.0.1:18090");
+    std::string stream_url = benchOption(argc, argv, "--stream", "ws://127.0.0.1:18091");
+    std::string rest_url = benchOption(argc, argv, "--rest", "http://127.0.0.1:18080");
+    double seconds = std::stod(benchOption(argc, argv, "--seconds", "3"));
+    int calls = std::stoi(benchOption(argc, argv, "--calls", "2000"));
+    std::vector<std::string> symbols = {"BTCUSDT", "ETHUSDT", "BNBUSDT", "SOLUSDT", "XRPUSDT",
+                                        "ADAUSDT", "DOGEUSDT", "AVAXUSDT", "LINKUSDT", "LTCUSDT"};
+
+    // 1. 수신 처리량 (선물: bookTicker + aggTrade + markPrice)
+    std::cout << "stream: " << flood_url << ", " << symbols.size() << " symbols" << std::endl;
+    {
+        MarketDataStream stream(MarketType::Futures, flood_url, symbols);
+        stream.start();
+        if (!waitLive(stream, 5000)) {
+            std::cerr << "stream not live: " << stream.lastError() << std::endl;
+            return 1;
+        }
+
+        long start_messages = stream.messageCount();
+        int64_t start = benchNanos();
+        // 수신 중에 읽기 지연도 함께 측정 (기록 스레드와 경합하는 시퀀스 락 읽기)
+        std::vector<int64_t> reads;
+        long invalid = 0;
+        while (benchNanos() - start < static_cast<int64_t>(seconds * 1e9)) {
+            for (int i = 0; i < 1000; i++) {
+                const std::string& symbol = symbols[i % symbols.size()];
+                int64_t begin = benchNanos();
+                PriceSnapshot snapshot = stream.getPrice(symbol);
+                reads.push_back(benchNanos() - begin);
+                if (!snapshot.valid) invalid++;
+                benchKeep(snapshot);
+            }
+            std::this_thread::yield();
+        }
+        double elapsed = (benchNanos() - start) / 1e9;
+        long messages = stream.messageCount() - start_messages;
+        stream.stop();
+
+        std::cout << "ingest: " << messages << " messages in " << std::fixed << std::setprecision(2) << elapsed
+                  << " s = " << std::setprecision(0) << messages / elapsed << " msg/s"
+                  << " (reconnects " << stream.reconnectCount() << ")" << std::endl;
+        std::cout << "table read while ingesting: " << reads.size() << " reads, p50 "
+                  << benchPercentile(reads, 50) << " ns, p99 " << benchPercentile(reads, 99)
+                  << " ns, invalid " << invalid << std::endl;
+    }
+
+    // 2. getCurrentPrice: REST 왕복 vs 스트림 테이블
+    BinanceAPI binance("bench-api-key", "bench-secret-key");
+    binance.setRestEndpoints(rest_url, rest_url);
+    binance.setStreamEndpoints(stream_url, stream_url);
+
+    std::cout << std::endl << "getCurrentPrice (REST " << rest_url << ", stream " << stream_url << ")" << std::endl;
+    std::cout << std::left << std::setw(28) << "source" << std::right << std::setw(9) << "calls"
+              << std::setw(7) << "fail" << std::setw(15) << "p50" << std::setw(15) << "p99" << std::endl;
+
+    auto measure = [&](const char* label, int count) {
+        std::vector<int64_t> samples;
+        long failures = 0;
+        for (int i = 0; i < count; i++) {
+            int64_t begin = benchNanos();
+            MarketPrice price = binance.getCurrentPrice(symbols[i % symbols.size()]);
+            samples.push_back(benchNanos() - begin);
+            if (!price.success) failures++;
+        }
+        printLatency(label, count, failures, samples);
+    };
+
+    binance.getCurrentPrice("BTCUSDT");    // 연결 예열
+    measure("rest", std::max(1, calls / 10));
+
+    binance.startMarketDataStream(symbols);
+    int64_t deadline = benchNanos() + 5000000000LL;
+    while (!binance.getStreamPrice("LTCUSDT").valid && benchNanos() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    measure("stream", calls);
+    binance.stopMarketDataStream();
+    return 0;
+}
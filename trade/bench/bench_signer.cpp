@@ -0,0 +1,161 @@
+// 요청 서명 ns/서명: 일회성 HMAC() + stringstream hex vs RequestSigner (미리 계산한 ipad/opad 상태)
+//
+//   ./bench_signer --iterations 200000
+//
+// 측정 전에 여러 길이의 메시지로 RequestSigner 결과가 일회성 HMAC()과 같은지 확인하고, 다르면 실패로 종료한다.
+// 쿼리 생성까지 포함한 비교는 std::map 이어 붙이기 + 일회성 서명과 QueryBuilder + appendSignature다
+
+#include "request_signer.h"
+#include "bench_common.h"
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+static const std::string SECRET = "NhqPtmdSJYdKjVHjA7PZj4Mge3R5YNiP1e3UZjInClVN65XAbvqqM6A7H5fATj0j";
+
+// 기존 BinanceAPI::createSignature 방식
+static std::string oneShotSignature(const std::string& data) {
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digest_length = 0;
+    HMAC(EVP_sha256(), SECRET.data(), static_cast<int>(SECRET.length()),
+         reinterpret_cast<const unsigned char*>(data.data()), data.length(), digest, &digest_length);
+
+    std::stringstream ss;
+    for (unsigned int i = 0; i < digest_length; i++) {
+        ss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(digest[i]);
+    }
+    return ss.str();
+}
+
+static std::map<std::string, std::string> orderParams(long long timestamp) {
+    std::map<std::string, std::string> params;
+    params["symbol"] = "BTCUSDT";
+    params["side"] = "BUY";
+    params["type"] = "LIMIT";
+    params["timeInForce"] = "GTC";
+    params["quantity"] = "0.00100000";
+    params["price"] = "67000.10";
+    params["recvWindow"] = "5000";
+    params["timestamp"] = std::to_string(timestamp);
+    return params;
+}
+
+static bool verify(const RequestSigner& signer) {
+    std::string message;
+    for (size_t length = 0; length <= 1024; length += (length < 160 ? 1 : 37)) {
+        message.assign(length, '\0');
+        for (size_t i = 0; i < length; i++) {
+            message[i] = static_cast<char>('!' + (i * 31 + length) % 90);
+        }
+        char out[RequestSigner::SIGNATURE_LENGTH];
+        signer.sign(message.data(), message.length(), out);
+        std::string expected = oneShotSignature(message);
+        if (std::string(out, sizeof(out)) != expected || signer.sign(message) != expected) {
+            std::cerr << "signature mismatch at length " << length << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Fn>
+static double nanosPerCall(long iterations, Fn&& fn) {
+    // 세 번 측정해 가장 빠른 값 (다른 프로세스의 간섭 제외)
+    double best = 0.0;
+    for (int round = 0; round < 3; round++) {
+        int64_t start = benchNanos();
+        for (long i = 0; i < iterations; i++) {
+            fn(i);
+        }
+        double per_call = static_cast<double>(benchNanos() - start) / iterations;
+        if (round == 0 || per_call < best) best = per_call;
+    }
+    return best;
+}
+
+static void printRow(const char* label, double nanos, double baseline) {
+    std::cout << std::left << std::setw(40) << label << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << nanos << " ns" << std::setw(9) << std::setprecision(2) << baseline / nanos << "x" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    long iterations = std::stol(benchOption(argc, argv, "--iterations", "200000"));
+    RequestSigner signer(SECRET);
+
+    if (!verify(signer)) {
+        return 1;
+    }
+    std::cout << "verified: RequestSigner output matches one-shot HMAC() for lengths 0..1024" << std::endl;
+
+    const long long timestamp = 1700000000000LL;
+    std::map<std::string, std::string> params = orderParams(timestamp);
+    std::string query;
+    for (const auto& param : params) {
+        if (!query.empty()) query += "&";
+        query += param.first + "=" + param.second;
+    }
+    QueryBuilder check;
+    for (const auto& param : params) {
+        check.append(param.first, param.second);
+    }
+    check.appendSignature(signer);
+    if (check.str() != query + "&signature=" + oneShotSignature(query)) {
+        std::cerr << "QueryBuilder output mismatch: " << check.str() << std::endl;
+        return 1;
+    }
+
+    std::cout << "query: " << query.length() << " bytes, " << iterations << " iterations" << std::endl << std::endl;
+
+    // 서명만
+    double one_shot = nanosPerCall(iterations, [&](long) {
+        std::string signature = oneShotSignature(query);
+        benchKeep(signature);
+    });
+    double signer_string = nanosPerCall(iterations, [&](long) {
+        std::string signature = signer.sign(query);
+        benchKeep(signature);
+    });
+    double signer_buffer = nanosPerCall(iterations, [&](long) {
+        char out[RequestSigner::SIGNATURE_LENGTH];
+        signer.sign(query.data(), query.length(), out);
+        benchKeep(out);
+    });
+
+    // 쿼리 생성 + 서명 (요청마다 timestamp가 바뀌는 실제 경로)
+    double map_one_shot = nanosPerCall(iterations, [&](long i) {
+        std::map<std::string, std::string> request = orderParams(timestamp + i);
+        std::string built;
+        for (const auto& param : request) {
+            if (!built.empty()) built += "&";
+            built += param.first + "=" + param.second;
+        }
+        built += "&signature=" + oneShotSignature(built);
+        benchKeep(built);
+    });
+    double builder_signer = nanosPerCall(iterations, [&](long i) {
+        QueryBuilder builder;
+        builder.append("price", "67000.10");
+        builder.append("quantity", "0.00100000");
+        builder.append("recvWindow", 5000);
+        builder.append("side", "BUY");
+        builder.append("symbol", "BTCUSDT");
+        builder.append("timeInForce", "GTC");
+        builder.append("timestamp", timestamp + i);
+        builder.append("type", "LIMIT");
+        builder.appendSignature(signer);
+        benchKeep(builder.str());
+    });
+
+    std::cout << std::left << std::setw(40) << "method" << std::right << std::setw(13) << "per call"
+              << std::setw(10) << "speedup" << std::endl;
+    printRow("HMAC() + stringstream hex", one_shot, one_shot);
+    printRow("RequestSigner -> std::string", signer_string, one_shot);
+    printRow("RequestSigner -> stack buffer", signer_buffer, one_shot);
+    std::cout << std::endl;
+    printRow("std::map query + HMAC()", map_one_shot, map_one_shot);
+    printRow("QueryBuilder + appendSignature", builder_signer, map_one_shot);
+    return 0;
+}
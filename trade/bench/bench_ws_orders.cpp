@@ -0,0 +1,113 @@
+// 주문 왕복 지연: REST(요청마다 HTTP 요청) vs WebSocket API 주문 세션(인증된 연결 하나)
+//
+//   python3 standin/h2_standin.py --delay-ms 0.5 &
+//   python3 standin/ws_standin.py --delay-ms 0.5 &
+//   ./bench_ws_orders --rest http://127.0.0.1:18080 --ws ws://127.0.0.1:18090 --orders 80
+//
+// 두 방식 모두 BinanceAPI 공개 함수(placeSpotOrder, getSpotOrderStatus, cancelSpotOrder, placeFuturesOrder)를 그대로
+// 호출하므로 필터 검증, 서명, 가중치 예산, 응답 해석까지 포함한 호출자 기준 지연이다.
+// 방식마다 BinanceAPI 인스턴스가 따로라 주문 예산(현물 10초 100건)도 따로이며,
+// 예산 대기가 섞이지 않도록 기본 주문 수는 그 안에 들어가게 잡았다
+
+#include "binance_api.h"
+#include "bench_common.h"
+#include <iomanip>
+#include <iostream>
+
+struct OpSamples {
+    const char* name;
+    std::vector<int64_t> nanos = {};
+    long failures = 0;
+    std::string lastError = {};
+};
+
+template <typename Response, typename Fn>
+static Response timed(OpSamples& samples, Fn&& fn) {
+    int64_t begin = benchNanos();
+    Response response = fn();
+    samples.nanos.push_back(benchNanos() - begin);
+    if (!response.success) {
+        samples.failures++;
+        samples.lastError = response.error;
+    }
+    return response;
+}
+
+static void runOrders(BinanceAPI& api, int orders, std::vector<OpSamples>& ops) {
+    ops = {{"spot place"}, {"spot status"}, {"spot cancel"}, {"futures place"}};
+    for (int i = 0; i < orders; i++) {
+        // 체결되지 않을 가격의 지정가 주문 (대역 서버는 가격과 무관하게 응답)
+        OrderResponse placed = timed<OrderResponse>(ops[0], [&]() {
+            return api.placeSpotOrder("BTCUSDT", "BUY", "LIMIT", Decimal::fromDouble(0.001), Decimal::fromDouble(30000.0));
+        });
+        std::string order_id = placed.orderId.empty() ? "1" : placed.orderId;
+        timed<OrderResponse>(ops[1], [&]() { return api.getSpotOrderStatus("BTCUSDT", order_id); });
+        timed<OrderResponse>(ops[2], [&]() { return api.cancelSpotOrder("BTCUSDT", order_id); });
+
+        FuturesOrderRequest request;
+        request.symbol = "BTCUSDT";
+        request.side = "BUY";
+        request.type = "LIMIT";
+        request.quantity = Decimal::fromDouble(0.001);
+        request.price = Decimal::fromDouble(30000.0);
+        timed<FuturesOrderResponse>(ops[3], [&]() { return api.placeFuturesOrder(request); });
+    }
+}
+
+static void printOps(const char* transport, std::vector<OpSamples>& ops) {
+    for (auto& op : ops) {
+        std::cout << std::left << std::setw(6) << transport << std::setw(15) << op.name << std::right
+                  << std::setw(7) << op.nanos.size() << std::setw(6) << op.failures << std::fixed << std::setprecision(1);
+        for (double pct : {50.0, 90.0, 99.0, 100.0}) {
+            std::cout << std::setw(10) << benchPercentile(op.nanos, pct) / 1e3;
+        }
+        std::cout << std::endl;
+        if (op.failures > 0) {
+            std::cout << "      last error: " << op.lastError << std::endl;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    std::string rest_url = benchOption(argc, argv, "--rest", "http://127.0.0.1:18080");
+    std::string ws_url = benchOption(argc, argv, "--ws", "ws://127.0.0.1:18090");
+    int orders = std::stoi(benchOption(argc, argv, "--orders", "80"));
+    const int warmup = 5;
+
+    BinanceAPI rest("bench-api-key", "bench-secret-key");
+    rest.setRestEndpoints(rest_url, rest_url);
+
+    // exchangeInfo는 REST 대역 서버에서, 주문만 WebSocket 세션으로
+    BinanceAPI session("bench-api-key", "bench-secret-key");
+    session.setRestEndpoints(rest_url, rest_url);
+    session.setOrderSessionEndpoints(ws_url + "/ws-api/v3", ws_url + "/ws-fapi/v1");
+    session.setOrderSessionEnabled(true);
+
+    std::cout << "REST " << rest_url << ", WebSocket API " << ws_url << ", " << orders << " orders per market" << std::endl;
+
+    std::vector<OpSamples> rest_ops;
+    std::vector<OpSamples> session_ops;
+    for (BinanceAPI* api : {&rest, &session}) {
+        // 심볼 캐시 로드와 연결(TCP/TLS, WebSocket 핸드셰이크) 예열
+        SymbolInfo info;
+        if (!api->getSymbolInfo(MarketType::Spot, "BTCUSDT", info) || !api->getSymbolInfo(MarketType::Futures, "BTCUSDT", info)) {
+            std::cerr << "exchangeInfo load failed (is standin/h2_standin.py running?)" << std::endl;
+            return 1;
+        }
+        std::vector<OpSamples> ignored;
+        runOrders(*api, warmup, ignored);
+    }
+    runOrders(rest, orders, rest_ops);
+    runOrders(session, orders, session_ops);
+
+    std::cout << std::left << std::setw(6) << "path" << std::setw(15) << "operation" << std::right
+              << std::setw(7) << "calls" << std::setw(6) << "fail" << std::setw(10) << "p50 us"
+              << std::setw(10) << "p90 us" << std::setw(10) << "p99 us" << std::setw(10) << "max us" << std::endl;
+    printOps("rest", rest_ops);
+    printOps("ws", session_ops);
+
+    std::cout << std::endl << "order session average round trip: spot "
+              << std::setprecision(3) << session.getOrderSessionLatencyMs(MarketType::Spot) << " ms, futures "
+              << session.getOrderSessionLatencyMs(MarketType::Futures) << " ms" << std::endl;
+    return 0;
+}
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""벤치마크용 exchangeInfo 응답 생성기 (현물 /api/v3/exchangeInfo, 선물 /fapi/v1/exchangeInfo)
+
+실제 응답과 같은 필드 구성, 필터 종류, 숫자 문자열 형식, 공백 없는 직렬화로 만들며
+심볼 수도 실제 규모(현물 약 2,000개, 선물 약 500개)에 맞춘다.
+같은 seed면 항상 같은 파일이 나오므로 측정 결과를 서로 비교할 수 있다.
+
+    python3 gen_exchange_info.py            # exchange_info_spot.json, exchange_info_futures.json 갱신
+"""
+
+import argparse
+import json
+import os
+import random
+
+QUOTES_SPOT = ["USDT", "BTC", "FDUSD", "ETH", "BNB", "TRY", "EUR", "BRL", "USDC", "JPY"]
+PERMISSIONS = ["SPOT", "MARGIN", "TRD_GRP_004", "TRD_GRP_005", "TRD_GRP_006", "TRD_GRP_009", "TRD_GRP_010",
+               "TRD_GRP_011", "TRD_GRP_012", "TRD_GRP_013", "TRD_GRP_014", "TRD_GRP_015", "TRD_GRP_016",
+               "TRD_GRP_017", "TRD_GRP_018", "TRD_GRP_019", "TRD_GRP_020", "TRD_GRP_021", "TRD_GRP_022",
+               "TRD_GRP_023", "TRD_GRP_024", "TRD_GRP_025"]
+
+
+def decimal(value, places=8):
+    return "%.*f" % (places, value)
+
+
+def asset_name(rng, index):
+    letters = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    length = rng.choice([3, 3, 4, 4, 4, 5, 6])
+    name = "".join(rng.choice(letters) for _ in range(length))
+    return name if index % 7 else name + "1000"[: rng.choice([0, 4])]
+
+
+def spot_symbol(rng, base, quote):
+    price_exp = rng.randint(-8, 3)
+    tick = 10.0 ** price_exp
+    step = 10.0 ** rng.randint(-8, 0)
+    return {
+        "symbol": base + quote,
+        "status": rng.choice(["TRADING"] * 9 + ["BREAK"]),
+        "baseAsset": base,
+        "baseAssetPrecision": 8,
+        "quoteAsset": quote,
+        "quotePrecision": 8,
+        "quoteAssetPrecision": 8,
+        "baseCommissionPrecision": 8,
+        "quoteCommissionPrecision": 8,
+        "orderTypes": ["LIMIT", "LIMIT_MAKER", "MARKET", "STOP_LOSS", "STOP_LOSS_LIMIT", "TAKE_PROFIT",
+                       "TAKE_PROFIT_LIMIT"],
+        "icebergAllowed": True,
+        "ocoAllowed": True,
+        "otoAllowed": rng.random() < 0.5,
+        "quoteOrderQtyMarketAllowed": True,
+        "allowTrailingStop": True,
+        "cancelReplaceAllowed": True,
+        "isSpotTradingAllowed": True,
+        "isMarginTradingAllowed": rng.random() < 0.4,
+        "filters": [
+            {"filterType": "PRICE_FILTER", "minPrice": decimal(tick), "maxPrice": decimal(rng.choice([1000, 100000, 1000000])),
+             "tickSize": decimal(tick)},
+            {"filterType": "LOT_SIZE", "minQty": decimal(step), "maxQty": decimal(rng.choice([9000, 92141578, 900000000])),
+             "stepSize": decimal(step)},
+            {"filterType": "ICEBERG_PARTS", "limit": 10},
+            {"filterType": "MARKET_LOT_SIZE", "minQty": "0.00000000", "maxQty": decimal(rng.uniform(10, 1e6)),
+             "stepSize": "0.00000000"},
+            {"filterType": "TRAILING_DELTA", "minTrailingAboveDelta": 10, "maxTrailingAboveDelta": 2000,
+             "minTrailingBelowDelta": 10, "maxTrailingBelowDelta": 2000},
+            {"filterType": "PERCENT_PRICE_BY_SIDE", "bidMultiplierUp": "5", "bidMultiplierDown": "0.2",
+             "askMultiplierUp": "5", "askMultiplierDown": "0.2", "avgPriceMins": 5},
+            {"filterType": "NOTIONAL", "minNotional": decimal(rng.choice([1, 5, 10])), "applyMinToMarket": True,
+             "maxNotional": "9000000.00000000", "applyMaxToMarket": False, "avgPriceMins": 5},
+            {"filterType": "MAX_NUM_ORDERS", "maxNumOrders": 200},
+            {"filterType": "MAX_NUM_ALGO_ORDERS", "maxNumAlgoOrders": 5},
+        ],
+        "permissions": [],
+        "permissionSets": [rng.sample(PERMISSIONS, rng.randint(4, len(PERMISSIONS)))],
+        "defaultSelfTradePreventionMode": "EXPIRE_MAKER",
+        "allowedSelfTradePreventionModes": ["EXPIRE_TAKER", "EXPIRE_MAKER", "EXPIRE_BOTH"],
+    }
+
+
+def futures_symbol(rng, base, index):
+    tick = 10.0 ** rng.randint(-7, -1)
+    step = 10.0 ** rng.randint(-3, 0)
+    symbol = base + "USDT"
+    return {
+        "symbol": symbol,
+        "pair": symbol,
+        "contractType": "PERPETUAL",
+        "deliveryDate": 4133404800000,
+        "onboardDate": 1569398400000 + index * 86400000,
+        "status": rng.choice(["TRADING"] * 19 + ["SETTLING"]),
+        "maintMarginPercent": "2.5000",
+        "requiredMarginPercent": "5.0000",
+        "baseAsset": base,
+        "quoteAsset": "USDT",
+        "marginAsset": "USDT",
+        "pricePrecision": rng.randint(1, 7),
+        "quantityPrecision": rng.randint(0, 3),
+        "baseAssetPrecision": 8,
+        "quotePrecision": 8,
+        "underlyingType": "COIN",
+        "underlyingSubType": [rng.choice(["Layer-1", "DeFi", "Meme", "AI", "Gaming", "Layer-2", "Infrastructure"])],
+        "triggerProtect": "0.0500",
+        "liquidationFee": "0.012500",
+        "marketTakeBound": "0.05",
+        "maxMoveOrderLimit": 10000,
+        "filters": [
+            {"filterType": "PRICE_FILTER", "minPrice": decimal(tick, 7).rstrip("0"), "maxPrice": "4529764",
+             "tickSize": decimal(tick, 7).rstrip("0")},
+            {"filterType": "LOT_SIZE", "minQty": decimal(step, 3), "maxQty": "1000", "stepSize": decimal(step, 3)},
+            {"filterType": "MARKET_LOT_SIZE", "minQty": decimal(step, 3), "maxQty": "120", "stepSize": decimal(step, 3)},
+            {"filterType": "MAX_NUM_ORDERS", "limit": 200},
+            {"filterType": "MAX_NUM_ALGO_ORDERS", "limit": 10},
+            {"filterType": "MIN_NOTIONAL", "notional": rng.choice(["5", "20", "100"])},
+            {"filterType": "PERCENT_PRICE", "multiplierUp": "1.0500", "multiplierDown": "0.9500",
+             "multiplierDecimal": "4"},
+        ],
+        "orderTypes": ["LIMIT", "MARKET", "STOP", "STOP_MARKET", "TAKE_PROFIT", "TAKE_PROFIT_MARKET",
+                       "TRAILING_STOP_MARKET"],
+        "timeInForce": ["GTC", "IOC", "FOK", "GTX", "GTD"],
+        "permissionSets": ["GRID", "COPY"],
+    }
+
+
+def rate_limits(futures):
+    return [
+        {"rateLimitType": "REQUEST_WEIGHT", "interval": "MINUTE", "intervalNum": 1, "limit": 2400 if futures else 6000},
+        {"rateLimitType": "ORDERS", "interval": "SECOND", "intervalNum": 10, "limit": 300 if futures else 100},
+        {"rateLimitType": "ORDERS", "interval": "MINUTE" if futures else "DAY", "intervalNum": 1,
+         "limit": 1200 if futures else 200000},
+    ]
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description="exchangeInfo 벤치마크 입력 생성")
+    parser.add_argument("--spot-symbols", type=int, default=2000)
+    parser.add_argument("--futures-symbols", type=int, default=500)
+    parser.add_argument("--seed", type=int, default=20240601)
+    parser.add_argument("--out", default=here)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    bases = []
+    seen = set()
+    while len(bases) < max(args.spot_symbols, args.futures_symbols):
+        name = asset_name(rng, len(bases))
+        if name not in seen:
+            seen.add(name)
+            bases.append(name)
+
+    spot_symbols = []
+    for i in range(args.spot_symbols):
+        quote = QUOTES_SPOT[0] if i % 3 == 0 else rng.choice(QUOTES_SPOT)
+        spot_symbols.append(spot_symbol(rng, bases[i % len(bases)], quote if bases[i % len(bases)] != quote else "USDT"))
+    spot = {"timezone": "UTC", "serverTime": 1717200000000, "rateLimits": rate_limits(False),
+            "exchangeFilters": [], "symbols": spot_symbols}
+
+    futures = {"timezone": "UTC", "serverTime": 1717200000000, "futuresType": "U_MARGINED",
+               "rateLimits": rate_limits(True), "exchangeFilters": [],
+               "assets": [{"asset": a, "marginAvailable": True, "autoAssetExchange": "-10000"}
+                          for a in ("USDT", "BTC", "BNB", "ETH", "USDC", "FDUSD")],
+               "symbols": [futures_symbol(rng, bases[i], i) for i in range(args.futures_symbols)]}
+
+    for name, payload in (("exchange_info_spot.json", spot), ("exchange_info_futures.json", futures)):
+        path = os.path.join(args.out, name)
+        with open(path, "w") as f:
+            json.dump(payload, f, separators=(",", ":"))
+        print("%s: %d symbols, %d bytes" % (path, len(payload["symbols"]), os.path.getsize(path)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,318 @@
+#!/usr/bin/env python3
+"""바이낸스 REST 대역 서버 (벤치마크용, 표준 라이브러리만 사용)
+
+평문 포트와 TLS 포트에서 HTTP/1.1 keep-alive와 HTTP/2를 모두 받는다.
+TLS 포트는 ALPN으로 h2/http/1.1을 고르고(인증서는 같은 디렉터리의 자체 서명 localhost.crt),
+평문 포트는 연결의 첫 24바이트가 HTTP/2 preface면 HTTP/2(prior knowledge)로, 아니면 HTTP/1.1로 처리한다.
+libcurl 7.88.x는 prior knowledge HTTP/2 연결에 두 번째 스트림을 열지 못하므로 다중화 측정은 TLS 포트를 쓴다.
+요청 헤더 블록은 해석하지 않고(HPACK 디코더 없음) 경로는 HTTP/1.1 요청에서만 구분하며,
+HTTP/2 응답은 정적 테이블 색인과 허프만 없는 리터럴만으로 인코딩한다.
+
+HTTP/1.1 경로는 exchangeInfo(BTCUSDT, ETHUSDT와 주문 필터), 주문(/order: POST 생성, DELETE 취소, GET 조회),
+그 외 시세 응답으로 나뉜다 (주문 벤치마크의 REST 경로가 로컬 필터 검증을 통과하도록).
+
+모든 응답은 --delay-ms 만큼 늦게 보내 서버 처리 시간을 흉내 내고,
+HTTP/2에서는 스트림마다 따로 기다리므로 동시 요청이 한 연결 안에서 겹친다.
+
+    python3 h2_standin.py --port 18080 --tls-port 18443 --delay-ms 2
+"""
+
+import argparse
+import asyncio
+import json
+import os
+import ssl
+import struct
+
+PREFACE = b"PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"
+
+FRAME_DATA = 0x0
+FRAME_HEADERS = 0x1
+FRAME_RST_STREAM = 0x3
+FRAME_SETTINGS = 0x4
+FRAME_PING = 0x6
+FRAME_GOAWAY = 0x7
+FRAME_CONTINUATION = 0x9
+
+FLAG_END_STREAM = 0x1
+FLAG_ACK = 0x1
+FLAG_END_HEADERS = 0x4
+
+SETTINGS_MAX_CONCURRENT_STREAMS = 0x3
+
+ORDER_ID = 0
+
+
+def ticker_body():
+    return b'{"symbol":"BTCUSDT","price":"67000.10000000"}'
+
+
+def exchange_info_body(path):
+    symbols = []
+    for symbol, base in (("BTCUSDT", "BTC"), ("ETHUSDT", "ETH")):
+        symbols.append({
+            "symbol": symbol, "status": "TRADING", "baseAsset": base, "quoteAsset": "USDT",
+            "pricePrecision": 2, "quantityPrecision": 3,
+            "filters": [
+                {"filterType": "PRICE_FILTER", "minPrice": "0.10", "maxPrice": "1000000", "tickSize": "0.10"},
+                {"filterType": "LOT_SIZE", "minQty": "0.001", "maxQty": "1000", "stepSize": "0.001"},
+                {"filterType": "MARKET_LOT_SIZE", "minQty": "0.001", "maxQty": "120", "stepSize": "0.001"},
+                {"filterType": "MAX_NUM_ORDERS", "limit": 200, "maxNumOrders": 200},
+                {"filterType": "MIN_NOTIONAL" if path.startswith("/fapi") else "NOTIONAL",
+                 "notional": "5", "minNotional": "5"},
+            ],
+        })
+    return json.dumps({"timezone": "UTC", "symbols": symbols}, separators=(",", ":")).encode()
+
+
+def order_body(method, target):
+    """exchangeInfo, 주문 경로는 주문 응답, 그 외는 시세 응답"""
+    global ORDER_ID
+    path, _, query = target.partition("?")
+    if path.endswith("/exchangeInfo"):
+        return exchange_info_body(path)
+    if "/order" not in path:
+        return ticker_body()
+    params = dict(pair.partition("=")[::2] for pair in query.split("&") if pair)
+    if method == "POST":
+        ORDER_ID += 1
+        order_id = ORDER_ID
+    else:
+        order_id = int(params.get("orderId", "0") or 0)
+    order = {
+        "symbol": params.get("symbol", "BTCUSDT"),
+        "orderId": order_id,
+        "clientOrderId": "standin%d" % order_id,
+        "price": params.get("price", "0.00000000"),
+        "origQty": params.get("quantity", "0.00100000"),
+        "executedQty": "0.00000000" if method == "DELETE" else params.get("quantity", "0.00100000"),
+        "status": "CANCELED" if method == "DELETE" else "FILLED",
+        "type": params.get("type", "MARKET"),
+        "side": params.get("side", "BUY"),
+    }
+    if path.startswith("/fapi"):
+        order.update({"avgPrice": "67000.10", "positionSide": "BOTH", "reduceOnly": False})
+    return json.dumps(order, separators=(",", ":")).encode()
+
+
+def weight_headers():
+    return [("x-mbx-used-weight-1m", "1"), ("x-mbx-order-count-10s", "1")]
+
+
+class Http1Connection:
+    def __init__(self, reader, writer, delay):
+        self.reader = reader
+        self.writer = writer
+        self.delay = delay
+
+    async def serve(self, initial):
+        buffer = initial
+        while True:
+            while b"\r\n\r\n" not in buffer:
+                chunk = await self.reader.read(65536)
+                if not chunk:
+                    return
+                buffer += chunk
+            head, buffer = buffer.split(b"\r\n\r\n", 1)
+            lines = head.decode("latin-1").split("\r\n")
+            method, target, _ = lines[0].split(" ", 2)
+            headers = {}
+            for line in lines[1:]:
+                name, _, value = line.partition(":")
+                headers[name.strip().lower()] = value.strip()
+
+            length = int(headers.get("content-length", "0"))
+            while len(buffer) < length:
+                chunk = await self.reader.read(65536)
+                if not chunk:
+                    return
+                buffer += chunk
+            body_params = buffer[:length].decode("latin-1")
+            buffer = buffer[length:]
+
+            if self.delay:
+                await asyncio.sleep(self.delay)
+
+            # 서명 요청은 파라미터를 본문(form)으로 보낼 수 있음
+            if body_params:
+                target += ("&" if "?" in target else "?") + body_params
+            body = order_body(method, target)
+            close = headers.get("connection", "").lower() == "close"
+            response = ["HTTP/1.1 200 OK", "Content-Type: application/json",
+                        "Content-Length: %d" % len(body)]
+            response += ["%s: %s" % pair for pair in weight_headers()]
+            if close:
+                response.append("Connection: close")
+            self.writer.write(("\r\n".join(response) + "\r\n\r\n").encode() + body)
+            await self.writer.drain()
+            if close:
+                return
+
+
+def frame(frame_type, flags, stream_id, payload=b""):
+    return struct.pack(">I", len(payload))[1:] + struct.pack(">BBI", frame_type, flags, stream_id) + payload
+
+
+def hpack_literal(static_index, value):
+    """정적 테이블 이름 색인 + 허프만 없는 값 (색인 없는 리터럴, 4비트 접두사)"""
+    out = bytearray()
+    if static_index < 15:
+        out.append(static_index)
+    else:
+        out.append(0x0F)
+        rest = static_index - 15
+        while rest >= 128:
+            out.append((rest & 0x7F) | 0x80)
+            rest >>= 7
+        out.append(rest)
+    encoded = value.encode()
+    if len(encoded) < 127:
+        out.append(len(encoded))
+    else:
+        out.append(0x7F)
+        rest = len(encoded) - 127
+        while rest >= 128:
+            out.append((rest & 0x7F) | 0x80)
+            rest >>= 7
+        out.append(rest)
+    return bytes(out) + encoded
+
+
+def hpack_new_name(name, value):
+    """새 이름 리터럴 (색인 없음)"""
+    return b"\x00" + bytes([len(name)]) + name.encode() + bytes([len(value)]) + value.encode()
+
+
+class Http2Connection:
+    def __init__(self, reader, writer, delay):
+        self.reader = reader
+        self.writer = writer
+        self.delay = delay
+        self.open_headers = {}   # CONTINUATION을 기다리는 스트림
+        self.tasks = set()
+
+    async def serve(self, buffer):
+        self.writer.write(frame(FRAME_SETTINGS, 0, 0, struct.pack(">HI", SETTINGS_MAX_CONCURRENT_STREAMS, 1024)))
+        while True:
+            while len(buffer) < 9:
+                chunk = await self.reader.read(65536)
+                if not chunk:
+                    return
+                buffer += chunk
+            length = int.from_bytes(buffer[0:3], "big")
+            while len(buffer) < 9 + length:
+                chunk = await self.reader.read(65536)
+                if not chunk:
+                    return
+                buffer += chunk
+            frame_type, flags = buffer[3], buffer[4]
+            stream_id = int.from_bytes(buffer[5:9], "big") & 0x7FFFFFFF
+            payload = buffer[9:9 + length]
+            buffer = buffer[9 + length:]
+
+            if frame_type == FRAME_SETTINGS:
+                if not flags & FLAG_ACK:
+                    self.writer.write(frame(FRAME_SETTINGS, FLAG_ACK, 0))
+            elif frame_type == FRAME_PING:
+                if not flags & FLAG_ACK:
+                    self.writer.write(frame(FRAME_PING, FLAG_ACK, 0, payload))
+            elif frame_type == FRAME_GOAWAY:
+                return
+            elif frame_type in (FRAME_HEADERS, FRAME_CONTINUATION):
+                if frame_type == FRAME_HEADERS:
+                    self.open_headers[stream_id] = bool(flags & FLAG_END_STREAM)
+                if flags & FLAG_END_HEADERS and self.open_headers.get(stream_id):
+                    self.respondLater(stream_id)
+            elif frame_type == FRAME_DATA:
+                if flags & FLAG_END_STREAM:
+                    self.respondLater(stream_id)
+            elif frame_type == FRAME_RST_STREAM:
+                self.open_headers.pop(stream_id, None)
+
+    def respondLater(self, stream_id):
+        self.open_headers.pop(stream_id, None)
+        task = asyncio.ensure_future(self.respond(stream_id))
+        self.tasks.add(task)
+        task.add_done_callback(self.tasks.discard)
+
+    async def respond(self, stream_id):
+        if self.delay:
+            await asyncio.sleep(self.delay)
+        body = ticker_body()
+        block = b"\x88"  # :status 200
+        block += hpack_literal(31, "application/json")   # content-type
+        block += hpack_literal(28, str(len(body)))       # content-length
+        for name, value in weight_headers():
+            block += hpack_new_name(name, value)
+        self.writer.write(frame(FRAME_HEADERS, FLAG_END_HEADERS, stream_id, block) +
+                          frame(FRAME_DATA, FLAG_END_STREAM, stream_id, body))
+        try:
+            await self.writer.drain()
+        except ConnectionError:
+            pass
+
+
+async def handle(reader, writer, delay):
+    try:
+        ssl_object = writer.get_extra_info("ssl_object")
+        if ssl_object is not None:
+            if ssl_object.selected_alpn_protocol() == "h2":
+                # ALPN으로 합의했어도 클라이언트는 preface부터 보냄
+                preface = await reader.readexactly(len(PREFACE))
+                if preface != PREFACE:
+                    return
+                await Http2Connection(reader, writer, delay).serve(b"")
+            else:
+                await Http1Connection(reader, writer, delay).serve(b"")
+            return
+
+        initial = b""
+        while len(initial) < len(PREFACE):
+            chunk = await reader.read(65536)
+            if not chunk:
+                return
+            initial += chunk
+            if not PREFACE.startswith(initial[:len(PREFACE)]):
+                break
+        if initial.startswith(PREFACE):
+            await Http2Connection(reader, writer, delay).serve(initial[len(PREFACE):])
+        else:
+            await Http1Connection(reader, writer, delay).serve(initial)
+    except (ConnectionError, asyncio.IncompleteReadError, ssl.SSLError):
+        pass
+    finally:
+        writer.close()
+
+
+async def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description="HTTP/1.1 + HTTP/2 REST 대역 서버")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=18080, help="평문 포트 (0이면 사용 안 함)")
+    parser.add_argument("--tls-port", type=int, default=18443, help="TLS 포트 (0이면 사용 안 함)")
+    parser.add_argument("--cert", default=os.path.join(here, "localhost.crt"))
+    parser.add_argument("--key", default=os.path.join(here, "localhost.key"))
+    parser.add_argument("--delay-ms", type=float, default=2.0, help="응답마다 추가하는 서버 처리 시간")
+    args = parser.parse_args()
+
+    delay = args.delay_ms / 1000.0
+    servers = []
+    if args.port:
+        servers.append(await asyncio.start_server(lambda r, w: handle(r, w, delay), args.host, args.port, backlog=512))
+        print("h2 stand-in listening on http://%s:%d" % (args.host, args.port), flush=True)
+    if args.tls_port:
+        context = ssl.create_default_context(ssl.Purpose.CLIENT_AUTH)
+        context.load_cert_chain(args.cert, args.key)
+        context.set_alpn_protocols(["h2", "http/1.1"])
+        servers.append(await asyncio.start_server(lambda r, w: handle(r, w, delay), args.host, args.tls_port,
+                                                  ssl=context, backlog=512))
+        print("h2 stand-in listening on https://%s:%d (cert %s)" % (args.host, args.tls_port, args.cert), flush=True)
+    print("response delay %.1f ms" % args.delay_ms, flush=True)
+    await asyncio.gather(*(server.serve_forever() for server in servers))
+
+
+if __name__ == "__main__":
+    try:
+        asyncio.run(main())
+    except KeyboardInterrupt:
+        pass
@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+"""바이낸스 WebSocket 대역 서버 (벤치마크/로컬 테스트용, 표준 라이브러리만 사용)
+
+경로로 역할을 나눈다.
+  /stream?streams=a/b/...   결합 스트림: 구독한 bookTicker/aggTrade/markPrice 이벤트를 계속 보냄
+  /ws-api/..., /ws-fapi/... WebSocket API: order.place/order.cancel/order.status 요청마다 주문 응답
+
+시세 이벤트는 --rate(초당 메시지 수, 0이면 송신 버퍼가 허락하는 만큼)로 보내며,
+가격에는 서버 송신 순번을 더해 값이 계속 바뀌게 한다.
+WebSocket API 응답은 --delay-ms 만큼 늦게 보내 거래소 처리 시간을 흉내 낸다.
+
+    python3 ws_standin.py --port 18090 --rate 0 --delay-ms 0.5
+    BINANCE_SPOT_STREAM_URL=ws://127.0.0.1:18090 BINANCE_SPOT_WS_API_URL=ws://127.0.0.1:18090/ws-api/v3 ...
+"""
+
+import argparse
+import asyncio
+import base64
+import hashlib
+import json
+import os
+import ssl
+import struct
+import time
+from urllib.parse import parse_qs, urlsplit
+
+GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+OP_TEXT = 0x1
+OP_CLOSE = 0x8
+OP_PING = 0x9
+OP_PONG = 0xA
+
+
+class Connection:
+    def __init__(self, reader, writer):
+        self.reader = reader
+        self.writer = writer
+        self.closed = False
+
+    async def handshake(self):
+        head = await self.reader.readuntil(b"\r\n\r\n")
+        lines = head.decode("latin-1").split("\r\n")
+        _, target, _ = lines[0].split(" ", 2)
+        headers = {}
+        for line in lines[1:]:
+            name, _, value = line.partition(":")
+            headers[name.strip().lower()] = value.strip()
+        key = headers.get("sec-websocket-key", "")
+        accept = base64.b64encode(hashlib.sha1((key + GUID).encode()).digest()).decode()
+        self.writer.write(("HTTP/1.1 101 Switching Protocols\r\n"
+                           "Upgrade: websocket\r\n"
+                           "Connection: Upgrade\r\n"
+                           "Sec-WebSocket-Accept: %s\r\n\r\n" % accept).encode())
+        await self.writer.drain()
+        return target
+
+    def send(self, opcode, payload):
+        """서버 프레임은 마스킹하지 않음"""
+        length = len(payload)
+        if length < 126:
+            header = struct.pack(">BB", 0x80 | opcode, length)
+        elif length <= 0xFFFF:
+            header = struct.pack(">BBH", 0x80 | opcode, 126, length)
+        else:
+            header = struct.pack(">BBQ", 0x80 | opcode, 127, length)
+        self.writer.write(header + payload)
+
+    async def sendText(self, text):
+        self.send(OP_TEXT, text.encode())
+        await self.writer.drain()
+
+    async def receive(self):
+        """텍스트 메시지 하나 (연결 종료 시 None), ping/close는 여기서 처리"""
+        while True:
+            first, second = await self.reader.readexactly(2)
+            opcode = first & 0x0F
+            length = second & 0x7F
+            if length == 126:
+                length = struct.unpack(">H", await self.reader.readexactly(2))[0]
+            elif length == 127:
+                length = struct.unpack(">Q", await self.reader.readexactly(8))[0]
+            mask = await self.reader.readexactly(4) if second & 0x80 else b"\0\0\0\0"
+            payload = bytearray(await self.reader.readexactly(length))
+            for i in range(length):
+                payload[i] ^= mask[i & 3]
+
+            if opcode == OP_PING:
+                self.send(OP_PONG, bytes(payload))
+            elif opcode == OP_CLOSE:
+                if not self.closed:
+                    self.closed = True
+                    self.send(OP_CLOSE, bytes(payload[:2]))
+                return None
+            elif opcode == OP_TEXT:
+                return payload.decode()
+
+
+def market_event(stream, sequence):
+    symbol, _, kind = stream.partition("@")
+    upper = symbol.upper()
+    base = 100.0 + (sum(map(ord, upper)) % 500)
+    price = "%.2f" % (base + (sequence % 1000) * 0.01)
+    now_ms = int(time.time() * 1000)
+    if kind.startswith("bookTicker"):
+        data = {"u": sequence, "s": upper, "b": price, "B": "1.500", "a": "%.2f" % (float(price) + 0.01), "A": "2.000"}
+    elif kind.startswith("aggTrade"):
+        data = {"e": "aggTrade", "E": now_ms, "s": upper, "a": sequence, "p": price, "q": "0.010",
+                "T": now_ms, "m": sequence % 2 == 0}
+    elif kind.startswith("markPrice"):
+        data = {"e": "markPriceUpdate", "E": now_ms, "s": upper, "p": price, "i": price,
+                "r": "0.00010000", "T": now_ms + 3600000}
+    else:
+        data = {"e": kind, "E": now_ms, "s": upper}
+    return json.dumps({"stream": stream, "data": data}, separators=(",", ":"))
+
+
+async def serve_market(connection, target, rate):
+    query = parse_qs(urlsplit(target).query)
+    streams = [s for s in query.get("streams", [""])[0].split("/") if s]
+    if not streams:
+        return
+
+    async def pump():
+        sequence = 0
+        interval = 1.0 / rate if rate > 0 else 0.0
+        next_send = time.monotonic()
+        while not connection.closed:
+            connection.send(OP_TEXT, market_event(streams[sequence % len(streams)], sequence).encode())
+            sequence += 1
+            if interval:
+                next_send += interval
+                delay = next_send - time.monotonic()
+                if delay > 0:
+                    await connection.writer.drain()
+                    await asyncio.sleep(delay)
+            elif sequence % 64 == 0:
+                await connection.writer.drain()
+
+    task = asyncio.ensure_future(pump())
+    try:
+        while await connection.receive() is not None:
+            pass
+    finally:
+        connection.closed = True
+        task.cancel()
+
+
+ORDER_ID = 0
+
+
+def order_result(method, params):
+    global ORDER_ID
+    if method == "order.place":
+        ORDER_ID += 1
+        order_id = ORDER_ID
+    else:
+        order_id = int(params.get("orderId", 0) or 0)
+    status = "CANCELED" if method == "order.cancel" else "FILLED"
+    return {
+        "symbol": params.get("symbol", "BTCUSDT"),
+        "orderId": order_id,
+        "clientOrderId": params.get("newClientOrderId", "standin%d" % order_id),
+        "price": str(params.get("price", "0.00000000")),
+        "origQty": str(params.get("quantity", "0.00100000")),
+        "executedQty": str(params.get("quantity", "0.00100000")),
+        "avgPrice": "67000.10",
+        "status": status,
+        "type": params.get("type", "MARKET"),
+        "side": params.get("side", "BUY"),
+        "positionSide": params.get("positionSide", "BOTH"),
+    }
+
+
+async def serve_api(connection, delay):
+    async def reply(request):
+        if delay:
+            await asyncio.sleep(delay)
+        response = {"id": request.get("id"), "status": 200,
+                    "result": order_result(request.get("method", ""), request.get("params", {})),
+                    "rateLimits": []}
+        try:
+            await connection.sendText(json.dumps(response, separators=(",", ":")))
+        except ConnectionError:
+            pass
+
+    pending = set()
+    while True:
+        message = await connection.receive()
+        if message is None:
+            break
+        try:
+            request = json.loads(message)
+        except ValueError:
+            continue
+        if delay:
+            task = asyncio.ensure_future(reply(request))
+            pending.add(task)
+            task.add_done_callback(pending.discard)
+        else:
+            await reply(request)
+
+
+async def handle(reader, writer, args):
+    connection = Connection(reader, writer)
+    try:
+        target = await connection.handshake()
+        path = urlsplit(target).path
+        if path.startswith("/ws-api") or path.startswith("/ws-fapi"):
+            await serve_api(connection, args.delay_ms / 1000.0)
+        else:
+            await serve_market(connection, target, args.rate)
+    except (ConnectionError, asyncio.IncompleteReadError, asyncio.LimitOverrunError, ssl.SSLError):
+        pass
+    finally:
+        writer.close()
+
+
+async def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description="WebSocket 시세 스트림 + WebSocket API 대역 서버")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=18090, help="ws:// 포트")
+    parser.add_argument("--tls-port", type=int, default=0, help="wss:// 포트 (0이면 사용 안 함)")
+    parser.add_argument("--cert", default=os.path.join(here, "localhost.crt"))
+    parser.add_argument("--key", default=os.path.join(here, "localhost.key"))
+    parser.add_argument("--rate", type=float, default=1000.0, help="연결당 초당 시세 메시지 수 (0이면 제한 없음)")
+    parser.add_argument("--delay-ms", type=float, default=0.0, help="WebSocket API 응답 지연")
+    args = parser.parse_args()
+
+    servers = [await asyncio.start_server(lambda r, w: handle(r, w, args), args.host, args.port, backlog=256)]
+    print("ws stand-in listening on ws://%s:%d" % (args.host, args.port), flush=True)
+    if args.tls_port:
+        context = ssl.create_default_context(ssl.Purpose.CLIENT_AUTH)
+        context.load_cert_chain(args.cert, args.key)
+        servers.append(await asyncio.start_server(lambda r, w: handle(r, w, args), args.host, args.tls_port,
+                                                  ssl=context, backlog=256))
+        print("ws stand-in listening on wss://%s:%d" % (args.host, args.tls_port), flush=True)
+    await asyncio.gather(*(server.serve_forever() for server in servers))
+
+
+if __name__ == "__main__":
+    try:
+        asyncio.run(main())
+    except KeyboardInterrupt:
+        pass
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "connection_pool.h"
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+// curl_multi 기반 비동기 HTTP 클라이언트
+// 전용 전송 스레드 하나가 여러 요청을 동시에 처리하므로
+// 독립적인 요청들의 전체 지연 시간은 가장 느린 요청 하나의 시간이 된다
+class AsyncHttpClient {
+public:
+    // 완료 콜백 (전송 스레드에서 호출되므로 오래 걸리는 작업은 피할 것)
+    using Callback = std::function<void(HttpResponse)>;
+
+    explicit AsyncHttpClient(std::shared_ptr<ConnectionPool> pool);
+    ~AsyncHttpClient();
+
+    AsyncHttpClient(const AsyncHttpClient&) = delete;
+    AsyncHttpClient& operator=(const AsyncHttpClient&) = delete;
+
+    // 요청을 전송하고 결과를 future로 반환
+    std::future<HttpResponse> submit(const HttpRequest& request);
+
+    // 요청을 전송하고 완료 시 콜백 호출
+    void submit(const HttpRequest& request, Callback callback);
+
+    // 현재 진행 중인 요청 수
+    size_t inFlight() const;
+
+private:
+    struct Transfer {
+        HttpRequest request;
+        HttpResponse response;
+        Callback callback;
+        std::string base_url;
+        CURL* curl = nullptr;
+    };
+
+    void run();
+    void startPending();
+    void finishTransfer(CURL* curl, CURLcode result);
+
+    std::shared_ptr<ConnectionPool> pool_;
+    CURLM* multi_;
+    std::thread worker_;
+    std::atomic<bool> running_;
+    std::atomic<size_t> in_flight_;
+    std::set<Transfer*> active_;          // 전송 스레드에서만 접근
+
+    std::mutex mutex_;
+    std::deque<std::unique_ptr<Transfer>> pending_;
+};
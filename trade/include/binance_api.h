@@ -3,6 +3,29 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <memory>
+#include <future>
+#include <functional>
+#include "connection_pool.h"
+#include "decimal.h"
+#include "async_http_client.h"
+#include "request_scheduler.h"
+#include "market_data_stream.h"
+#include "order_book.h"
+#include "trade_types.h"
+
+class AccountStore;
+class UserDataStream;
+class OrderSession;
+class SymbolRegistry;
+class RequestSigner;
+class OrderBookStream;
+class OrderGateway;
+struct OrderIntent;
+struct OrderReply;
+struct OrderGatewayStats;
+class MarkPriceStream;
+struct PositionTotals;
 
 struct OrderResponse {
     std::string symbol;
@@ -29,6 +52,19 @@ struct MarketPrice {
     std::string error;
 };
 
+// 여러 심볼 시세를 한 번에 받은 결과 (SymbolTable ID로 바로 찾는 평면 배열)
+struct MarketPriceTable {
+    MarketType market;
+    std::vector<double> prices;       // SymbolId 색인, 0이면 응답에 없던 심볼
+    std::vector<SymbolId> symbols;    // 가격이 채워진 심볼 (응답 순서)
+    bool success;
+    std::string error;
+
+    // 가격 (없으면 0)
+    double price(SymbolId id) const { return id < prices.size() ? prices[id] : 0.0; }
+    double price(std::string_view symbol) const { return price(SymbolTable::instance().find(symbol)); }
+};
+
 // 선물거래 계정 정보
 struct FuturesAccountInfo {
     double totalWalletBalance;    // 총 지갑 잔고
@@ -36,6 +72,8 @@ struct FuturesAccountInfo {
     double totalMarginBalance;    // 총 마진 잔고
     double availableBalance;      // 사용 가능한 잔고
     double maxWithdrawAmount;     // 최대 출금 가능 금액
+    double usdtCrossWalletBalance;  // USDT 자산의 교차 지갑 잔고 (assets 배열)
+    bool hasUsdtCrossWallet;        // assets 배열에 USDT 항목이 있었는지 여부
     bool success;
     std::string error;
 };
@@ -48,6 +86,8 @@ struct FuturesPosition {
     double markPrice;             // 마크 가격
     double unRealizedProfit;      // 미실현 손익
     double percentage;            // 수익률 (%)
+    double roe = 0.0;             // 증거금 대비 수익률 (%, 포지션 저장소에서만 계산)
+    double liquidationDistance = 0.0;  // 증거금 소진 가격까지 거리 (%, 포지션 저장소에서만 계산)
     std::string positionSide;     // 포지션 방향 (LONG/SHORT/BOTH)
     int leverage;                 // 레버리지
     bool success;
@@ -71,27 +111,60 @@ struct FuturesOrderResponse {
     std::string error;
 };
 
-// 선물거래 심볼 정보
-struct FuturesSymbolInfo {
+// 선물거래 주문 요청 (일괄 주문용)
+struct FuturesOrderRequest {
+    std::string symbol;
+    std::string side;                      // BUY/SELL
+    std::string type = "MARKET";           // MARKET/LIMIT
+    Decimal quantity;
+    Decimal price;                         // LIMIT 주문에만 사용
+    std::string positionSide = "BOTH";     // LONG/SHORT/BOTH
+    std::string timeInForce = "GTC";       // LIMIT 주문에만 사용
+    bool reduceOnly = false;
+    std::string newClientOrderId;          // 비어 있으면 거래소가 생성
+};
+
+// 거래소 심볼 정보 (현물/선물 exchangeInfo 공통)
+struct SymbolInfo {
     std::string symbol;           // 심볼 (예: BTCUSDT)
     std::string baseAsset;        // 기본 자산 (예: BTC)
     std::string quoteAsset;       // 견적 자산 (예: USDT)
     std::string status;           // 거래 상태 (TRADING/BREAK 등)
-    double minQty;                // 최소 주문 수량
-    double maxQty;                // 최대 주문 수량
-    double stepSize;              // 수량 단위
-    double minNotional;           // 최소 주문 금액
+    Decimal minQty;               // 최소 주문 수량 (LOT_SIZE)
+    Decimal maxQty;               // 최대 주문 수량
+    Decimal stepSize;             // 수량 단위
+    Decimal marketMinQty;         // 시장가 최소 수량 (MARKET_LOT_SIZE, 0: LOT_SIZE 사용)
+    Decimal marketMaxQty;         // 시장가 최대 수량
+    Decimal marketStepSize;       // 시장가 수량 단위
+    Decimal tickSize;             // 가격 단위 (PRICE_FILTER)
+    Decimal minPrice;             // 최소 가격 (0: 제한 없음)
+    Decimal maxPrice;             // 최대 가격 (0: 제한 없음)
+    Decimal minNotional;          // 최소 주문 금액 (MIN_NOTIONAL/NOTIONAL)
+    Decimal maxNotional;          // 최대 주문 금액 (0: 제한 없음)
+    Decimal multiplierUp;         // 기준가 대비 최대 가격 배수 (PERCENT_PRICE, 0: 검사 안 함)
+    Decimal multiplierDown;       // 기준가 대비 최소 가격 배수
+    int maxNumOrders;             // 심볼별 최대 미체결 주문 수 (MAX_NUM_ORDERS, 0: 제한 없음)
     int pricePrecision;           // 가격 정밀도
     int quantityPrecision;        // 수량 정밀도
 };
 
+using FuturesSymbolInfo = SymbolInfo;
+
 // 선물거래 심볼 목록 응답
 struct FuturesSymbolsResponse {
     std::vector<FuturesSymbolInfo> symbols;
+    size_t skippedSymbols = 0;        // 해석하지 못해 건너뛴 심볼 수 (exchangeInfo 수신 시, 성공해도 error에 이유)
     bool success;
     std::string error;
 };
 
+// 포지션 진입 시 수량이 거래소 필터에 미달할 때의 처리 방식 (주문 전에 호출자가 결정)
+// stepSize 배수로 내리는 조정은 두 방식 모두 자동으로 적용됨
+enum class QuantityAdjustPolicy {
+    Reject,     // 주문하지 않고 권장 수량을 담은 오류 반환
+    RoundUp     // 모든 필터를 통과하는 최소 수량으로 올려서 주문
+};
+
 class BinanceAPI {
 public:
     BinanceAPI(const std::string& api_key, const std::string& secret_key);
@@ -102,23 +175,57 @@ public:
     // 현재 시장 가격 조회
     MarketPrice getCurrentPrice(const std::string& symbol = "BTCUSDT");
     
-    // 비트코인 구매
-    OrderResponse buyBitcoin(double quantity);
+    // 현재 시장 가격 비동기 조회 (future 또는 완료 콜백)
+    std::future<MarketPrice> getCurrentPriceAsync(const std::string& symbol = "BTCUSDT");
+    void getCurrentPriceAsync(const std::string& symbol, std::function<void(MarketPrice)> callback);
+    
+    // 여러 심볼 시세 일괄 조회 (요청 한 번, 응답 배열은 수신하면서 한 번에 해석)
+    // 현물은 symbols=[...] 목록 조회, 선물은 목록 조회가 없어 전체 조회 후 요청한 심볼만 남김
+    // 모든 심볼이 시세 스트림에 있으면 네트워크 요청 없이 스트림 값으로 채움
+    MarketPriceTable getPrices(const std::vector<std::string>& symbols, MarketType type = MarketType::Spot);
+    
+    // 전체 심볼 시세 일괄 조회
+    MarketPriceTable getAllPrices(MarketType type = MarketType::Spot);
     
-    // 비트코인 판매
-    OrderResponse sellBitcoin(double quantity);
+    // 현물 주문 (모든 현물 심볼, 캐시된 거래소 필터로 검증한 뒤 서명 요청 한 번만 전송)
+    // price와 timeInForce는 지정가 계열 주문에만 전송, newClientOrderId가 비어 있으면 거래소가 생성
+    OrderResponse placeSpotOrder(const std::string& symbol, const std::string& side, const std::string& type,
+                                 Decimal quantity, Decimal price = Decimal(), const std::string& timeInForce = "GTC",
+                                 const std::string& newClientOrderId = "");
+    
+    // 같은 주문을 /api/v3/order/test로 보내 거래소 검증만 수행 (실제 실행 안함, 필요할 때 명시적으로 호출)
+    OrderResponse testSpotOrder(const std::string& symbol, const std::string& side, const std::string& type,
+                                Decimal quantity, Decimal price = Decimal(), const std::string& timeInForce = "GTC",
+                                const std::string& newClientOrderId = "");
+    
+    // 비트코인 시장가 구매/판매 (placeSpotOrder("BTCUSDT", ...)와 동일)
+    OrderResponse buyBitcoin(Decimal quantity);
+    OrderResponse sellBitcoin(Decimal quantity);
     
     // 최소 주문 수량 조회
-    double getMinOrderQuantity(const std::string& symbol = "BTCUSDT");
+    Decimal getMinOrderQuantity(const std::string& symbol = "BTCUSDT");
+    std::future<Decimal> getMinOrderQuantityAsync(const std::string& symbol = "BTCUSDT");
+    
+    // 심볼 정보 조회 (캐시된 exchangeInfo 사용, 첫 조회에만 네트워크 요청)
+    // 심볼이 없거나 로드에 실패하면 false
+    bool getSymbolInfo(MarketType type, const std::string& symbol, SymbolInfo& info);
+    
+    // 심볼 캐시를 백그라운드에서 즉시 다시 로드
+    void refreshSymbols(MarketType type);
     
-    // LOT_SIZE 필터에 맞게 수량 조정
-    double adjustQuantityForLotSize(const std::string& symbol, double quantity);
+    // LOT_SIZE 필터에 맞게 수량 조정 (stepSize 배수로 올림)
+    Decimal adjustQuantityForLotSize(const std::string& symbol, Decimal quantity);
     
     // API 키 권한 확인
     bool checkApiPermissions();
+    std::future<bool> checkApiPermissionsAsync();
+    
+    // 현물 주문 취소 / 상태 조회
+    OrderResponse cancelSpotOrder(const std::string& symbol, const std::string& orderId);
+    OrderResponse getSpotOrderStatus(const std::string& symbol, const std::string& orderId);
     
     // 테스트 주문 (실제 실행 안함)
-    OrderResponse testOrder(const std::string& side, double quantity);
+    OrderResponse testOrder(const std::string& side, Decimal quantity);
     
     // 네트워크 연결 테스트
     bool testConnection();
@@ -128,8 +235,8 @@ public:
     // 선물거래 계정 정보 조회
     FuturesAccountInfo getFuturesAccountInfo();
     
-    // 선물거래 포지션 조회
-    std::vector<FuturesPosition> getFuturesPositions();
+    // 선물거래 포지션 조회 (include_flat이면 수량 0인 심볼도 포함)
+    std::vector<FuturesPosition> getFuturesPositions(bool include_flat = false);
     
     // 특정 심볼의 포지션 조회
     FuturesPosition getFuturesPosition(const std::string& symbol = "BTCUSDT");
@@ -140,49 +247,276 @@ public:
     // 마진 타입 설정 (ISOLATED/CROSSED)
     bool setMarginType(const std::string& symbol, const std::string& marginType);
     
-    // 선물거래 롱 포지션 진입
-    FuturesOrderResponse openLongPosition(const std::string& symbol, double quantity);
-    
-    // 선물거래 숏 포지션 진입
-    FuturesOrderResponse openShortPosition(const std::string& symbol, double quantity);
+    // 선물거래 롱/숏 포지션 진입 (입력을 기다리지 않으며 서명 요청은 주문 한 번)
+    // 시세는 스트림/호가창에서, 필터는 심볼 캐시에서 가져오고 캐시에 없을 때만 조회를 동시에 보냄
+    FuturesOrderResponse openLongPosition(const std::string& symbol, Decimal quantity,
+                                          QuantityAdjustPolicy policy = QuantityAdjustPolicy::Reject);
+    FuturesOrderResponse openShortPosition(const std::string& symbol, Decimal quantity,
+                                           QuantityAdjustPolicy policy = QuantityAdjustPolicy::Reject);
     
     // 선물거래 포지션 종료
     FuturesOrderResponse closePosition(const std::string& symbol, const std::string& positionSide = "BOTH");
     
     // 선물거래 시장가 주문
     FuturesOrderResponse futuresMarketOrder(const std::string& symbol, const std::string& side, 
-                                           double quantity, const std::string& positionSide = "BOTH");
+                                           Decimal quantity, const std::string& positionSide = "BOTH");
     
-    // 선물거래 지정가 주문
+    // 선물거래 지정가 주문 (가격은 tickSize 배수로 매수는 내림, 매도는 올림)
+    // 입력을 기다리지 않으며, 최소 수량 미달은 policy대로 처리 (Reject면 권장 수량을 담은 오류 반환)
     FuturesOrderResponse futuresLimitOrder(const std::string& symbol, const std::string& side, 
-                                          double quantity, double price, const std::string& positionSide = "BOTH");
+                                          Decimal quantity, Decimal price, const std::string& positionSide = "BOTH",
+                                          QuantityAdjustPolicy policy = QuantityAdjustPolicy::Reject);
+    
+    // 선물거래 주문 취소 / 상태 조회
+    FuturesOrderResponse cancelFuturesOrder(const std::string& symbol, const std::string& orderId);
+    FuturesOrderResponse getFuturesOrderStatus(const std::string& symbol, const std::string& orderId);
+    
+    // 선물거래 단일 주문 (입력을 기다리지 않음, 필터 위반이면 전송하지 않고 오류 반환)
+    FuturesOrderResponse placeFuturesOrder(const FuturesOrderRequest& request);
+    
+    // 선물거래 일괄 주문 (/fapi/v1/batchOrders, 5개씩 나누어 전송)
+    // 결과는 요청 순서대로 반환되며 주문별 성공/실패가 개별 기록됨
+    std::vector<FuturesOrderResponse> placeFuturesOrders(const std::vector<FuturesOrderRequest>& orders);
     
-    // 선물거래 가능한 심볼 목록 조회
+    // 선물거래 가능한 심볼 목록 조회 (USDT 페어, 거래 가능 상태만, 심볼 캐시 사용)
     FuturesSymbolsResponse getFuturesSymbols();
+    std::future<FuturesSymbolsResponse> getFuturesSymbolsAsync();
+    
+    // exchangeInfo의 모든 심볼을 응답 수신 중에 하나씩 전달 (응답 전체를 메모리에 모으지 않음)
+    // 반환값에는 성공 여부와 오류만 기록되고 symbols는 비어 있음
+    FuturesSymbolsResponse streamFuturesSymbols(const std::function<void(const FuturesSymbolInfo&)>& on_symbol);
     
     // 선물거래 최소주문수량 검증 및 조정
     struct FuturesOrderValidation {
         bool isValid;
-        double adjustedQuantity;
-        double minQuantity;
-        double minNotional;
-        double currentPrice;
+        Decimal adjustedQuantity;
+        Decimal minQuantity;
+        Decimal minNotional;
+        Decimal currentPrice;
+        Decimal tickSize;
         std::string warning;
         std::string error;
     };
     
-    FuturesOrderValidation validateFuturesOrderQuantity(const std::string& symbol, double quantity);
+    FuturesOrderValidation validateFuturesOrderQuantity(const std::string& symbol, Decimal quantity);
+    
+    // 선물 기준 가격 (선물 스트림 → 호가창 중간값 → /fapi/v1/ticker/price 순)
+    std::future<MarketPrice> getFuturesPriceAsync(const std::string& symbol);
+
+    // 연결 풀 통계 (핸드셰이크 vs 연결 재사용)
+    ConnectionPoolStats getConnectionStats() const;
+    
+    // 요청 가중치 스케줄러 상태 (남은 가중치, 대기열 깊이, 대기 시간)
+    RateLimitStats getSpotRateLimitStats() const;
+    RateLimitStats getFuturesRateLimitStats() const;
+    
+    // HTTP/2 다중화 모드 (기본값: HTTP/1.1)
+    // 비동기 요청(AsyncHttpClient)에만 적용되며, 동기 요청은 항상 HTTP/1.1 연결 풀을 사용
+    void setHttp2Enabled(bool enabled);
+    bool isHttp2Enabled() const;
+    
+    // REST 접속 주소 변경 (로컬 테스트 서버 등, http:// 또는 https://)
+    // 심볼 캐시도 새 주소에서 다시 받으며, 기본 주소가 아니면 설정 디렉토리의 캐시 파일은 쓰지 않음
+    void setRestEndpoints(const std::string& spot_url, const std::string& futures_url);
+    
+    // === 실시간 시세 스트림 (WebSocket) ===
+    
+    // 현물/선물 bookTicker, aggTrade, markPrice 결합 스트림 구독 시작
+    // 스트림이 연결되어 있는 동안 getCurrentPrice와 선물 수량 검증은 네트워크 요청 없이 최신 시세를 사용
+    void startMarketDataStream(const std::vector<std::string>& symbols);
+    void stopMarketDataStream();
+    bool isMarketDataStreamLive() const;
+    
+    // 스트림 최신 시세 조회 (구독하지 않은 심볼이면 valid == false)
+    PriceSnapshot getStreamPrice(const std::string& symbol, MarketType type = MarketType::Spot) const;
+    
+    // 스트림 접속 주소 변경 (로컬 테스트 서버 등, ws:// 또는 wss://)
+    void setStreamEndpoints(const std::string& spot_url, const std::string& futures_url);
+    
+    // === 로컬 호가창 ===
+    
+    // REST /depth 스냅샷 (limit: 현물 최대 5000, 선물 최대 1000)
+    DepthSnapshot getDepthSnapshot(MarketType type, const std::string& symbol, int limit = 1000);
+    
+    // 심볼별 @depth@100ms 차분 스트림과 스냅샷으로 로컬 호가창 유지 (시장별로 하나, 다시 호출하면 교체)
+    void startOrderBookStream(MarketType type, const std::vector<std::string>& symbols);
+    void stopOrderBookStream(MarketType type);
+    bool isOrderBookStreamLive(MarketType type) const;
+    
+    // 구독 중인 심볼의 호가창 (구독하지 않았으면 nullptr, 동기화 여부는 isSynced로 확인)
+    std::shared_ptr<const OrderBook> getOrderBook(MarketType type, const std::string& symbol) const;
+    
+    // === WebSocket API 주문 세션 ===
+    
+    // 활성화하면 주문 생성/취소/조회를 인증된 WebSocket 연결 하나로 처리 (기본값: REST)
+    // 세션에 연결할 수 없으면 해당 요청은 REST로 전송
+    void setOrderSessionEnabled(bool enabled);
+    bool isOrderSessionEnabled() const;
+    void setOrderSessionEndpoints(const std::string& spot_url, const std::string& futures_url);
+    
+    // 주문 세션 왕복 시간 (ms, 요청이 없으면 0)
+    double getOrderSessionLatencyMs(MarketType type) const;
+    
+    // === 주문 게이트웨이 ===
+    
+    // 주문 전용 스레드 시작 (세션 모드면 게이트웨이 전용 주문 세션을 미리 연결)
+    // 이후 submitOrder는 미리 할당된 링에 의도를 복사만 하고 바로 반환하며, 결과는 pollOrderReply로 가져온다
+    void startOrderGateway(size_t capacity = 1024);
+    void stopOrderGateway();
+    bool isOrderGatewayRunning() const;
+    
+    // 단일 신호 스레드에서 제출 (게이트웨이가 없거나 링이 가득 차면 false)
+    bool submitOrder(const OrderIntent& intent);
+    // 여러 스레드에서 제출할 때 사용 (다중 생산자 링)
+    bool submitOrderShared(const OrderIntent& intent);
+    // 처리 결과 (한 스레드에서만 호출, 없으면 false)
+    bool pollOrderReply(OrderReply& reply);
+    bool getOrderGatewayStats(OrderGatewayStats& stats) const;
+    
+    // === 계정 실시간 동기화 (사용자 데이터 스트림) ===
+    
+    // 현물/선물 사용자 데이터 스트림 시작
+    // 스트림이 연결되어 있는 동안 getAccountInfo, getFuturesAccountInfo, getFuturesPositions,
+    // getFuturesPosition은 네트워크 요청 없이 메모리 저장소에서 응답
+    void startUserDataStream();
+    void stopUserDataStream();
+    bool isUserDataStreamLive(MarketType type) const;
+    
+    // 전체 심볼 마크 가격 스트림 (!markPrice@arr@1s, 사용자 데이터 스트림과 함께 시작/종료)
+    bool isMarkPriceStreamLive() const;
+    
+    // 모든 포지션의 미실현 손익/증거금/ROE/최소 청산 거리 합계 (REST 요청 없음)
+    // 선물 사용자 데이터 스트림이 연결되어 있지 않으면 false
+    bool getPositionTotals(PositionTotals& totals) const;
+    
+    // 스트림으로 받은 최근 주문 상태 조회 (기록이 없으면 false)
+    bool getStreamOrderUpdate(const std::string& orderId, FuturesOrderResponse& order) const;
+    bool getStreamOrderUpdate(const std::string& orderId, OrderResponse& order) const;
+    
+    // listenKey 발급/연장/삭제 (실패 시 빈 문자열 또는 false)
+    std::string createListenKey(MarketType type);
+    bool keepAliveListenKey(MarketType type, const std::string& listen_key);
+    void closeListenKey(MarketType type, const std::string& listen_key);
 
 private:
     std::string api_key_;
-    std::string secret_key_;
+    
+    // 비밀키로 미리 계산한 HMAC 상태 (복사본끼리 공유, 읽기 전용)
+    std::shared_ptr<const RequestSigner> signer_;
     std::string base_url_;
     std::string futures_base_url_;
     
+    // 현물/선물 요청이 함께 사용하는 연결 풀과 공통 헤더 (복사본끼리 공유)
+    std::shared_ptr<ConnectionPool> connection_pool_;
+    std::shared_ptr<curl_slist> headers_;
+    bool http2_enabled_;
+    
+    // 여러 요청을 동시에 처리하는 비동기 전송 엔진
+    std::shared_ptr<AsyncHttpClient> async_client_;
+    
+    // 현물/선물 요청 가중치 스케줄러 (한도는 계정이 아닌 IP 기준이므로 복사본끼리 공유)
+    std::shared_ptr<RequestScheduler> spot_scheduler_;
+    std::shared_ptr<RequestScheduler> futures_scheduler_;
+    
+    // 실시간 시세 스트림 (복사본끼리 공유)
+    std::string spot_stream_url_;
+    std::string futures_stream_url_;
+    std::shared_ptr<MarketDataStream> spot_stream_;
+    std::shared_ptr<MarketDataStream> futures_stream_;
+    
+    // 스트림이 살아 있으면 최신 시세를 price에 기록하고 true 반환
+    bool streamPrice(MarketType type, const std::string& symbol, double& price) const;
+    
+    // 로컬 호가창 스트림 (복사본끼리 공유)
+    std::shared_ptr<OrderBookStream> spot_book_stream_;
+    std::shared_ptr<OrderBookStream> futures_book_stream_;
+    
+    // exchangeInfo 심볼/필터 캐시 (복사본끼리 공유)
+    std::shared_ptr<SymbolRegistry> spot_symbols_;
+    std::shared_ptr<SymbolRegistry> futures_symbols_;
+    
+    // 현재 REST 주소로 심볼 캐시 생성 (생성자와 setRestEndpoints에서 호출)
+    void resetSymbolRegistries();
+    
+    // 주문 응답이 필터 오류(-1013/-1111)면 거래소 필터가 바뀐 것이므로 심볼 캐시 갱신
+    void checkFilterError(MarketType type, const std::string& response);
+    
+    // exchangeInfo의 모든 심볼을 수신 중에 하나씩 전달
+    FuturesSymbolsResponse streamExchangeSymbols(MarketType type, const std::function<void(const SymbolInfo&)>& on_symbol);
+    
+    // 사용자 데이터 스트림으로 갱신되는 계정 저장소 (복사본끼리 공유)
+    std::shared_ptr<AccountStore> account_store_;
+    std::shared_ptr<UserDataStream> spot_user_stream_;
+    std::shared_ptr<UserDataStream> futures_user_stream_;
+    std::shared_ptr<MarkPriceStream> mark_stream_;
+    
+    // 사용자 데이터 스트림이 살아 있으면 심볼의 미체결 주문 수, 아니면 -1
+    int openOrderCount(MarketType type, const std::string& symbol) const;
+    
+    // WebSocket API 주문 세션 (복사본끼리 공유, 첫 주문 시 연결)
+    bool order_session_enabled_;
+    std::string spot_ws_api_url_;
+    std::string futures_ws_api_url_;
+    std::shared_ptr<OrderSession> spot_order_session_;
+    std::shared_ptr<OrderSession> futures_order_session_;
+    
+    // 주문 게이트웨이 (복사본끼리 공유, 게이트웨이 자신의 복사본에는 없음)
+    std::shared_ptr<OrderGateway> order_gateway_;
+    
+    // 주문 요청 전송 (세션 모드면 WebSocket API, 아니면 REST /api/v3/order, /fapi/v1/order)
+    // 응답 형식은 makeRequest와 동일
+    std::string makeOrderRequest(MarketType type, const std::string& ws_method, const std::string& http_method,
+                                 const std::map<std::string, std::string>& params);
+    std::shared_ptr<OrderSession> orderSession(MarketType type);
+    static void parseSpotOrderResult(const std::string& response, OrderResponse& order);
+    
+    // 현물 주문 파라미터 구성 (필터 위반이면 order에 오류를 기록하고 false)
+    bool buildSpotOrderParams(const std::string& symbol, const std::string& side, const std::string& type,
+                              Decimal quantity, Decimal price, const std::string& timeInForce,
+                              const std::string& newClientOrderId, std::map<std::string, std::string>& params,
+                              OrderResponse& order);
+    
+    // 선물 주문에 거래소 필터 적용 (위반이면 error에 기록하고 false)
+    bool normalizeFuturesOrder(const FuturesOrderRequest& request, FuturesOrderRequest& normalized,
+                               std::string& error);
+    
+    // 롱/숏 진입 공통 처리 (검증 후 시장가 주문)
+    FuturesOrderResponse openPosition(const std::string& symbol, const std::string& side, Decimal quantity,
+                                      QuantityAdjustPolicy policy);
+    
+    // 스트림을 사용하지 않는 REST 전용 복사본 (스트림 스레드가 스냅샷 조회에 사용)
+    BinanceAPI restClient() const;
+    
+    // 마크 가격 스트림이 없으면 시세 스트림의 마크 가격을 포지션 저장소에 반영
+    void refreshPositionMarks() const;
+    
     std::string createSignature(const std::string& query_string);
+    HttpRequest prepareRequest(const std::string& base_url, const std::string& endpoint, const std::string& method,
+                               const std::map<std::string, std::string>& params, bool is_signed);
+    static std::string handleResponse(const HttpRequest& request, const HttpResponse& response,
+                                      const std::string& error_prefix);
     std::string makeRequest(const std::string& endpoint, const std::string& method = "GET", 
-                          const std::map<std::string, std::string>& params = {}, bool is_signed = false);
+                          const std::map<std::string, std::string>& params = {}, bool is_signed = false,
+                          const std::function<bool(const char*, size_t)>& on_data = nullptr);
+    // on_data를 지정하면 성공 응답 본문은 수신 즉시 전달되고 빈 문자열을 반환 (오류 응답은 그대로 반환)
     std::string makeFuturesRequest(const std::string& endpoint, const std::string& method = "GET", 
-                                 const std::map<std::string, std::string>& params = {}, bool is_signed = false);
+                                 const std::map<std::string, std::string>& params = {}, bool is_signed = false,
+                                 const std::function<bool(const char*, size_t)>& on_data = nullptr);
+    std::future<std::string> makeRequestAsync(const std::string& endpoint, const std::string& method = "GET", 
+                                              const std::map<std::string, std::string>& params = {}, bool is_signed = false);
+    // order_count: 주문 수 한도에 더할 신규 주문 수 (-1이면 엔드포인트로 판단, batchOrders는 묶음 크기)
+    std::future<std::string> makeFuturesRequestAsync(const std::string& endpoint, const std::string& method = "GET", 
+                                                     const std::map<std::string, std::string>& params = {}, bool is_signed = false,
+                                                     int order_count = -1);
     long long getCurrentTimestamp();
+    
+    // 응답 파싱 (동기/비동기 호출이 공유)
+    static MarketPrice parseCurrentPrice(const std::string& symbol, const std::string& response);
+    
+    // ticker/price 배열 조회 (wanted가 비어 있지 않으면 해당 ID만 남김)
+    // list_rejected: 거래소가 symbols 목록 자체를 거절했는지 (-1121 잘못된 심볼, -1100 잘못된 문자)
+    MarketPriceTable fetchPriceTable(MarketType type, const std::map<std::string, std::string>& params,
+                                     const std::vector<bool>& wanted, bool* list_rejected = nullptr);
+    static bool parseApiPermissions(const std::string& response);
+    static void parseFuturesOrderResult(const std::string& response, bool is_market, FuturesOrderResponse& order);
 }; 
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <curl/curl.h>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <memory>
+
+// HTTP 요청 정보
+struct HttpRequest {
+    std::string url;                      // 쿼리 스트링을 포함한 전체 URL
+    std::string method = "GET";           // GET/POST/PUT/DELETE
+    std::string body;                     // POST/PUT 본문
+    std::shared_ptr<curl_slist> headers;  // 요청 간 공유되는 헤더 목록
+    long timeout = 30;                    // 전체 타임아웃 (초)
+    long connectTimeout = 10;             // 연결 타임아웃 (초)
+    bool http2 = false;                   // HTTP/2 다중화 사용 여부 (curl_multi 전송에만 적용, 동기 perform은 HTTP/1.1)
+
+    // 본문 청크 수신 함수: 설정하면 성공(2xx) 응답 본문을 body에 모으지 않고 도착 즉시 전달
+    // false를 반환하면 전송 중단 (CURLE_WRITE_ERROR)
+    std::function<bool(const char*, size_t)> onData;
+};
+
+// curl 전송 시각 (요청 시작부터의 누적 시간, 마이크로초)
+struct RequestTimings {
+    int64_t nameLookup = 0;               // CURLINFO_NAMELOOKUP_TIME
+    int64_t connect = 0;                  // CURLINFO_CONNECT_TIME
+    int64_t appConnect = 0;               // CURLINFO_APPCONNECT_TIME (TLS 완료, 재사용 시 0)
+    int64_t preTransfer = 0;              // CURLINFO_PRETRANSFER_TIME
+    int64_t startTransfer = 0;            // CURLINFO_STARTTRANSFER_TIME (첫 응답 바이트)
+    int64_t total = 0;                    // CURLINFO_TOTAL_TIME
+};
+
+// HTTP 응답 정보
+struct HttpResponse {
+    CURLcode curlCode = CURLE_OK;
+    long statusCode = 0;
+    std::string body;
+    bool reusedConnection = false;        // 기존 연결 재사용 여부
+    bool http2 = false;                   // HTTP/2로 응답받았는지 여부
+    RequestTimings timings;               // 단계별 전송 시각
+    std::map<std::string, std::string> headers;  // x-mbx-*, retry-after 헤더 (소문자 키)
+    std::function<bool(const char*, size_t)> onData;  // 요청의 본문 수신 함수 (configure에서 복사)
+};
+
+// 연결 풀 통계
+struct ConnectionPoolStats {
+    long requests;                        // 전체 요청 수
+    long handshakes;                      // 새 연결 수 (DNS + TCP + TLS 핸드셰이크)
+    long reusedConnections;               // 기존 연결 재사용 수
+    long http2Responses;                  // HTTP/2로 처리된 응답 수
+    long idleHandles;                     // 대기 중인 CURL 핸들 수
+};
+
+// 기본 URL별로 CURL 핸들을 재사용하는 연결 풀
+// 연결은 핸들마다 유지되고 (유휴 핸들을 다시 빌려 재사용), DNS 캐시와 SSL 세션은 모든 핸들이 공유한다
+class ConnectionPool {
+public:
+    ConnectionPool();
+    ~ConnectionPool();
+
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+    // 풀의 핸들로 동기 요청 실행
+    // 동기 전송은 다중화할 수 없으므로 request.http2와 무관하게 HTTP/1.1로 보낸다
+    HttpResponse perform(const HttpRequest& request);
+
+    // 기본 URL에 해당하는 핸들 대여/반납
+    CURL* acquire(const std::string& base_url);
+    void release(const std::string& base_url, CURL* curl);
+
+    // 핸들에 요청 옵션 설정 (response는 전송 완료까지 유효해야 함)
+    // multiplexed: curl_multi로 전송하는 핸들이면 true (이때만 request.http2를 따름)
+    void configure(CURL* curl, const HttpRequest& request, HttpResponse* response, bool multiplexed);
+
+    // 전송 완료 후 상태 코드, 연결 재사용 여부, 단계별 시각 기록
+    void recordResult(CURL* curl, HttpResponse& response);
+
+    // 핸드셰이크/재사용 통계 조회
+    ConnectionPoolStats getStats() const;
+
+    // 시스템 CA 목록 대신 신뢰할 인증서 파일 (로컬 대역 서버의 자체 서명 인증서 등, 요청 전에 설정)
+    void setCaFile(const std::string& path);
+
+    // URL에서 "scheme://host[:port]" 부분 추출
+    static std::string baseUrlOf(const std::string& url);
+
+private:
+    static const size_t MAX_IDLE_PER_HOST = 8;
+
+    CURLSH* share_;
+    std::mutex share_locks_[CURL_LOCK_DATA_LAST];
+
+    mutable std::mutex mutex_;
+    std::map<std::string, std::vector<CURL*>> idle_handles_;
+    long requests_;
+    long handshakes_;
+    long reused_;
+    long http2_responses_;
+    std::string ca_file_;                 // 비어 있으면 curl 기본 CA 목록
+
+    static void lockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
+    static void unlockShare(CURL* handle, curl_lock_data data, void* userptr);
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+// 가격/수량용 고정소수점 10진수
+// 값을 1e8배한 64비트 정수로 저장하므로 (바이낸스의 최대 소수 자릿수 = 8)
+// stepSize/tickSize 배수 판정과 올림/내림이 정수 연산으로 정확하게 처리된다.
+// 문자열 변환은 로케일/iostream을 거치지 않는다
+class Decimal {
+public:
+    static constexpr int DIGITS = 8;
+    static constexpr int64_t SCALE = 100000000;
+
+    // 부호 + 19자리 + 소수점 (종료 문자 제외)
+    static constexpr size_t MAX_LENGTH = 21;
+
+    constexpr Decimal() : raw_(0) {}
+
+    static constexpr Decimal fromRaw(int64_t raw) { return Decimal(raw); }
+    static constexpr Decimal fromInteger(int64_t value) { return Decimal(value * SCALE); }
+
+    // 가장 가까운 1e-8 단위로 반올림 (NaN/범위 초과는 0)
+    static Decimal fromDouble(double value);
+
+    // "123", "-0.00100000", "+5." 형식 (지수 표기 불가)
+    // 소수 8자리를 넘는 부분은 버리고, 형식 오류나 범위 초과 시 false
+    static bool parse(std::string_view text, Decimal& out);
+
+    constexpr int64_t raw() const { return raw_; }
+    double toDouble() const { return static_cast<double>(raw_) / SCALE; }
+
+    constexpr bool isZero() const { return raw_ == 0; }
+    constexpr bool isPositive() const { return raw_ > 0; }
+    constexpr bool isNegative() const { return raw_ < 0; }
+
+    // 끝의 0을 제거한 형식 ("0.001", "25000", "-1.5")으로 buffer에 기록
+    // buffer는 MAX_LENGTH 이상이어야 하며 기록한 길이를 반환 (종료 문자 없음)
+    size_t format(char* buffer) const;
+    std::string toString() const;
+
+    // step의 배수로 내림/올림 (step이 0 이하이면 그대로 반환)
+    Decimal floorToStep(Decimal step) const;
+    Decimal ceilToStep(Decimal step) const;
+    bool isMultipleOf(Decimal step) const;
+
+    constexpr Decimal abs() const { return Decimal(raw_ < 0 ? -raw_ : raw_); }
+
+    constexpr Decimal operator-() const { return Decimal(-raw_); }
+    constexpr Decimal operator+(Decimal other) const { return Decimal(raw_ + other.raw_); }
+    constexpr Decimal operator-(Decimal other) const { return Decimal(raw_ - other.raw_); }
+    Decimal& operator+=(Decimal other) { raw_ += other.raw_; return *this; }
+    Decimal& operator-=(Decimal other) { raw_ -= other.raw_; return *this; }
+
+    // 곱셈/나눗셈은 1e-8 미만을 0 방향으로 버림 (0으로 나누면 0)
+    Decimal operator*(Decimal other) const;
+    Decimal operator/(Decimal other) const;
+
+    // 나눗셈 결과를 1e-8 단위로 올림 (최소 주문 금액 → 최소 수량 계산용)
+    Decimal divideCeil(Decimal divisor) const;
+
+    constexpr bool operator==(Decimal other) const { return raw_ == other.raw_; }
+    constexpr bool operator!=(Decimal other) const { return raw_ != other.raw_; }
+    constexpr bool operator<(Decimal other) const { return raw_ < other.raw_; }
+    constexpr bool operator<=(Decimal other) const { return raw_ <= other.raw_; }
+    constexpr bool operator>(Decimal other) const { return raw_ > other.raw_; }
+    constexpr bool operator>=(Decimal other) const { return raw_ >= other.raw_; }
+
+private:
+    constexpr explicit Decimal(int64_t raw) : raw_(raw) {}
+
+    int64_t raw_;
+};
+
+// 화면 출력용 (format()과 같은 형식, 스트림의 정밀도 설정은 무시)
+std::ostream& operator<<(std::ostream& os, Decimal value);
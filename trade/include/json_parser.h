@@ -1,16 +1,197 @@
 #pragma once
 
+#include "json_scanner.h"
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <map>
+#include <vector>
+
+// JSON 값 종류
+enum class JSONType : uint8_t {
+    Null,
+    Bool,
+    Number,
+    String,
+    Object,
+    Array
+};
+
+class JSONDocument;
+
+// JSONDocument 안의 값 하나를 가리키는 가벼운 핸들 (복사 비용 없음)
+// 조회 결과가 없으면 valid() == false 인 빈 핸들을 반환하므로 연쇄 조회가 안전하다
+class JSONValue {
+public:
+    JSONValue() : doc_(nullptr), index_(0) {}
+
+    bool valid() const { return doc_ != nullptr; }
+    explicit operator bool() const { return valid(); }
+
+    JSONType type() const;
+    bool isNull() const { return valid() && type() == JSONType::Null; }
+    bool isObject() const { return valid() && type() == JSONType::Object; }
+    bool isArray() const { return valid() && type() == JSONType::Array; }
+    bool isString() const { return valid() && type() == JSONType::String; }
+    bool isNumber() const { return valid() && type() == JSONType::Number; }
+
+    // 원본 버퍼 위의 텍스트 (문자열은 따옴표 제외·이스케이프 미해석, 객체/배열은 괄호 포함 전체)
+    std::string_view raw() const;
+
+    // 이스케이프를 해석한 문자열 (문자열이 아니면 원본 텍스트)
+    std::string asString() const;
+
+    // 숫자 또는 숫자 문자열("0.001")을 변환, 변환할 수 없으면 fallback
+    double asDouble(double fallback = 0.0) const;
+    long long asInt(long long fallback = 0) const;
+
+    // 형식이 맞을 때만 변환 (숫자 또는 숫자 문자열, 실패 시 false)
+    bool getDouble(double& out) const;
+    bool getInt(long long& out) const;
+    bool asBool(bool fallback = false) const;
+
+    // 객체 멤버 조회 (직속 멤버만, O(필드 수))
+    JSONValue operator[](std::string_view key) const;
+
+    // 배열 요소 조회 (O(index))
+    JSONValue at(size_t index) const;
+
+    // 배열 요소 수 또는 객체 멤버 수 (O(1))
+    size_t size() const;
+
+    // 하위 트리 전체에서 문서 순서상 처음 나오는 키의 값 (중첩 객체 포함)
+    JSONValue find(std::string_view key) const;
+
+    // 배열 요소 / 객체 멤버 값 순회
+    class Iterator {
+    public:
+        JSONValue operator*() const;
+        std::string_view key() const;   // 객체 멤버의 키 (배열이면 빈 값)
+        Iterator& operator++();
+        bool operator!=(const Iterator& other) const { return index_ != other.index_; }
+
+    private:
+        friend class JSONValue;
+        Iterator(const JSONDocument* doc, uint32_t index, bool is_object)
+            : doc_(doc), index_(index), is_object_(is_object) {}
+
+        const JSONDocument* doc_;
+        uint32_t index_;
+        bool is_object_;
+    };
+
+    Iterator begin() const;
+    Iterator end() const;
+
+private:
+    friend class JSONDocument;
+    JSONValue(const JSONDocument* doc, uint32_t index) : doc_(doc), index_(index) {}
+
+    const JSONDocument* doc_;
+    uint32_t index_;
+};
+
+// 단일 패스 JSON 토크나이저
+// 원본 버퍼를 복사하지 않고 값마다 (오프셋, 길이, 하위 트리 끝) 토큰만 기록한다.
+// 조회는 토큰 배열 위에서만 이루어지므로 할당이 없다.
+// 원본 문자열은 문서를 사용하는 동안 유지되어야 한다
+class JSONDocument {
+public:
+    JSONDocument() : ok_(false), error_offset_(0) {}
+    explicit JSONDocument(std::string_view json) : ok_(false), error_offset_(0) { parse(json); }
+
+    // 파싱 (내부 버퍼를 재사용하므로 같은 객체로 여러 응답을 처리하면 할당이 줄어듦)
+    bool parse(std::string_view json);
+
+    bool ok() const { return ok_; }
+    size_t errorOffset() const { return error_offset_; }
+
+    // 최상위 값 (파싱 실패 시 빈 핸들)
+    JSONValue root() const;
+
+private:
+    friend class JSONValue;
+
+    struct Token {
+        uint32_t start;       // 값 시작 오프셋 (문자열은 여는 따옴표 다음)
+        uint32_t length;      // 값 길이 (문자열은 따옴표 제외)
+        uint32_t end;         // 이 값의 하위 트리 다음 토큰 인덱스
+        uint32_t count;       // 객체 멤버 수 / 배열 요소 수
+        JSONType type;
+        bool is_key;          // 객체 키 문자열
+        bool escaped;         // 문자열에 이스케이프 포함
+    };
+
+    bool fail(size_t offset);
+
+    std::string_view json_;
+    std::vector<Token> tokens_;
+    std::vector<uint32_t> stack_;
+    JSONScanner::StructuralIndex structurals_;   // 구조 문자 색인 (파싱 사이에 재사용)
+    bool ok_;
+    size_t error_offset_;
+};
+
+// 청크 단위로 들어오는 JSON에서 지정한 배열의 요소를 완성되는 즉시 전달하는 푸시 파서
+// 대상 배열 밖의 바이트는 보관하지 않고, 요소 하나 크기의 버퍼만 유지한다.
+// key가 비어 있으면 최상위 배열, 아니면 최상위 객체의 해당 키 배열이 대상 (중첩된 같은 이름의 키는 무시)
+class JSONArrayStream {
+public:
+    // 요소 처리 함수 (false를 반환하면 이후 입력을 중단)
+    using ElementHandler = std::function<bool(JSONValue)>;
+
+    JSONArrayStream(std::string key, ElementHandler handler);
+
+    // 청크 입력 (요소 파싱 실패나 처리 함수의 중단 요청 시 false)
+    bool feed(const char* data, size_t length);
+
+    bool finished() const { return state_ == State::Done; }
+    bool failed() const { return failed_; }
+    size_t elementCount() const { return elements_; }
+
+private:
+    enum class State { Seeking, InArray, Done };
+
+    bool emitElement();
+
+    std::string key_;
+    ElementHandler handler_;
+    State state_;
+    bool failed_;
+    size_t elements_;
+
+    int depth_;                   // 현재 중첩 깊이
+    int array_depth_;             // 대상 배열 내부의 깊이
+    bool in_string_;
+    bool escape_;                 // 직전 청크가 '\\'로 끝남
+    bool key_pending_;            // 마지막 문자열 다음에 ':'이 나옴
+    bool last_string_matches_;    // 마지막으로 끝난 문자열이 key_와 같음
+    std::string string_buffer_;   // 대상 배열 밖에서 현재 문자열 (키 비교용, 길이 제한)
+    bool capturing_;              // 요소 수집 중
+    bool scalar_element_;         // 수집 중인 요소가 객체/배열이 아님
+    std::string element_;
+    JSONDocument doc_;
+};
 
 class JSONParser {
 public:
+    // 아래 함수들은 JSONDocument 위의 호환용 래퍼 (문서 순서상 처음 나오는 키를 사용)
+    // 완전한 JSON이 아닌 조각이 전달되면 기존 문자열 검색 방식으로 처리
     static std::string extractValue(const std::string& json, const std::string& key);
     static double extractDouble(const std::string& json, const std::string& key);
     static std::string extractString(const std::string& json, const std::string& key);
     static bool extractBool(const std::string& json, const std::string& key);
-    
+
+    // 최상위 JSON 배열의 각 요소를 문자열로 분리
+    static std::vector<std::string> splitArray(const std::string& json);
+
+    // 키에 해당하는 하위 객체 / 배열 요소 추출 (없으면 빈 값)
+    static std::string extractObject(const std::string& json, const std::string& key);
+    static std::vector<std::string> extractArray(const std::string& json, const std::string& key);
+
 private:
+    static std::string legacyExtractValue(const std::string& json, const std::string& key);
     static std::string trim(const std::string& str);
     static std::string removeQuotes(const std::string& str);
-}; 
\ No newline at end of file
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// JSON 토크나이저용 벡터화 바이트 스캐너
+// 문자열 본문과 공백 구간을 16/32바이트 단위로 건너뛰고, 문서 전체의 구조 문자 색인을 64바이트 블록 단위로 만든다.
+// x86-64에서는 실행 시 CPU를 확인해 AVX2, SSE4.2, SSE2 구현 중 가장 넓은 것을 선택하고,
+// 그 외 환경에서는 스칼라 구현을 사용한다
+class JSONScanner {
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // pos부터 처음 나오는 '"', '\\', 제어 문자(< 0x20)의 위치 (없으면 n)
+    static size_t findStringSpecial(const char* data, size_t pos, size_t n);
+
+    // pos부터 처음 나오는 공백이 아닌 문자의 위치 (없으면 n)
+    static size_t skipWhitespace(const char* data, size_t pos, size_t n);
+
+    // 구조 문자 색인: 문자열 밖의 { } [ ] : , 위치, 모든 문자열의 여는/닫는 따옴표 위치,
+    // 숫자/리터럴처럼 공백·구조 문자 뒤에서 시작하는 값의 첫 바이트 위치를 문서 순서대로 기록
+    // 큰 문서는 구간 단위로 이어서 만들 수 있다 (색인이 캐시를 벗어나기 전에 소비하도록)
+    struct StructuralIndex {
+        std::vector<uint32_t> positions;   // 마지막 구간의 항목, 앞의 count개만 유효 (호출 사이에 재사용)
+        size_t count = 0;
+        size_t scanned = 0;                // 지금까지 색인한 입력 바이트 수 (다음 구간의 시작)
+        size_t stringError = npos;         // 문자열 안의 이스케이프되지 않은 첫 제어 문자 위치 (없으면 npos)
+        bool hasBackslash = false;         // 지금까지 '\\'가 있었음 (없으면 문자열마다 이스케이프를 찾을 필요 없음)
+
+        // 구간 사이에 이어지는 상태
+        uint64_t escapeCarry = 0;
+        uint64_t inStringCarry = 0;
+        uint64_t scalarCarry = 0;
+
+        // 새 문서를 색인하기 전에 호출 (positions 용량은 유지)
+        void reset() {
+            count = 0;
+            scanned = 0;
+            stringError = npos;
+            hasBackslash = false;
+            escapeCarry = 0;
+            inStringCarry = 0;
+            scalarCarry = 0;
+        }
+    };
+
+    // data[0..n) (n < 2^32) 중 index.scanned부터 최대 max_bytes를 이어서 색인하고 positions를 그 구간의 항목으로 바꾼다
+    // max_bytes는 64의 배수로 내림하며, 기본값이면 문서 끝까지 한 번에 색인
+    static void buildStructuralIndex(const char* data, size_t n, StructuralIndex& index, size_t max_bytes = npos);
+
+    // 선택된 구현 이름 ("avx2" / "sse4.2" / "sse2" / "scalar")
+    static const char* implementation();
+
+    // 이 CPU에서 사용할 수 있는 구현 이름 (넓은 것부터)
+    static std::vector<const char*> availableImplementations();
+
+    // 벤치마크/검증용 구현 강제 선택 (사용할 수 없는 이름이면 false)
+    // 다른 스레드가 스캐너를 사용하는 중에는 호출하지 말 것
+    static bool useImplementation(std::string_view name);
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "decimal.h"
+#include "json_parser.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+// 컴파일 타임 필드 기술자로 JSON 객체를 구조체에 한 번에 디코딩
+//
+// 스키마는 Type과 fields 튜플을 가진 구조체로 정의한다:
+//   struct SpotOrderSchema {
+//       using Type = OrderResponse;
+//       static constexpr auto fields = std::make_tuple(
+//           requiredField("orderId", &OrderResponse::orderId),
+//           optionalField("price", &OrderResponse::price));
+//   };
+//
+// 객체 멤버를 한 번만 순회하면서 키가 일치하는 필드를 채우고,
+// 필수 필드 누락이나 형식 불일치는 0.0으로 넘어가지 않고 오류로 보고한다
+template <typename T, typename M>
+struct JSONField {
+    std::string_view key;
+    M T::*member;
+    bool required;
+};
+
+template <typename T, typename M>
+constexpr JSONField<T, M> requiredField(std::string_view key, M T::*member) {
+    return JSONField<T, M>{key, member, true};
+}
+
+template <typename T, typename M>
+constexpr JSONField<T, M> optionalField(std::string_view key, M T::*member) {
+    return JSONField<T, M>{key, member, false};
+}
+
+namespace json_schema_detail {
+
+// 멤버 타입별 변환 (형식이 맞지 않으면 false)
+inline bool decodeValue(JSONValue value, std::string& out) {
+    // 주문 ID처럼 숫자로 오는 식별자도 문자열 멤버로 받음
+    if (!value.isString() && !value.isNumber()) return false;
+    out = value.asString();
+    return true;
+}
+
+inline bool decodeValue(JSONValue value, double& out) {
+    return value.getDouble(out);
+}
+
+inline bool decodeValue(JSONValue value, int& out) {
+    long long wide;
+    if (!value.getInt(wide)) return false;
+    out = static_cast<int>(wide);
+    return true;
+}
+
+inline bool decodeValue(JSONValue value, long long& out) {
+    return value.getInt(out);
+}
+
+// 가격/수량은 문자열("0.00100000") 또는 숫자 토큰을 그대로 고정소수점으로 변환
+inline bool decodeValue(JSONValue value, Decimal& out) {
+    if (!value.isString() && !value.isNumber()) return false;
+    return Decimal::parse(value.raw(), out);
+}
+
+inline bool decodeValue(JSONValue value, bool& out) {
+    if (value.type() != JSONType::Bool) return false;
+    out = value.asBool();
+    return true;
+}
+
+inline void appendError(std::string& error, const char* kind, std::string_view key) {
+    if (!error.empty()) error += ", ";
+    error += kind;
+    error += key;
+}
+
+// 키가 일치하는 필드 하나를 디코딩 (일치하는 필드가 없으면 무시)
+template <size_t I, typename Fields, typename T>
+bool decodeIfMatch(const Fields& fields, std::string_view key, JSONValue value, T& out,
+                   uint64_t& found, std::string& error) {
+    const auto& field = std::get<I>(fields);
+    if (field.key != key) return false;
+    found |= uint64_t(1) << I;
+    if (!decodeValue(value, out.*(field.member))) {
+        appendError(error, "형식 오류: ", key);
+    }
+    return true;
+}
+
+template <typename Fields, typename T, size_t... I>
+void decodeMember(const Fields& fields, std::string_view key, JSONValue value, T& out,
+                  uint64_t& found, std::string& error, std::index_sequence<I...>) {
+    (decodeIfMatch<I>(fields, key, value, out, found, error) || ...);
+}
+
+template <typename Fields, size_t... I>
+void checkRequired(const Fields& fields, uint64_t found, std::string& error, std::index_sequence<I...>) {
+    ((std::get<I>(fields).required && !(found & (uint64_t(1) << I))
+          ? appendError(error, "필수 필드 누락: ", std::get<I>(fields).key)
+          : void()),
+     ...);
+}
+
+}  // namespace json_schema_detail
+
+// object를 Schema::Type에 디코딩
+// 응답에 없는 선택 필드는 기존 값을 유지하므로 호출 측에서 미리 초기화한다.
+// 실패 시 error에 "필수 필드 누락: orderId, 형식 오류: price" 형식으로 기록
+template <typename Schema>
+bool decodeJSON(JSONValue object, typename Schema::Type& out, std::string& error) {
+    using namespace json_schema_detail;
+    constexpr size_t COUNT = std::tuple_size<std::decay_t<decltype(Schema::fields)>>::value;
+    static_assert(COUNT <= 64, "스키마 필드는 64개까지 지원");
+    constexpr auto indices = std::make_index_sequence<COUNT>();
+
+    error.clear();
+    if (!object.isObject()) {
+        error = "JSON 객체가 아닙니다";
+        return false;
+    }
+
+    uint64_t found = 0;
+    for (auto it = object.begin(); it != object.end(); ++it) {
+        decodeMember(Schema::fields, it.key(), *it, out, found, error, indices);
+    }
+    checkRequired(Schema::fields, found, error, indices);
+    return error.empty();
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+struct RequestTimings;
+
+// 요청 처리 단계 (CURLINFO 시간 + 로컬 서명/파싱 시간)
+enum class LatencyStage : uint8_t {
+    Sign,        // 쿼리 생성 + 서명
+    Dns,         // DNS 조회 (새 연결만)
+    Connect,     // TCP 연결 (새 연결만)
+    Tls,         // TLS 핸드셰이크 (새 연결만)
+    Server,      // 요청 전송 완료 ~ 첫 응답 바이트 (서버 처리 + 왕복)
+    Transfer,    // 첫 응답 바이트 ~ 수신 완료
+    Total,       // curl 전체 시간
+    Parse,       // 응답 파싱
+    Count
+};
+
+const char* toString(LatencyStage stage);
+
+// HDR 방식 지연 시간 히스토그램 (마이크로초, 유효숫자 약 2자리)
+// 값의 크기(2의 거듭제곱)마다 64개 구간을 두므로 1us부터 수천 초까지 상대 오차 1.6% 이내로 고정 메모리에 기록한다
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void record(int64_t micros);
+
+    uint64_t count() const { return count_; }
+    int64_t max() const { return max_; }
+    double mean() const;
+
+    // 백분위 값 (해당 구간의 상한, 기록이 없으면 0)
+    int64_t percentile(double percent) const;
+
+private:
+    static const int SUB_BUCKET_BITS = 7;                       // 128 = 크기별 구간 수 × 2
+    static const int SUB_BUCKET_HALF = 1 << (SUB_BUCKET_BITS - 1);
+    static const int MAX_MAGNITUDE = 26;                        // 기록 상한 2^33us (약 2.4시간)
+    static const int BUCKET_COUNT = (MAX_MAGNITUDE + 2) * SUB_BUCKET_HALF;
+
+    static int indexOf(int64_t micros);
+    static int64_t highestEquivalent(int index);
+
+    std::array<uint32_t, BUCKET_COUNT> counts_;
+    uint64_t count_;
+    int64_t max_;
+    double sum_;
+};
+
+// 엔드포인트별 단계 지연 시간 집계 (프로세스 전역)
+// SIGUSR1 또는 메뉴에서 dump로 출력한다
+class LatencyMonitor {
+public:
+    static LatencyMonitor& instance();
+
+    LatencyMonitor(const LatencyMonitor&) = delete;
+    LatencyMonitor& operator=(const LatencyMonitor&) = delete;
+
+    void record(std::string_view endpoint, LatencyStage stage, int64_t micros);
+
+    // curl 누적 시간을 단계별 시간으로 나누어 기록 (연결을 재사용했으면 DNS/연결/TLS는 기록하지 않음)
+    void recordTransfer(std::string_view endpoint, const RequestTimings& timings, bool reused_connection);
+
+    // 엔드포인트별 단계 표 (건수, 평균, p50/p90/p99/최대, 단위 ms)
+    void dump(std::ostream& out) const;
+
+    void reset();
+
+private:
+    LatencyMonitor() = default;
+
+    using StageHistograms = std::array<LatencyHistogram, static_cast<size_t>(LatencyStage::Count)>;
+
+    mutable std::mutex mutex_;
+    std::map<std::string, StageHistograms, std::less<>> endpoints_;
+
+    // 엔드포인트의 히스토그램 (처음 보면 생성, mutex_를 잡은 상태에서 호출)
+    StageHistograms& stagesOf(std::string_view endpoint);
+};
+
+// 범위를 벗어날 때 경과 시간을 기록하는 측정기
+class LatencyTimer {
+public:
+    // endpoint는 측정이 끝날 때까지 유효해야 함 (보통 문자열 상수)
+    LatencyTimer(const char* endpoint, LatencyStage stage);
+    ~LatencyTimer();
+
+    LatencyTimer(const LatencyTimer&) = delete;
+    LatencyTimer& operator=(const LatencyTimer&) = delete;
+
+private:
+    const char* endpoint_;
+    LatencyStage stage_;
+    int64_t start_;
+};
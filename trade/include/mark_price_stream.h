@@ -0,0 +1,52 @@
+#pragma once
+
+#include "position_store.h"
+#include "websocket_client.h"
+#include "json_parser.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 선물 전체 심볼 마크 가격 스트림 (!markPrice@arr@1s)
+// 1초마다 모든 심볼의 마크 가격 배열을 받아 포지션 저장소에 한 묶음으로 반영한다.
+// 구독 심볼 목록이 없으므로 어떤 심볼에 포지션이 생겨도 다음 틱부터 바로 평가된다
+class MarkPriceStream {
+public:
+    MarkPriceStream(const std::string& ws_base_url, std::shared_ptr<PositionStore> store);
+    ~MarkPriceStream();
+
+    MarkPriceStream(const MarkPriceStream&) = delete;
+    MarkPriceStream& operator=(const MarkPriceStream&) = delete;
+
+    void start();
+    void stop();
+
+    bool isLive() const;
+    long messageCount() const { return messages_; }
+    std::string lastError() const;
+
+private:
+    void run();
+    void handleMessage(const std::string& message);
+    void waitBackoff(int& backoff_ms);
+    void setError(const std::string& error);
+
+    std::string url_;
+    std::shared_ptr<PositionStore> store_;
+
+    WebSocketClient client_;
+    JSONDocument doc_;              // 수신 스레드 전용 (메시지마다 토큰 버퍼 재사용)
+    std::vector<SymbolId> symbols_; // 수신 스레드 전용 (묶음마다 재사용)
+    std::vector<double> marks_;
+
+    std::thread worker_;
+    std::atomic<bool> running_;
+    std::atomic<bool> live_;
+    std::atomic<long> messages_;
+
+    mutable std::mutex error_mutex_;
+    std::string error_;
+};
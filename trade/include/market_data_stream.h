@@ -0,0 +1,113 @@
+#pragma once
+
+#include "websocket_client.h"
+#include "json_parser.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 시장 구분 (스트림 주소와 구독 스트림 종류가 다름)
+enum class MarketType {
+    Spot,
+    Futures
+};
+
+// 심볼별 최신 시세 스냅샷
+struct PriceSnapshot {
+    std::string symbol;
+    double bidPrice;              // 최우선 매수호가 (bookTicker)
+    double askPrice;              // 최우선 매도호가 (bookTicker)
+    double lastPrice;             // 최근 체결가 (aggTrade)
+    double markPrice;             // 마크 가격 (선물 markPrice)
+    long long eventTimeMs;        // 마지막 이벤트 수신 시각 (로컬 ms)
+    bool valid;                   // 한 번이라도 갱신되었는지 여부
+};
+
+// 심볼별 최신 시세 테이블
+// 심볼 목록은 생성 시 고정되며 기록자는 스트림 스레드 하나뿐이다.
+// 각 슬롯은 시퀀스 락으로 보호되어 읽는 쪽은 잠금 없이 일관된 값을 얻는다.
+class PriceTable {
+public:
+    static const size_t CAPACITY = 1024;
+
+    explicit PriceTable(const std::vector<std::string>& symbols);
+
+    PriceTable(const PriceTable&) = delete;
+    PriceTable& operator=(const PriceTable&) = delete;
+
+    // 값이 0 이하인 필드는 갱신하지 않음 (스트림마다 일부 필드만 전달됨)
+    void update(const std::string& symbol, double bid, double ask, double last, double mark);
+
+    // 스냅샷 읽기 (심볼이 없거나 아직 갱신 전이면 valid == false)
+    PriceSnapshot read(const std::string& symbol) const;
+
+    const std::vector<std::string>& symbols() const { return symbols_; }
+
+private:
+    struct Slot {
+        char symbol[24] = {0};
+        std::atomic<uint64_t> sequence{0};    // 홀수면 기록 중
+        std::atomic<double> bid{0.0};
+        std::atomic<double> ask{0.0};
+        std::atomic<double> last{0.0};
+        std::atomic<double> mark{0.0};
+        std::atomic<long long> eventTimeMs{0};
+    };
+
+    const Slot* find(const std::string& symbol) const;
+    static size_t hashOf(const std::string& symbol);
+
+    std::unique_ptr<Slot[]> slots_;
+    std::vector<std::string> symbols_;
+};
+
+// 바이낸스 결합 스트림(combined stream) 구독 클라이언트
+// 현물: <symbol>@bookTicker, <symbol>@aggTrade
+// 선물: 위 스트림 + <symbol>@markPrice@1s
+// 연결이 끊기면 지수 백오프로 재연결하며, 연결이 살아 있는 동안만 isLive()가 참이다
+class MarketDataStream {
+public:
+    MarketDataStream(MarketType type, const std::string& base_url, const std::vector<std::string>& symbols);
+    ~MarketDataStream();
+
+    MarketDataStream(const MarketDataStream&) = delete;
+    MarketDataStream& operator=(const MarketDataStream&) = delete;
+
+    void start();
+    void stop();
+
+    // 연결되어 시세를 수신 중인지 여부
+    bool isLive() const;
+
+    // 구독 심볼의 최신 시세 (스트림이 끊긴 경우에도 마지막 값을 반환)
+    PriceSnapshot getPrice(const std::string& symbol) const;
+
+    const std::vector<std::string>& symbols() const { return table_.symbols(); }
+    MarketType type() const { return type_; }
+
+    long reconnectCount() const { return reconnects_; }
+    long messageCount() const { return messages_; }
+    std::string lastError() const { return client_.lastError(); }
+
+    // 결합 스트림 URL 생성
+    static std::string buildStreamUrl(MarketType type, const std::string& base_url,
+                                      const std::vector<std::string>& symbols);
+
+private:
+    void run();
+    void handleMessage(const std::string& message);
+
+    MarketType type_;
+    std::string url_;
+    PriceTable table_;
+    WebSocketClient client_;
+    JSONDocument doc_;              // 수신 스레드 전용 (메시지마다 토큰 버퍼 재사용)
+
+    std::thread worker_;
+    std::atomic<bool> running_;
+    std::atomic<bool> live_;
+    std::atomic<long> reconnects_;
+    std::atomic<long> messages_;
+};
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "decimal.h"
+#include "json_parser.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+enum class MarketType;
+
+enum class BookSide : uint8_t { Bid, Ask };
+
+// 호가 한 단계 (가격, 잔량)
+struct PriceLevel {
+    Decimal price;
+    Decimal quantity;
+};
+
+// REST /depth 스냅샷
+struct DepthSnapshot {
+    std::string symbol;
+    long long lastUpdateId;
+    std::vector<PriceLevel> bids;       // 가격 내림차순
+    std::vector<PriceLevel> asks;       // 가격 오름차순
+    bool success;
+    std::string error;
+};
+
+// @depth 차분 이벤트 (수신 스레드가 객체를 재사용하므로 clear 후 채움)
+struct DepthUpdate {
+    long long firstUpdateId = 0;        // U
+    long long finalUpdateId = 0;        // u
+    long long previousUpdateId = -1;    // pu (선물만, 현물은 -1)
+    std::vector<PriceLevel> bids;       // 잔량 0이면 해당 가격 삭제
+    std::vector<PriceLevel> asks;
+
+    void clear();
+};
+
+// 최우선 호가 (잔량이 0이면 해당 방향 호가 없음)
+struct BookTop {
+    PriceLevel bid;
+    PriceLevel ask;
+    long long updateId;
+    bool synced;
+};
+
+// 심볼 하나의 로컬 호가창
+// 각 방향을 가격순으로 정렬한 연속 배열로 두되 최우선 호가를 배열 끝에 둔다
+// (매수는 오름차순, 매도는 내림차순). 갱신은 대부분 최우선 호가 근처에서 일어나므로
+// 삽입/삭제 시 옮기는 원소가 적고, 가격 조회는 이진 탐색이다.
+// 기록자는 스트림 스레드 하나이며, 최우선 호가는 시퀀스 락으로 잠금 없이 읽는다
+class OrderBook {
+public:
+    enum class ApplyResult {
+        Applied,        // 반영됨
+        Stale,          // 스냅샷보다 오래된 이벤트 (무시)
+        Gap,            // update id가 이어지지 않음 (스냅샷부터 다시 동기화 필요)
+        NotSynced       // 아직 스냅샷이 없음
+    };
+
+    OrderBook(MarketType type, const std::string& symbol);
+
+    OrderBook(const OrderBook&) = delete;
+    OrderBook& operator=(const OrderBook&) = delete;
+
+    // 스냅샷으로 전체 교체 (이후 첫 이벤트는 스냅샷 경계를 걸쳐야 함)
+    void load(const DepthSnapshot& snapshot);
+
+    // 동기화 해제 (다음 스냅샷까지 이벤트를 받지 않음)
+    void invalidate();
+
+    // update id 순서를 검사한 뒤 차분 반영
+    // 현물: 첫 이벤트는 U <= lastUpdateId+1 <= u, 이후 U == 직전 u+1
+    // 선물: 첫 이벤트는 U <= lastUpdateId <= u, 이후 pu == 직전 u
+    ApplyResult apply(const DepthUpdate& update);
+
+    const std::string& symbol() const { return symbol_; }
+    bool isSynced() const { return synced_.load(std::memory_order_acquire); }
+
+    // 최우선 호가 (잠금 없음)
+    BookTop top() const;
+
+    // 가격의 잔량 (없으면 0)
+    Decimal quantityAt(BookSide side, Decimal price) const;
+
+    // 최우선 호가부터 levels개 (매수는 가격 내림차순, 매도는 오름차순)
+    std::vector<PriceLevel> depth(BookSide side, size_t levels) const;
+
+    // 최우선 호가부터 levels개 단계의 잔량 합
+    Decimal cumulativeQuantity(BookSide side, size_t levels) const;
+
+    size_t levelCount(BookSide side) const;
+
+private:
+    static void applyLevel(std::vector<PriceLevel>& levels, BookSide side, const PriceLevel& level);
+    static const PriceLevel* findLevel(const std::vector<PriceLevel>& levels, BookSide side, Decimal price);
+    void publishTop();
+
+    MarketType type_;
+    std::string symbol_;
+
+    mutable std::mutex mutex_;          // 호가 배열 보호 (기록자와 깊이 조회 사이)
+    std::vector<PriceLevel> bids_;      // 가격 오름차순 (최우선 매수호가가 끝)
+    std::vector<PriceLevel> asks_;      // 가격 내림차순 (최우선 매도호가가 끝)
+    long long last_update_id_;
+    bool awaiting_first_;               // 스냅샷 이후 첫 이벤트 대기 중
+
+    // 최우선 호가 (시퀀스 락, 홀수면 기록 중)
+    std::atomic<uint64_t> top_sequence_;
+    std::atomic<int64_t> bid_price_;
+    std::atomic<int64_t> bid_quantity_;
+    std::atomic<int64_t> ask_price_;
+    std::atomic<int64_t> ask_quantity_;
+    std::atomic<long long> top_update_id_;
+    std::atomic<bool> synced_;
+};
+
+// [["가격","수량"],...] 배열을 levels 뒤에 추가 (형식 오류면 false)
+bool parseDepthLevels(JSONValue array, std::vector<PriceLevel>& levels);
+
+// 응답 본문 파싱 ({"lastUpdateId":...,"bids":[["가격","수량"],...],"asks":[...]})
+bool parseDepthSnapshot(const std::string& response, DepthSnapshot& snapshot);
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "binance_api.h"
+#include "order_book.h"
+#include "websocket_client.h"
+#include "json_parser.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// 로컬 호가창 동기화 스트림 (<symbol>@depth@100ms 결합 스트림 + REST /depth 스냅샷)
+// 연결 후 이벤트를 버퍼에 모으다가 스냅샷을 받아 update id가 이어지는 이벤트부터 반영하고,
+// 중간에 id가 끊기면 해당 심볼만 스냅샷부터 다시 동기화한다
+// 스냅샷 REST 요청은 별도 스레드가 보내므로 수신 스레드는 그동안에도 모든 심볼의 이벤트를 계속 읽는다
+class OrderBookStream {
+public:
+    // rest: 스트림을 사용하지 않는 REST 전용 API 복사본 (스냅샷 요청에 사용)
+    OrderBookStream(MarketType type, const BinanceAPI& rest, const std::string& ws_base_url,
+                    const std::vector<std::string>& symbols);
+    ~OrderBookStream();
+
+    OrderBookStream(const OrderBookStream&) = delete;
+    OrderBookStream& operator=(const OrderBookStream&) = delete;
+
+    void start();
+    void stop();
+
+    bool isLive() const;
+
+    // 구독 심볼의 호가창 (구독하지 않은 심볼이면 nullptr)
+    std::shared_ptr<const OrderBook> book(const std::string& symbol) const;
+
+    const std::vector<std::string>& symbols() const { return symbols_; }
+    MarketType type() const { return type_; }
+
+    long resyncCount() const { return resyncs_; }
+    long messageCount() const { return messages_; }
+    std::string lastError() const;
+
+private:
+    static constexpr int SNAPSHOT_LIMIT = 1000;
+    static constexpr size_t MAX_PENDING = 2000;         // 스냅샷 대기 중 보관할 최대 이벤트 수
+    static constexpr int SNAPSHOT_RETRY_MS = 1000;      // 같은 심볼의 스냅샷 재요청 최소 간격
+
+    struct Entry {
+        std::shared_ptr<OrderBook> book;
+        std::vector<DepthUpdate> pending;            // 원소를 재사용하므로 pending_count까지만 유효
+        size_t pending_count = 0;
+        std::chrono::steady_clock::time_point last_snapshot;
+        bool snapshot_requested = false;             // 스냅샷 요청 후 아직 반영하지 않음 (수신 스레드 전용)
+    };
+
+    void run();
+    void runSnapshots();
+    void handleMessage(const std::string& message);
+    void buffer(Entry& entry);
+    void requestSnapshot(size_t entry_index);
+    void applySnapshots();
+    void synchronize(Entry& entry, const DepthSnapshot& snapshot);
+    void waitBackoff(int& backoff_ms);
+    void setError(const std::string& error);
+
+    MarketType type_;
+    BinanceAPI rest_;
+    std::string url_;
+    std::vector<std::string> symbols_;
+    std::vector<Entry> entries_;
+    std::map<std::string, size_t, std::less<>> index_;   // 소문자 심볼 → entries_ 색인
+
+    WebSocketClient client_;
+    JSONDocument doc_;              // 수신 스레드 전용 (메시지마다 토큰 버퍼 재사용)
+    DepthUpdate update_;            // 수신 스레드 전용 (레벨 배열 재사용)
+
+    std::thread worker_;
+    std::thread snapshot_worker_;   // REST 스냅샷 요청 전용
+    std::atomic<bool> running_;
+    std::atomic<bool> live_;
+    std::atomic<long> resyncs_;
+    std::atomic<long> messages_;
+
+    // 수신 스레드 → 스냅샷 스레드 요청, 스냅샷 스레드 → 수신 스레드 결과 (반영은 수신 스레드에서만)
+    std::mutex snapshot_mutex_;
+    std::condition_variable snapshot_cv_;
+    std::deque<size_t> snapshot_requests_;                          // entries_ 색인
+    std::vector<std::pair<size_t, DepthSnapshot>> snapshot_results_;
+    std::atomic<bool> snapshot_ready_;
+
+    mutable std::mutex error_mutex_;
+    std::string error_;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "binance_api.h"
+#include "decimal.h"
+#include "trade_types.h"
+#include <cstdint>
+
+// 주문 필터 검사 결과 (None이면 통과)
+enum class FilterError : uint8_t {
+    None,
+    SymbolNotTrading,     // 거래 중이 아닌 심볼
+    InvalidPrice,         // 지정가 주문의 가격이 0 이하
+    PriceTooLow,          // PRICE_FILTER minPrice 미만
+    PriceTooHigh,         // PRICE_FILTER maxPrice 초과
+    PriceBelowBand,       // PERCENT_PRICE 하한 미만
+    PriceAboveBand,       // PERCENT_PRICE 상한 초과
+    QuantityTooLow,       // LOT_SIZE/MARKET_LOT_SIZE minQty 미만
+    QuantityTooHigh,      // LOT_SIZE/MARKET_LOT_SIZE maxQty 초과
+    NotionalTooLow,       // MIN_NOTIONAL/NOTIONAL 최소 금액 미만
+    NotionalTooHigh,      // NOTIONAL 최대 금액 초과
+    TooManyOrders         // MAX_NUM_ORDERS 도달
+};
+
+const char* filterErrorMessage(FilterError error);
+
+// 가격을 지정하는 주문 유형인지 (나머지는 시장가로 체결)
+bool orderTypeHasPrice(OrderType type);
+
+struct OrderFilterRequest {
+    OrderSide side = OrderSide::Buy;
+    OrderType type = OrderType::Market;
+    Decimal quantity;
+    Decimal price;                // 지정가 주문 가격 (시장가는 무시)
+    Decimal referencePrice;       // 현재 시세 (PERCENT_PRICE, 시장가 주문 금액 기준, 0이면 해당 검사 생략)
+    int openOrders = -1;          // 심볼의 현재 미체결 주문 수 (음수면 MAX_NUM_ORDERS 검사 생략)
+};
+
+struct OrderFilterResult {
+    FilterError error;
+    Decimal quantity;             // 수량 단위로 내림한 수량
+    Decimal price;                // 가격 단위로 맞춘 가격 (매수는 내림, 매도는 올림)
+    Decimal minQuantity;          // 이 가격에서 수량/금액 필터를 모두 통과하는 최소 수량 (기준 가격이 없으면 수량 필터만 반영)
+};
+
+// 거래소 필터(PRICE_FILTER, LOT_SIZE, MARKET_LOT_SIZE, MIN_NOTIONAL/NOTIONAL,
+// PERCENT_PRICE, MAX_NUM_ORDERS)를 메모리의 심볼 정보만으로 적용한다.
+// 가격/수량을 단위에 맞춘 뒤 범위를 검사하며, 네트워크 요청이나 메모리 할당을 하지 않는다.
+// 단위 필터가 없는 심볼은 심볼의 가격/수량 정밀도를 단위로 사용한다
+OrderFilterResult applyOrderFilters(const SymbolInfo& info, const OrderFilterRequest& order);
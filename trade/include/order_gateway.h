@@ -0,0 +1,110 @@
+#pragma once
+
+#include "binance_api.h"
+#include "spsc_queue.h"
+#include "trade_types.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <string_view>
+#include <thread>
+
+// 게이트웨이로 보내는 주문 의도 (문자열 없는 고정 크기 레코드, 링 칸에 그대로 복사됨)
+struct OrderIntent {
+    enum class Action : uint8_t { Place, Cancel };
+
+    uint64_t requestId;           // 호출자가 정하는 번호 (응답에 그대로 돌아옴)
+    Action action;
+    MarketType market;
+    SymbolId symbol;              // SymbolTable ID
+    OrderSide side;
+    OrderType type;
+    TimeInForce timeInForce;      // None이면 GTC (지정가 주문에만 사용)
+    PositionSide positionSide;    // 선물만
+    bool reduceOnly;              // 선물만
+    Decimal quantity;
+    Decimal price;                // 지정가 주문에만 사용
+    int64_t orderId;              // 취소할 주문 번호
+    char clientOrderId[40];       // NUL 종료, 비어 있으면 거래소가 생성
+    int64_t submittedUs;          // 제출 시각 (submit에서 기록)
+};
+
+// 게이트웨이 처리 결과
+struct OrderReply {
+    uint64_t requestId;
+    OrderIntent::Action action;
+    bool success;
+    int64_t orderId;
+    OrderStatus status;
+    double price;
+    double quantity;
+    int64_t queueUs;              // 제출부터 게이트웨이가 꺼낼 때까지
+    int64_t totalUs;              // 제출부터 응답 해석까지
+    char clientOrderId[40];
+    char error[160];              // NUL 종료 (길면 잘림)
+};
+
+static_assert(std::is_trivially_copyable<OrderIntent>::value, "OrderIntent는 POD여야 함");
+static_assert(std::is_trivially_copyable<OrderReply>::value, "OrderReply는 POD여야 함");
+
+// 빈 의도 (action=Place, 나머지는 0/Unknown)
+OrderIntent makeOrderIntent(MarketType market, std::string_view symbol, OrderSide side, OrderType type,
+                            Decimal quantity, Decimal price = Decimal());
+
+struct OrderGatewayStats {
+    uint64_t submitted;           // 링에 들어간 의도 수
+    uint64_t rejected;            // 링이 가득 차 거절된 수
+    uint64_t completed;           // 처리가 끝난 수
+    size_t pendingIntents;        // 아직 꺼내지 않은 의도 수
+    size_t pendingReplies;        // 아직 가져가지 않은 응답 수
+};
+
+// 주문 게이트웨이 스레드
+// 주문용 연결(WebSocket 주문 세션 또는 REST 연결)은 게이트웨이 스레드만 사용하고,
+// 전략/신호 스레드는 미리 할당된 링에 의도를 복사해 넣기만 하므로 curl이나 잠금에서 기다리지 않는다.
+// 결과는 응답 링으로 돌아오며, 응답 링이 가득 차면 게이트웨이 내부에 보관했다가 자리가 나면 넣는다
+class OrderGateway {
+public:
+    // api: 게이트웨이 전용 복사본 (주문 세션을 공유하지 않아야 함)
+    OrderGateway(const BinanceAPI& api, size_t capacity);
+    ~OrderGateway();
+
+    OrderGateway(const OrderGateway&) = delete;
+    OrderGateway& operator=(const OrderGateway&) = delete;
+
+    void start();
+    void stop();
+    bool isRunning() const { return running_; }
+
+    // 단일 생산자 링에 제출 (한 스레드에서만 호출, 가득 차면 false)
+    bool submit(const OrderIntent& intent);
+
+    // 다중 생산자 링에 제출 (여러 스레드에서 호출 가능, 가득 차면 false)
+    bool submitShared(const OrderIntent& intent);
+
+    // 처리 결과 가져오기 (한 스레드에서만 호출, 없으면 false)
+    bool poll(OrderReply& reply);
+
+    OrderGatewayStats stats() const;
+
+private:
+    static constexpr int SPIN_ITERATIONS = 2000;   // 잠들기 전 바쁜 대기 횟수
+    static constexpr int IDLE_SLEEP_US = 50;
+
+    void run();
+    void execute(const OrderIntent& intent, OrderReply& reply);
+    void deliver(const OrderReply& reply);
+    void flushOverflow();
+
+    BinanceAPI api_;
+    SpscQueue<OrderIntent> intents_;
+    MpscQueue<OrderIntent> shared_intents_;
+    SpscQueue<OrderReply> replies_;
+    std::deque<OrderReply> overflow_;    // 게이트웨이 스레드 전용
+
+    std::thread worker_;
+    std::atomic<bool> running_;
+    std::atomic<uint64_t> submitted_;
+    std::atomic<uint64_t> rejected_;
+    std::atomic<uint64_t> completed_;
+};
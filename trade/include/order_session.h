@@ -0,0 +1,67 @@
+#pragma once
+
+#include "websocket_client.h"
+#include <atomic>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// 바이낸스 WebSocket API 주문 세션 (order.place / order.cancel / order.status)
+// 인증된 연결 하나를 계속 유지하며 요청 id로 응답을 짝지으므로
+// 주문마다 HTTP 연결/핸드셰이크 비용 없이 네트워크 왕복 시간만 소요된다
+class OrderSession {
+public:
+    // 서명 함수 (정렬된 파라미터 문자열 → HMAC-SHA256 hex)
+    using Signer = std::function<std::string(const std::string&)>;
+
+    OrderSession(const std::string& url, const std::string& api_key, Signer signer);
+    ~OrderSession();
+
+    OrderSession(const OrderSession&) = delete;
+    OrderSession& operator=(const OrderSession&) = delete;
+
+    // 연결되어 있지 않으면 연결 (이미 연결되어 있으면 즉시 true)
+    bool connect();
+    void close();
+    bool isConnected() const;
+
+    // 요청 전송 후 응답 대기
+    // 성공: result 객체, 거래소 오류: {"code":..,"msg":..}, 전송 실패: {"error":"..."}
+    std::string call(const std::string& method, const std::map<std::string, std::string>& params,
+                     bool is_signed, int timeout_ms = 10000);
+
+    // 왕복 시간 통계 (ms)
+    double lastRoundTripMs() const;
+    double averageRoundTripMs() const;
+    long requestCount() const;
+
+private:
+    void run();
+    void failPending(const std::string& error);
+    std::string buildRequest(const std::string& id, const std::string& method,
+                             std::map<std::string, std::string> params, bool is_signed);
+    static std::string escapeJson(const std::string& value);
+    static bool isIntegerParam(const std::string& key);   // 숫자로 보내는 키 (orderId, recvWindow, timestamp)
+    static long long timestampMs();
+
+    std::string url_;
+    std::string api_key_;
+    Signer signer_;
+
+    WebSocketClient client_;
+    std::thread reader_;
+    std::atomic<bool> stopping_;
+    std::mutex connect_mutex_;
+
+    std::mutex pending_mutex_;
+    std::map<std::string, std::promise<std::string>> pending_;
+    std::atomic<long> next_id_;
+
+    mutable std::mutex stats_mutex_;
+    long requests_;
+    double last_rtt_ms_;
+    double total_rtt_ms_;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "binance_api.h"
+#include "trade_types.h"
+#include <mutex>
+#include <vector>
+
+// 포지션 전체 합계 (마크 가격 틱마다 다시 계산됨)
+struct PositionTotals {
+    double unrealizedPnl;            // 미실현 손익 합
+    double notional;                 // 마크 가격 기준 포지션 금액 합
+    double initialMargin;            // 진입 금액 / 레버리지 합
+    double roe;                      // 증거금 대비 미실현 손익 (%)
+    double minLiquidationDistance;   // 가장 가까운 증거금 소진 가격까지 거리 (%, 포지션이 없으면 0)
+    size_t positions;
+    long long markUpdates;           // 반영한 마크 가격 묶음 수
+};
+
+// 선물 포지션 저장소 (열 단위 배열)
+// 수량/진입가/마크 가격/레버리지를 필드별 연속 배열로 두고, 마크 가격이 들어올 때마다
+// 모든 포지션의 미실현 손익, 수익률, ROE, 청산 거리를 SIMD 커널로 한 번에 다시 계산한다.
+// 청산 거리는 유지증거금을 빼지 않은 증거금 소진 가격 기준이며 (증거금 + 손익) / 마크 금액으로 구한다.
+// x86-64에서는 실행 시 CPU를 확인해 AVX 또는 SSE2 커널을, 그 외 환경에서는 스칼라 커널을 사용한다
+class PositionStore {
+public:
+    PositionStore();
+
+    PositionStore(const PositionStore&) = delete;
+    PositionStore& operator=(const PositionStore&) = delete;
+
+    // 전체 교체 (REST 스냅샷, 수량 0인 레코드는 건너뜀)
+    void load(const std::vector<PositionRecord>& positions);
+
+    // 포지션 하나 반영 (수량 0이면 제거, 마크 가격이 없으면 최근 마크 가격 또는 손익에서 역산)
+    void apply(const PositionRecord& position);
+
+    void applyLeverage(SymbolId symbol, int leverage);
+
+    // 마크 가격 묶음 반영 후 전체 재계산 (포지션이 없는 심볼은 최근 값만 기록)
+    void applyMarks(const SymbolId* symbols, const double* marks, size_t count);
+
+    std::vector<FuturesPosition> positions() const;
+    bool find(SymbolId symbol, FuturesPosition& position) const;
+    std::vector<SymbolId> symbols() const;
+    PositionTotals totals() const;
+
+    // 선택된 커널 이름 ("avx" / "sse2" / "scalar")
+    static const char* kernelName();
+
+private:
+    size_t slotOf(SymbolId symbol, PositionSide side) const;   // 없으면 size()
+    void removeSlot(size_t slot);
+    void recompute();
+    FuturesPosition toFuturesPosition(size_t slot) const;
+
+    mutable std::mutex mutex_;
+
+    // 입력 열
+    std::vector<SymbolId> symbol_;
+    std::vector<PositionSide> side_;
+    std::vector<double> quantity_;          // 양수: 롱, 음수: 숏
+    std::vector<double> entry_;
+    std::vector<double> mark_;
+    std::vector<double> leverage_;          // 1 이상
+
+    // 커널 출력 열
+    std::vector<double> pnl_;
+    std::vector<double> percentage_;        // 진입 금액 대비 손익 (%)
+    std::vector<double> roe_;               // 증거금 대비 손익 (%)
+    std::vector<double> distance_;          // 증거금 소진 가격까지 거리 (%)
+
+    std::vector<double> latest_mark_;       // 심볼 ID별 최근 마크 가격 (0: 모름)
+    PositionTotals totals_;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "connection_pool.h"
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+
+// 요청 우선순위 (값이 작을수록 먼저 처리)
+enum class RequestPriority {
+    Order = 0,        // 주문 생성/취소
+    Account = 1,      // 서명이 필요한 계정 조회
+    Market = 2        // 공개 시세/정보 조회
+};
+
+// 요청 가중치 예산 상태
+struct RateLimitStats {
+    long weightLimit;             // 1분당 가중치 한도
+    long usedWeight;              // 현재 1분 구간 사용 가중치
+    long remainingWeight;         // 남은 가중치
+    long orderLimit;              // 10초당 주문 한도
+    long orderCount;              // 현재 10초 구간 주문 수
+    long queueDepth;              // 예산을 기다리는 요청 수
+    long waitedRequests;          // 대기했던 요청 수
+    double lastWaitMs;            // 마지막 대기 시간 (ms)
+    double totalWaitMs;           // 누적 대기 시간 (ms)
+    long throttledResponses;      // 429/418 응답 수
+    long long blockedUntilMs;     // 요청 차단 해제 시각 (0이면 차단 없음)
+};
+
+// X-MBX-USED-WEIGHT-* / X-MBX-ORDER-COUNT-* 헤더 기반 요청 스케줄러
+// 각 요청에 가중치를 부여하고 한도를 넘지 않도록 우선순위 순으로 대기시킨다
+class RequestScheduler {
+public:
+    RequestScheduler(long weight_limit_per_minute, long order_limit_per_10s);
+
+    RequestScheduler(const RequestScheduler&) = delete;
+    RequestScheduler& operator=(const RequestScheduler&) = delete;
+
+    // 예산이 허용될 때까지 대기한 뒤 가중치와 주문 수를 차감
+    // orders: 이번 요청이 만드는 신규 주문 수 (취소/조회는 0)
+    void acquire(int weight, RequestPriority priority, int orders = 0);
+
+    // 응답 헤더와 상태 코드로 예산 갱신
+    void update(const HttpResponse& response);
+
+    // 현재 상태 조회
+    RateLimitStats getStats() const;
+
+    // 엔드포인트별 요청 가중치
+    static int endpointWeight(const std::string& endpoint, const std::map<std::string, std::string>& params);
+
+    // 엔드포인트와 요청 방식으로 우선순위 결정 (주문 생성과 취소는 Order)
+    static RequestPriority priorityOf(const std::string& endpoint, const std::string& method, bool is_signed);
+
+    // 주문 수 한도에 더할 신규 주문 수 (주문 생성 POST만 1, 취소/수정/조회는 0)
+    static int orderCountOf(const std::string& endpoint, const std::string& method);
+
+private:
+    static long long nowMs();
+    void rollWindows(long long now_ms);
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::set<std::pair<int, long>> waiters_;  // (우선순위, 대기 순번)
+    long next_ticket_;
+
+    long weight_limit_;
+    long used_weight_;
+    long long weight_window_;     // 1분 구간 번호
+
+    long order_limit_;
+    long order_count_;
+    long long order_window_;      // 10초 구간 번호
+
+    long long blocked_until_ms_;
+
+    long waited_requests_;
+    double last_wait_ms_;
+    double total_wait_ms_;
+    long throttled_responses_;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <openssl/sha.h>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// HMAC-SHA256 요청 서명기
+// 비밀키를 ipad/opad로 섞은 내부/외부 해시 상태를 생성 시 한 번만 계산해 두고,
+// 서명할 때는 그 상태를 복사해 메시지만 이어서 해시한다 (키 스케줄 재계산/힙 할당 없음)
+class RequestSigner {
+public:
+    static const size_t SIGNATURE_LENGTH = 64;   // hex 문자 수 (NUL 미포함)
+
+    explicit RequestSigner(const std::string& secret_key);
+
+    // 서명을 소문자 hex로 out에 기록 (SIGNATURE_LENGTH 바이트, NUL을 붙이지 않음)
+    void sign(const char* data, size_t length, char* out) const;
+
+    std::string sign(std::string_view data) const;
+
+private:
+    SHA256_CTX inner_;
+    SHA256_CTX outer_;
+};
+
+// 요청 파라미터 문자열 생성기 (key=value&key=value...)
+// 필요한 길이를 먼저 예약해 두고 이어 붙이므로 문자열 버퍼는 한 번만 할당된다
+class QueryBuilder {
+public:
+    explicit QueryBuilder(size_t capacity = 256);
+
+    void append(std::string_view key, std::string_view value);
+    void append(std::string_view key, long long value);
+
+    // 지금까지의 문자열에 서명해 &signature=...를 덧붙임
+    void appendSignature(const RequestSigner& signer);
+
+    bool empty() const { return query_.empty(); }
+    const std::string& str() const { return query_; }
+    std::string release() { return std::move(query_); }
+
+private:
+    std::string query_;
+};
@@ -30,6 +30,10 @@ public:
     
     // 저장된 키 파일 삭제
     bool deleteStoredKeys();
+    
+    // 설정 디렉토리 (BINANCE_DATA_PATH 또는 ~/.binance_trader, 없으면 생성)
+    // 생성에 실패하면 빈 문자열
+    static std::string getConfigDirectory();
 
 private:
     std::string config_file_path_;
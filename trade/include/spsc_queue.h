@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+// 생산자/소비자 인덱스를 서로 다른 캐시 라인에 두어 거짓 공유를 막는다
+constexpr size_t QUEUE_CACHE_LINE = 64;
+
+inline size_t queueCapacity(size_t requested) {
+    size_t capacity = 2;
+    while (capacity < requested) capacity <<= 1;
+    return capacity;
+}
+
+// 단일 생산자/단일 소비자 고정 크기 링 버퍼 (잠금 없음)
+// 칸은 생성 시 모두 할당해 두고 값 복사로 주고받으므로 push/pop에서 메모리 할당이나 시스템 호출이 없다.
+// 상대 인덱스는 캐시해 두었다가 링이 가득 찼거나 비었을 때만 다시 읽는다
+template <typename T>
+class SpscQueue {
+    static_assert(std::is_trivially_copyable<T>::value, "SpscQueue 원소는 POD여야 함");
+
+public:
+    // capacity는 2의 거듭제곱으로 올림
+    explicit SpscQueue(size_t capacity)
+        : mask_(queueCapacity(capacity) - 1), slots_(new T[mask_ + 1]),
+          tail_(0), cached_head_(0), head_(0), cached_tail_(0) {
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // 생산자 스레드 전용 (가득 차 있으면 false)
+    bool tryPush(const T& value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ > mask_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ > mask_) {
+                return false;
+            }
+        }
+        slots_[tail & mask_] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 소비자 스레드 전용 (비어 있으면 false)
+    bool tryPop(T& value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_) {
+                return false;
+            }
+        }
+        value = slots_[head & mask_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 대략적인 원소 수 (다른 스레드가 진행 중이면 바로 바뀔 수 있음)
+    size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+private:
+    const size_t mask_;
+    const std::unique_ptr<T[]> slots_;
+
+    alignas(QUEUE_CACHE_LINE) std::atomic<size_t> tail_;   // 생산자가 기록
+    size_t cached_head_;                                   // 생산자 전용
+    alignas(QUEUE_CACHE_LINE) std::atomic<size_t> head_;   // 소비자가 기록
+    size_t cached_tail_;                                   // 소비자 전용
+};
+
+// 다중 생산자/단일 소비자 고정 크기 링 버퍼 (잠금 없음)
+// 칸마다 순번을 두어 생산자들은 tail을 CAS로 차지한 뒤 자기 칸에만 쓰고,
+// 소비자는 순번으로 기록 완료를 확인한다
+template <typename T>
+class MpscQueue {
+    static_assert(std::is_trivially_copyable<T>::value, "MpscQueue 원소는 POD여야 함");
+
+public:
+    explicit MpscQueue(size_t capacity)
+        : mask_(queueCapacity(capacity) - 1), cells_(new Cell[mask_ + 1]), tail_(0), head_(0) {
+        for (size_t i = 0; i <= mask_; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // 여러 스레드에서 호출 가능 (가득 차 있으면 false)
+    bool tryPush(const T& value) {
+        size_t position = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells_[position & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // 소비자가 아직 비우지 않은 칸
+            } else {
+                position = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 소비자 스레드 전용 (비어 있거나 생산자가 기록 중이면 false)
+    bool tryPop(T& value) {
+        size_t position = head_.load(std::memory_order_relaxed);
+        Cell& cell = cells_[position & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        value = cell.value;
+        cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+        head_.store(position + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    size_t size() const {
+        size_t tail = tail_.load(std::memory_order_acquire);
+        size_t head = head_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    const size_t mask_;
+    const std::unique_ptr<Cell[]> cells_;
+
+    alignas(QUEUE_CACHE_LINE) std::atomic<size_t> tail_;   // 생산자들이 CAS로 차지
+    alignas(QUEUE_CACHE_LINE) std::atomic<size_t> head_;   // 소비자가 기록
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "binance_api.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// exchangeInfo 심볼/필터 캐시 (시장별로 하나, BinanceAPI 복사본끼리 공유)
+// 첫 조회 때 전체 심볼을 한 번 불러오고, 이후에는 백그라운드 스레드가 TTL마다
+// 또는 필터 오류(-1013/-1111)로 무효화될 때 새 목록을 받아 통째로 교체한다.
+// 조회는 불변 스냅샷의 해시 색인을 사용하므로 네트워크 요청 없이 O(1)이다.
+// 캐시 파일 경로를 주면 생성 시 디스크의 심볼 목록으로 바로 시작하고
+// 거래소 목록 확인은 백그라운드에서 진행하며, 새로 받은 목록은 파일에 다시 저장한다
+class SymbolRegistry {
+public:
+    // 전체 심볼 목록을 받아오는 함수 (실패 시 false와 error)
+    // 성공해도 일부 심볼을 제외했다면 error에 이유를 남기며, lastError()로 조회할 수 있다
+    using Loader = std::function<bool(std::vector<SymbolInfo>& symbols, std::string& error)>;
+
+    SymbolRegistry(Loader loader, std::chrono::seconds ttl, const std::string& snapshot_path = "");
+    ~SymbolRegistry();
+
+    SymbolRegistry(const SymbolRegistry&) = delete;
+    SymbolRegistry& operator=(const SymbolRegistry&) = delete;
+
+    // 심볼 정보 조회 (아직 로드 전이면 호출 스레드에서 한 번 로드)
+    // 심볼이 없거나 로드에 실패하면 false, 이유는 lastError()
+    bool find(const std::string& symbol, SymbolInfo& info);
+
+    // 전체 심볼 목록 (로드 실패 시 nullptr)
+    std::shared_ptr<const std::vector<SymbolInfo>> symbols();
+
+    // 다음 조회를 기다리지 않고 백그라운드에서 즉시 다시 로드
+    void invalidate();
+
+    bool isLoaded() const;
+    long refreshCount() const { return refreshes_; }
+    bool loadedFromSnapshot() const { return from_snapshot_; }
+    std::string lastError() const;
+
+private:
+    static constexpr int RETRY_INTERVAL_SECONDS = 30;
+
+    struct Table {
+        std::vector<SymbolInfo> symbols;
+        std::unordered_map<std::string, size_t> index;
+    };
+
+    std::shared_ptr<const Table> table() const;
+    void setTable(std::vector<SymbolInfo> symbols);
+    bool loadSnapshot();
+    bool ensureLoaded();
+    bool reload();
+    void startWorker();
+    void run();
+
+    Loader loader_;
+    std::chrono::seconds ttl_;
+    std::string snapshot_path_;
+    std::atomic<bool> from_snapshot_;
+
+    mutable std::mutex mutex_;          // table_, error_ 보호
+    std::shared_ptr<const Table> table_;
+    std::string error_;
+    std::mutex load_mutex_;             // 동시에 하나의 로드만 수행
+
+    std::mutex worker_mutex_;
+    std::condition_variable worker_cv_;
+    bool stop_;
+    bool refresh_requested_;
+    std::thread worker_;
+    std::atomic<long> refreshes_;
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "binance_api.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// 심볼 캐시 파일 형식 (버전 2, 리틀 엔디언 고정 배치)
+//   [SymbolSnapshotHeader][SymbolRecord × count]
+// 문자열은 NUL로 채운 고정 길이 배열, 가격/수량은 Decimal 원시값(1e8배 정수)
+struct SymbolSnapshotHeader {
+    char magic[8];                // "BTSYMBL\0"
+    uint32_t version;
+    uint32_t recordSize;          // sizeof(SymbolRecord)
+    uint32_t count;
+    uint32_t reserved;
+    int64_t savedAtMs;            // 저장 시각 (epoch ms)
+    uint64_t checksum;            // 레코드 영역 FNV-1a
+};
+
+struct SymbolRecord {
+    char symbol[32];
+    char baseAsset[16];
+    char quoteAsset[16];
+    char status[24];
+    int64_t minQty;
+    int64_t maxQty;
+    int64_t stepSize;
+    int64_t tickSize;
+    int64_t minNotional;
+    int64_t marketMinQty;
+    int64_t marketMaxQty;
+    int64_t marketStepSize;
+    int64_t minPrice;
+    int64_t maxPrice;
+    int64_t maxNotional;
+    int64_t multiplierUp;
+    int64_t multiplierDown;
+    int32_t maxNumOrders;
+    int32_t pricePrecision;
+    int32_t quantityPrecision;
+    int32_t reserved;
+};
+
+static_assert(std::is_trivially_copyable<SymbolSnapshotHeader>::value, "헤더는 그대로 기록 가능해야 함");
+static_assert(std::is_trivially_copyable<SymbolRecord>::value, "레코드는 그대로 기록 가능해야 함");
+static_assert(sizeof(SymbolSnapshotHeader) == 40, "헤더 배치가 바뀌면 VERSION을 올릴 것");
+static_assert(sizeof(SymbolRecord) == 208, "레코드 배치가 바뀌면 VERSION을 올릴 것");
+
+// 디스크에 저장된 심볼 목록 (읽기 전용 메모리 매핑)
+// 시작 시 네트워크 없이 바로 심볼 정보를 쓸 수 있게 하고, 최신 여부는 호출 측이 따로 확인한다
+class SymbolSnapshot {
+public:
+    static const uint32_t VERSION = 2;
+
+    SymbolSnapshot();
+    ~SymbolSnapshot();
+
+    SymbolSnapshot(const SymbolSnapshot&) = delete;
+    SymbolSnapshot& operator=(const SymbolSnapshot&) = delete;
+
+    // 파일을 매핑하고 헤더/크기/체크섬 검증 (실패 시 false와 error)
+    bool open(const std::string& path, std::string& error);
+    void close();
+
+    size_t size() const { return header_ ? header_->count : 0; }
+    long long savedAtMs() const { return header_ ? header_->savedAtMs : 0; }
+    SymbolInfo at(size_t index) const;
+
+    // 임시 파일에 기록한 뒤 rename으로 교체 (읽는 쪽은 항상 완전한 파일만 봄)
+    // 고정 길이 필드에 들어가지 않는 심볼은 건너뜀
+    static bool save(const std::string& path, const std::vector<SymbolInfo>& symbols, std::string& error);
+
+private:
+    const SymbolSnapshotHeader* header_;
+    const SymbolRecord* records_;
+    void* mapping_;
+    size_t mapped_size_;
+    std::vector<char> buffer_;    // 메모리 매핑을 쓰지 않는 환경 (Windows)
+};
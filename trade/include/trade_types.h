@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+// ===== 심볼 ID =====
+
+using SymbolId = uint32_t;
+constexpr SymbolId INVALID_SYMBOL_ID = 0xFFFFFFFFu;
+
+// 심볼 이름 ↔ 정수 ID 변환표 (프로세스 전역)
+// ID는 처음 등록된 순서대로 0부터 부여되고 바뀌지 않으므로 배열 색인으로 바로 쓸 수 있다
+class SymbolTable {
+public:
+    static SymbolTable& instance();
+
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    // 이름의 ID (처음 보는 이름이면 새로 등록)
+    SymbolId intern(std::string_view name);
+
+    // 등록된 이름의 ID (없으면 INVALID_SYMBOL_ID)
+    SymbolId find(std::string_view name) const;
+
+    // ID의 이름 (잘못된 ID면 빈 문자열, 반환된 참조는 프로그램 종료까지 유효)
+    const std::string& name(SymbolId id) const;
+
+    size_t size() const;
+
+private:
+    SymbolTable() = default;
+
+    mutable std::shared_mutex mutex_;
+    std::deque<std::string> names_;                        // 원소 주소가 바뀌지 않는 저장소
+    std::unordered_map<std::string_view, SymbolId> ids_;   // 키는 names_의 문자열을 가리킴
+};
+
+// ===== 주문/포지션 열거형 =====
+// 문자열 변환은 바이낸스 API 표기 ("BUY", "PARTIALLY_FILLED" 등)를 사용
+
+enum class OrderSide : uint8_t { Unknown, Buy, Sell };
+
+enum class PositionSide : uint8_t { Both, Long, Short };
+
+enum class OrderType : uint8_t {
+    Unknown, Market, Limit, Stop, StopMarket, TakeProfit, TakeProfitMarket,
+    TrailingStopMarket, LimitMaker, StopLoss, StopLossLimit, TakeProfitLimit
+};
+
+enum class TimeInForce : uint8_t { None, GTC, IOC, FOK, GTX, GTD };
+
+enum class OrderStatus : uint8_t {
+    Unknown, New, PartiallyFilled, Filled, Canceled, PendingCancel, Rejected, Expired, ExpiredInMatch, TestSuccess
+};
+
+const char* toString(OrderSide value);
+const char* toString(PositionSide value);
+const char* toString(OrderType value);
+const char* toString(TimeInForce value);
+const char* toString(OrderStatus value);
+
+// 알 수 없는 표기면 false (value는 바뀌지 않음)
+bool fromString(std::string_view text, OrderSide& value);
+bool fromString(std::string_view text, PositionSide& value);
+bool fromString(std::string_view text, OrderType& value);
+bool fromString(std::string_view text, TimeInForce& value);
+bool fromString(std::string_view text, OrderStatus& value);
+
+// ===== 고정 크기 레코드 =====
+// 문자열 없이 ID/열거형/숫자만 담아 연속 배열에 그대로 보관하고 복사할 수 있는 형태
+
+struct PositionRecord {
+    SymbolId symbol;
+    int32_t leverage;
+    PositionSide positionSide;
+    double positionAmt;           // 양수: 롱, 음수: 숏
+    double entryPrice;
+    double markPrice;
+    double unRealizedProfit;
+};
+
+struct OrderRecord {
+    int64_t orderId;
+    SymbolId symbol;
+    OrderSide side;
+    PositionSide positionSide;
+    OrderType type;
+    TimeInForce timeInForce;
+    OrderStatus status;
+    bool reduceOnly;
+    double price;                 // 평균 체결가 (미체결이면 주문 가격)
+    double quantity;              // 체결 수량
+    char clientOrderId[40];       // NUL 종료 (바이낸스 최대 36자)
+};
+
+static_assert(std::is_trivially_copyable<PositionRecord>::value, "PositionRecord는 POD여야 함");
+static_assert(std::is_trivially_copyable<OrderRecord>::value, "OrderRecord는 POD여야 함");
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "binance_api.h"
+#include "position_store.h"
+#include "websocket_client.h"
+#include "json_parser.h"
+#include "trade_types.h"
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// 사용자 데이터 스트림으로 갱신되는 계정/포지션 저장소
+// 스트림 연결 직후 REST 스냅샷으로 초기화하고 이후에는 이벤트를 순서대로 반영한다.
+// 이벤트의 잔고/포지션 값은 증분이 아닌 절대값이므로, 스냅샷 조회 중 도착한 이벤트를
+// 스냅샷 뒤에 적용해도 최종 상태는 같아진다.
+// 주문은 심볼 ID와 열거형으로 된 고정 크기 레코드의 연속 배열로, 포지션은 열 단위 포지션 저장소로
+// 보관하고 조회할 때만 API 구조체로 변환한다
+class AccountStore {
+public:
+    AccountStore();
+
+    // REST 스냅샷 반영
+    void loadSpotSnapshot(const AccountInfo& info);
+    void loadFuturesSnapshot(const FuturesAccountInfo& info, const std::vector<FuturesPosition>& positions);
+
+    // 현물 이벤트 (outboundAccountPosition / executionReport)
+    void applySpotBalance(const std::string& asset, double free_amount);
+    void applySpotOrder(const OrderRecord& order);
+
+    // 선물 이벤트 (ACCOUNT_UPDATE / ORDER_TRADE_UPDATE / ACCOUNT_CONFIG_UPDATE)
+    void applyFuturesBalance(const std::string& asset, double wallet_balance, double cross_wallet_balance);
+    void applyFuturesPosition(const PositionRecord& position);
+    void applyLeverage(SymbolId symbol, int leverage);
+    void applyFuturesOrder(const OrderRecord& order);
+
+    // 스트림 연결 상태 (스냅샷 로드 후 연결이 유지되는 동안만 참)
+    void setLive(MarketType type, bool live);
+    bool isLive(MarketType type) const;
+
+    AccountInfo getAccountInfo() const;
+    FuturesAccountInfo getFuturesAccountInfo() const;
+    std::vector<FuturesPosition> getFuturesPositions() const;
+    FuturesPosition getFuturesPosition(const std::string& symbol) const;
+    bool getFuturesOrder(const std::string& orderId, FuturesOrderResponse& order) const;
+    bool getSpotOrder(const std::string& orderId, OrderResponse& order) const;
+
+    // 포지션 저장소 (마크 가격 스트림이 직접 갱신)
+    std::shared_ptr<PositionStore> positionStore() const { return positions_; }
+
+    // 스트림으로 본 주문 중 미체결(NEW/PARTIALLY_FILLED) 주문 수
+    int openOrderCount(MarketType type, SymbolId symbol) const;
+
+    long eventCount() const;
+
+private:
+    static const size_t MAX_TRACKED_ORDERS = 1000;
+
+    // 최근 주문 레코드 (MAX_TRACKED_ORDERS개를 넘으면 가장 오래된 주문부터 덮어씀)
+    struct OrderLog {
+        std::vector<OrderRecord> records;               // 고리 버퍼
+        std::unordered_map<int64_t, size_t> index;      // orderId → records 위치
+        size_t next = 0;                                // 가득 찬 뒤 다음에 덮어쓸 위치
+
+        void put(const OrderRecord& order);
+        const OrderRecord* find(int64_t orderId) const;
+        int countOpen(SymbolId symbol) const;
+    };
+
+    int leverageOf(SymbolId symbol) const;
+
+    mutable std::mutex mutex_;
+    std::atomic<bool> spot_live_;
+    std::atomic<bool> futures_live_;
+    long events_;
+
+    std::map<std::string, double> spot_free_;                 // 자산별 사용 가능 잔고
+    FuturesAccountInfo futures_account_;
+    double futures_wallet_;                                   // USDT 지갑 잔고
+    double futures_cross_wallet_;                             // USDT 교차 지갑 잔고
+    bool futures_cross_wallet_known_;                         // 스냅샷에 USDT 교차 지갑 잔고가 있었는지 여부
+    std::shared_ptr<PositionStore> positions_;                // 수량이 0이 아닌 (심볼, 포지션 방향)별 포지션
+    std::vector<int32_t> leverage_;                           // 심볼 ID별 레버리지 (0: 모름)
+
+    OrderLog futures_orders_;
+    OrderLog spot_orders_;
+};
+
+// 바이낸스 사용자 데이터 스트림 (listenKey 기반)
+// listenKey 발급 → WebSocket 연결 → REST 스냅샷 로드 → 이벤트 반영 순으로 동작하며
+// 30분마다 listenKey를 연장하고, 연결이 끊기거나 키가 만료되면 새 키로 다시 연결한다
+class UserDataStream {
+public:
+    // rest: 스트림을 사용하지 않는 REST 전용 API 복사본 (스냅샷과 listenKey 요청에 사용)
+    UserDataStream(MarketType type, const BinanceAPI& rest, const std::string& ws_base_url,
+                   std::shared_ptr<AccountStore> store);
+    ~UserDataStream();
+
+    UserDataStream(const UserDataStream&) = delete;
+    UserDataStream& operator=(const UserDataStream&) = delete;
+
+    void start();
+    void stop();
+
+    bool isLive() const;
+    long reconnectCount() const { return reconnects_; }
+    std::string lastError() const;
+
+private:
+    static const int KEEPALIVE_INTERVAL_MS = 30 * 60 * 1000;
+
+    void run();
+    bool loadSnapshot();
+    void waitBackoff(int& backoff_ms);
+    void setError(const std::string& error);
+
+    // 이벤트 처리 (listenKey가 만료되면 false 반환)
+    bool handleMessage(const std::string& message);
+    bool handleSpotEvent(std::string_view type, JSONValue event);
+    bool handleFuturesEvent(std::string_view type, JSONValue event);
+
+    MarketType type_;
+    BinanceAPI rest_;
+    std::string ws_base_url_;
+    std::shared_ptr<AccountStore> store_;
+    WebSocketClient client_;
+    JSONDocument doc_;              // 수신 스레드 전용 (메시지마다 토큰 버퍼 재사용)
+
+    std::thread worker_;
+    std::atomic<bool> running_;
+    std::atomic<long> reconnects_;
+
+    mutable std::mutex error_mutex_;
+    std::string error_;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <openssl/ssl.h>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#ifdef _WIN32
+#include <winsock2.h>
+typedef SOCKET socket_handle_t;
+#else
+typedef int socket_handle_t;
+#endif
+
+// RFC 6455 WebSocket 클라이언트 (ws:// 및 wss:// 지원)
+// 수신(connect/readMessage)은 한 스레드에서만, 송신과 close는 여러 스레드에서 호출 가능
+class WebSocketClient {
+public:
+    enum class ReadResult {
+        Message,      // 텍스트/바이너리 메시지 수신
+        Timeout,      // 제한 시간 내 메시지 없음
+        Closed        // 연결 종료 또는 오류
+    };
+
+    WebSocketClient();
+    ~WebSocketClient();
+
+    WebSocketClient(const WebSocketClient&) = delete;
+    WebSocketClient& operator=(const WebSocketClient&) = delete;
+
+    // URL에 연결하고 WebSocket 핸드셰이크 수행
+    bool connect(const std::string& url, int timeout_ms = 10000);
+
+    // 텍스트 메시지 송신
+    bool sendText(const std::string& message);
+
+    // 메시지 하나 수신 (ping에는 자동으로 pong 응답)
+    ReadResult readMessage(std::string& message, int timeout_ms);
+
+    // 연결 종료 (다른 스레드에서 호출하면 수신 대기 중인 readMessage가 Closed로 반환)
+    void close();
+
+    bool isConnected() const;
+    std::string lastError() const;
+
+private:
+    enum Opcode {
+        OP_CONTINUATION = 0x0,
+        OP_TEXT = 0x1,
+        OP_BINARY = 0x2,
+        OP_CLOSE = 0x8,
+        OP_PING = 0x9,
+        OP_PONG = 0xA
+    };
+
+    bool openSocket(const std::string& host, int port, int timeout_ms);
+    bool startTls(const std::string& host);
+    bool handshake(const std::string& host, int port, const std::string& path, int timeout_ms);
+    bool sendFrame(int opcode, const char* data, size_t length);
+    bool writeRaw(const char* data, size_t length);
+    int readRaw(char* buffer, size_t length, int timeout_ms);
+    bool waitReadable(int timeout_ms);
+    void setError(const std::string& error);
+    void closeSocket();
+
+    socket_handle_t socket_;
+    SSL_CTX* ssl_ctx_;
+    SSL* ssl_;
+    std::atomic<bool> connected_;
+
+    std::string buffer_;          // 아직 처리하지 않은 수신 데이터 (수신 스레드 전용)
+    std::string fragments_;       // 조각난 메시지 누적 (수신 스레드 전용)
+    uint32_t mask_state_;         // 마스킹 키 생성용 상태
+
+    std::mutex io_mutex_;         // socket_/ssl_ 사용과 해제를 직렬화 (poll 대기 중에는 보유하지 않음)
+    mutable std::mutex error_mutex_;
+    std::string error_;
+};
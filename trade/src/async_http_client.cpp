@@ -0,0 +1,147 @@
+#include "async_http_client.h"
+
+AsyncHttpClient::AsyncHttpClient(std::shared_ptr<ConnectionPool> pool)
+    : pool_(std::move(pool)), multi_(curl_multi_init()), running_(true), in_flight_(0) {
+    if (multi_) {
+        // HTTP/2 요청은 호스트당 하나의 연결에서 다중화
+        curl_multi_setopt(multi_, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    }
+    worker_ = std::thread(&AsyncHttpClient::run, this);
+}
+
+AsyncHttpClient::~AsyncHttpClient() {
+    running_ = false;
+    if (multi_) {
+        curl_multi_wakeup(multi_);
+    }
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    if (multi_) {
+        curl_multi_cleanup(multi_);
+    }
+}
+
+std::future<HttpResponse> AsyncHttpClient::submit(const HttpRequest& request) {
+    auto promise = std::make_shared<std::promise<HttpResponse>>();
+    std::future<HttpResponse> future = promise->get_future();
+
+    submit(request, [promise](HttpResponse response) {
+        promise->set_value(std::move(response));
+    });
+
+    return future;
+}
+
+void AsyncHttpClient::submit(const HttpRequest& request, Callback callback) {
+    auto transfer = std::make_unique<Transfer>();
+    transfer->request = request;
+    transfer->callback = std::move(callback);
+    transfer->base_url = ConnectionPool::baseUrlOf(request.url);
+
+    if (!multi_ || !running_) {
+        transfer->response.curlCode = CURLE_FAILED_INIT;
+        transfer->callback(std::move(transfer->response));
+        return;
+    }
+
+    in_flight_++;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(std::move(transfer));
+    }
+    curl_multi_wakeup(multi_);
+}
+
+size_t AsyncHttpClient::inFlight() const {
+    return in_flight_;
+}
+
+void AsyncHttpClient::startPending() {
+    std::deque<std::unique_ptr<Transfer>> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch.swap(pending_);
+    }
+
+    for (auto& transfer : batch) {
+        transfer->curl = pool_->acquire(transfer->base_url);
+        if (!transfer->curl) {
+            transfer->response.curlCode = CURLE_FAILED_INIT;
+            in_flight_--;
+            transfer->callback(std::move(transfer->response));
+            continue;
+        }
+
+        pool_->configure(transfer->curl, transfer->request, &transfer->response, true);
+        // 완료 시 전송 정보를 되찾기 위해 핸들에 포인터 저장
+        Transfer* raw = transfer.release();
+        curl_easy_setopt(raw->curl, CURLOPT_PRIVATE, raw);
+        curl_multi_add_handle(multi_, raw->curl);
+        active_.insert(raw);
+    }
+}
+
+void AsyncHttpClient::finishTransfer(CURL* curl, CURLcode result) {
+    Transfer* raw = nullptr;
+    curl_easy_getinfo(curl, CURLINFO_PRIVATE, (char**)&raw);
+    std::unique_ptr<Transfer> transfer(raw);
+    active_.erase(raw);
+
+    curl_multi_remove_handle(multi_, curl);
+
+    transfer->response.curlCode = result;
+    pool_->recordResult(curl, transfer->response);
+
+    // 전송 실패한 핸들은 연결 상태를 알 수 없으므로 폐기
+    if (result == CURLE_OK) {
+        pool_->release(transfer->base_url, curl);
+    } else {
+        curl_easy_cleanup(curl);
+    }
+
+    in_flight_--;
+    transfer->callback(std::move(transfer->response));
+}
+
+void AsyncHttpClient::run() {
+    while (running_) {
+        startPending();
+
+        int still_running = 0;
+        curl_multi_perform(multi_, &still_running);
+
+        CURLMsg* msg;
+        int msgs_left = 0;
+        while ((msg = curl_multi_info_read(multi_, &msgs_left))) {
+            if (msg->msg == CURLMSG_DONE) {
+                finishTransfer(msg->easy_handle, msg->data.result);
+            }
+        }
+
+        // 소켓 이벤트, 새 요청(wakeup) 또는 타임아웃까지 대기
+        curl_multi_poll(multi_, nullptr, 0, 1000, nullptr);
+    }
+
+    // 종료 시 남은 요청은 중단 처리하여 대기 중인 future를 해제
+    std::deque<std::unique_ptr<Transfer>> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch.swap(pending_);
+    }
+    for (auto& transfer : batch) {
+        transfer->response.curlCode = CURLE_ABORTED_BY_CALLBACK;
+        in_flight_--;
+        transfer->callback(std::move(transfer->response));
+    }
+
+    for (Transfer* raw : active_) {
+        std::unique_ptr<Transfer> transfer(raw);
+        curl_multi_remove_handle(multi_, transfer->curl);
+        curl_easy_cleanup(transfer->curl);
+        transfer->response.curlCode = CURLE_ABORTED_BY_CALLBACK;
+        in_flight_--;
+        transfer->callback(std::move(transfer->response));
+    }
+    active_.clear();
+}
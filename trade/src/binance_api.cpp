@@ -1,44 +1,209 @@
 #include "binance_api.h"
 #include "json_parser.h"
+#include "json_schema.h"
+#include "user_data_stream.h"
+#include "order_session.h"
+#include "order_gateway.h"
+#include "symbol_registry.h"
+#include "secure_storage.h"
+#include "order_filter.h"
+#include "request_signer.h"
+#include "latency_monitor.h"
+#include "order_book_stream.h"
+#include "mark_price_stream.h"
 #include <curl/curl.h>
-#include <openssl/hmac.h>
-#include <openssl/sha.h>
 #include <chrono>
 #include <sstream>
 #include <iomanip>
 #include <iostream>
 #include <thread>
 #include <cmath>
+#include <cctype>
+#include <algorithm>
 
-// CURL response를 위한 구조체
-struct CurlResponse {
-    std::string data;
+// 응답 스키마 (JSON 키 → 구조체 멤버)
+namespace {
+
+struct SpotOrderSchema {
+    using Type = OrderResponse;
+    static constexpr auto fields = std::make_tuple(
+        requiredField("orderId", &OrderResponse::orderId),
+        requiredField("status", &OrderResponse::status),
+        optionalField("symbol", &OrderResponse::symbol),
+        optionalField("side", &OrderResponse::side),
+        optionalField("executedQty", &OrderResponse::quantity),
+        optionalField("price", &OrderResponse::price));
+};
+
+// 선물 주문 공통 필드 (수량/가격 필드는 시장가/지정가에 따라 다름)
+constexpr auto FUTURES_ORDER_FIELDS = std::make_tuple(
+    requiredField("orderId", &FuturesOrderResponse::orderId),
+    requiredField("status", &FuturesOrderResponse::status),
+    optionalField("symbol", &FuturesOrderResponse::symbol),
+    optionalField("clientOrderId", &FuturesOrderResponse::clientOrderId),
+    optionalField("side", &FuturesOrderResponse::side),
+    optionalField("positionSide", &FuturesOrderResponse::positionSide),
+    optionalField("type", &FuturesOrderResponse::type),
+    optionalField("timeInForce", &FuturesOrderResponse::timeInForce),
+    optionalField("reduceOnly", &FuturesOrderResponse::reduceOnly));
+
+// 시장가: 체결 수량과 평균 체결가
+struct FuturesMarketOrderSchema {
+    using Type = FuturesOrderResponse;
+    static constexpr auto fields = std::tuple_cat(FUTURES_ORDER_FIELDS, std::make_tuple(
+        optionalField("executedQty", &FuturesOrderResponse::quantity),
+        optionalField("avgPrice", &FuturesOrderResponse::price)));
+};
+
+// 지정가: 주문 수량과 주문 가격
+struct FuturesLimitOrderSchema {
+    using Type = FuturesOrderResponse;
+    static constexpr auto fields = std::tuple_cat(FUTURES_ORDER_FIELDS, std::make_tuple(
+        optionalField("origQty", &FuturesOrderResponse::quantity),
+        optionalField("price", &FuturesOrderResponse::price)));
+};
+
+struct FuturesPositionSchema {
+    using Type = FuturesPosition;
+    static constexpr auto fields = std::make_tuple(
+        requiredField("symbol", &FuturesPosition::symbol),
+        requiredField("positionAmt", &FuturesPosition::positionAmt),
+        requiredField("entryPrice", &FuturesPosition::entryPrice),
+        requiredField("markPrice", &FuturesPosition::markPrice),
+        requiredField("unRealizedProfit", &FuturesPosition::unRealizedProfit),
+        requiredField("positionSide", &FuturesPosition::positionSide),
+        optionalField("leverage", &FuturesPosition::leverage));
+};
+
+struct FuturesAccountSchema {
+    using Type = FuturesAccountInfo;
+    static constexpr auto fields = std::make_tuple(
+        requiredField("totalWalletBalance", &FuturesAccountInfo::totalWalletBalance),
+        requiredField("totalUnrealizedProfit", &FuturesAccountInfo::totalUnrealizedPnl),
+        requiredField("totalMarginBalance", &FuturesAccountInfo::totalMarginBalance),
+        requiredField("availableBalance", &FuturesAccountInfo::availableBalance),
+        requiredField("maxWithdrawAmount", &FuturesAccountInfo::maxWithdrawAmount));
+};
+
+struct FuturesSymbolSchema {
+    using Type = SymbolInfo;
+    static constexpr auto fields = std::make_tuple(
+        requiredField("symbol", &SymbolInfo::symbol),
+        requiredField("baseAsset", &SymbolInfo::baseAsset),
+        requiredField("quoteAsset", &SymbolInfo::quoteAsset),
+        requiredField("status", &SymbolInfo::status),
+        optionalField("pricePrecision", &SymbolInfo::pricePrecision),
+        optionalField("quantityPrecision", &SymbolInfo::quantityPrecision));
+};
+
+// exchangeInfo 필터 (filterType별로 필요한 필드만 고정소수점으로 디코딩)
+struct LotSizeFilterSchema {
+    using Type = SymbolInfo;
+    static constexpr auto fields = std::make_tuple(
+        requiredField("minQty", &SymbolInfo::minQty),
+        requiredField("maxQty", &SymbolInfo::maxQty),
+        requiredField("stepSize", &SymbolInfo::stepSize));
 };
 
-// CURL 응답 콜백 함수
-static size_t WriteCallback(void* contents, size_t size, size_t nmemb, CurlResponse* response) {
-    size_t totalSize = size * nmemb;
-    response->data.append((char*)contents, totalSize);
-    return totalSize;
+struct MarketLotSizeFilterSchema {
+    using Type = SymbolInfo;
+    static constexpr auto fields = std::make_tuple(
+        requiredField("minQty", &SymbolInfo::marketMinQty),
+        requiredField("maxQty", &SymbolInfo::marketMaxQty),
+        requiredField("stepSize", &SymbolInfo::marketStepSize));
+};
+
+struct PriceFilterSchema {
+    using Type = SymbolInfo;
+    static constexpr auto fields = std::make_tuple(
+        requiredField("tickSize", &SymbolInfo::tickSize),
+        optionalField("minPrice", &SymbolInfo::minPrice),
+        optionalField("maxPrice", &SymbolInfo::maxPrice));
+};
+
+// 선물 MIN_NOTIONAL은 "notional", 현물 MIN_NOTIONAL/NOTIONAL은 "minNotional"
+struct MinNotionalFilterSchema {
+    using Type = SymbolInfo;
+    static constexpr auto fields = std::make_tuple(
+        optionalField("notional", &SymbolInfo::minNotional),
+        optionalField("minNotional", &SymbolInfo::minNotional),
+        optionalField("maxNotional", &SymbolInfo::maxNotional));
+};
+
+struct PercentPriceFilterSchema {
+    using Type = SymbolInfo;
+    static constexpr auto fields = std::make_tuple(
+        requiredField("multiplierUp", &SymbolInfo::multiplierUp),
+        requiredField("multiplierDown", &SymbolInfo::multiplierDown));
+};
+
+// 선물은 "limit", 현물은 "maxNumOrders"
+struct MaxNumOrdersFilterSchema {
+    using Type = SymbolInfo;
+    static constexpr auto fields = std::make_tuple(
+        optionalField("limit", &SymbolInfo::maxNumOrders),
+        optionalField("maxNumOrders", &SymbolInfo::maxNumOrders));
+};
+
+// exchangeInfo는 거의 바뀌지 않으므로 30분마다 갱신 (필터 오류 시에는 즉시)
+const std::chrono::seconds SYMBOL_REFRESH_INTERVAL(30 * 60);
+
+// QuantityAdjustPolicy::Reject로 주문하지 않을 때의 오류 (호출자가 권장 수량으로 다시 주문할 수 있게)
+std::string quantityBelowMinimumError(Decimal suggested) {
+    return "주문 수량이 최소 주문 수량에 미달합니다 (권장 수량: " + suggested.toString() + ")";
 }
 
+}  // namespace
+
 BinanceAPI::BinanceAPI(const std::string& api_key, const std::string& secret_key) 
-    : api_key_(api_key), secret_key_(secret_key), base_url_("https://api.binance.com"), 
-      futures_base_url_("https://fapi.binance.com") {
+    : api_key_(api_key), signer_(std::make_shared<RequestSigner>(secret_key)), base_url_("https://api.binance.com"), 
+      futures_base_url_("https://fapi.binance.com"),
+      connection_pool_(std::make_shared<ConnectionPool>()), http2_enabled_(false),
+      async_client_(std::make_shared<AsyncHttpClient>(connection_pool_)),
+      spot_scheduler_(std::make_shared<RequestScheduler>(6000, 100)),
+      futures_scheduler_(std::make_shared<RequestScheduler>(2400, 300)),
+      spot_stream_url_("wss://stream.binance.com:9443"), futures_stream_url_("wss://fstream.binance.com"),
+      order_session_enabled_(false), spot_ws_api_url_("wss://ws-api.binance.com:443/ws-api/v3"),
+      futures_ws_api_url_("wss://ws-fapi.binance.com/ws-fapi/v1") {
     curl_global_init(CURL_GLOBAL_DEFAULT);
+    
+    // 헤더는 한 번만 생성하고 모든 요청에서 재사용
+    struct curl_slist* headers = nullptr;
+    std::string api_key_header = "X-MBX-APIKEY: " + api_key_;
+    headers = curl_slist_append(headers, api_key_header.c_str());
+    headers = curl_slist_append(headers, "Content-Type: application/x-www-form-urlencoded");
+    headers_ = std::shared_ptr<curl_slist>(headers, curl_slist_free_all);
+    
+    resetSymbolRegistries();
 }
 
-std::string BinanceAPI::createSignature(const std::string& query_string) {
-    unsigned char* digest = HMAC(EVP_sha256(), 
-                                secret_key_.c_str(), secret_key_.length(),
-                                (unsigned char*)query_string.c_str(), query_string.length(),
-                                nullptr, nullptr);
-    
-    std::stringstream ss;
-    for (int i = 0; i < 32; i++) {
-        ss << std::hex << std::setw(2) << std::setfill('0') << (int)digest[i];
+void BinanceAPI::resetSymbolRegistries() {
+    // 심볼 캐시는 REST 전용 복사본으로 exchangeInfo를 받아옴 (캐시 → API → 캐시 순환 참조 방지)
+    // 설정 디렉토리의 캐시 파일이 있으면 네트워크 요청 없이 바로 사용
+    BinanceAPI rest = restClient();
+    rest.spot_symbols_.reset();
+    rest.futures_symbols_.reset();
+    bool default_endpoints = (base_url_ == "https://api.binance.com" && futures_base_url_ == "https://fapi.binance.com");
+    std::string config_dir = default_endpoints ? SecureStorage::getConfigDirectory() : std::string();
+    for (MarketType type : {MarketType::Spot, MarketType::Futures}) {
+        auto loader = [rest, type](std::vector<SymbolInfo>& symbols, std::string& error) mutable {
+            FuturesSymbolsResponse result = rest.streamExchangeSymbols(type, [&symbols](const SymbolInfo& info) {
+                symbols.push_back(info);
+            });
+            error = result.error;
+            return result.success;
+        };
+        std::shared_ptr<SymbolRegistry>& registry = (type == MarketType::Spot) ? spot_symbols_ : futures_symbols_;
+        std::string snapshot_path;
+        if (!config_dir.empty()) {
+            snapshot_path = config_dir + ((type == MarketType::Spot) ? "/symbols_spot.bin" : "/symbols_futures.bin");
+        }
+        registry = std::make_shared<SymbolRegistry>(loader, SYMBOL_REFRESH_INTERVAL, snapshot_path);
     }
-    return ss.str();
+}
+
+std::string BinanceAPI::createSignature(const std::string& query_string) {
+    return signer_->sign(query_string);
 }
 
 long long BinanceAPI::getCurrentTimestamp() {
@@ -47,184 +212,465 @@ long long BinanceAPI::getCurrentTimestamp() {
     return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
 }
 
-std::string BinanceAPI::makeRequest(const std::string& endpoint, const std::string& method,
-                                   const std::map<std::string, std::string>& params, bool is_signed) {
-    CURL* curl = curl_easy_init();
-    CurlResponse response;
+ConnectionPoolStats BinanceAPI::getConnectionStats() const {
+    return connection_pool_->getStats();
+}
+
+RateLimitStats BinanceAPI::getSpotRateLimitStats() const {
+    return spot_scheduler_->getStats();
+}
+
+RateLimitStats BinanceAPI::getFuturesRateLimitStats() const {
+    return futures_scheduler_->getStats();
+}
+
+void BinanceAPI::setHttp2Enabled(bool enabled) {
+    http2_enabled_ = enabled;
+}
+
+bool BinanceAPI::isHttp2Enabled() const {
+    return http2_enabled_;
+}
+
+void BinanceAPI::setRestEndpoints(const std::string& spot_url, const std::string& futures_url) {
+    base_url_ = spot_url;
+    futures_base_url_ = futures_url;
+    resetSymbolRegistries();
+}
+
+void BinanceAPI::startMarketDataStream(const std::vector<std::string>& symbols) {
+    stopMarketDataStream();
     
-    if (!curl) {
-        return "{\"error\":\"Failed to initialize CURL\"}";
+    spot_stream_ = std::make_shared<MarketDataStream>(MarketType::Spot, spot_stream_url_, symbols);
+    futures_stream_ = std::make_shared<MarketDataStream>(MarketType::Futures, futures_stream_url_, symbols);
+    spot_stream_->start();
+    futures_stream_->start();
+}
+
+void BinanceAPI::stopMarketDataStream() {
+    if (spot_stream_) {
+        spot_stream_->stop();
+        spot_stream_.reset();
     }
-    
-    // 쿼리 스트링 생성
-    std::string query_string;
-    for (const auto& param : params) {
-        if (!query_string.empty()) query_string += "&";
-        query_string += param.first + "=" + param.second;
+    if (futures_stream_) {
+        futures_stream_->stop();
+        futures_stream_.reset();
     }
-    
-    if (is_signed) {
-        if (!query_string.empty()) query_string += "&";
-        query_string += "timestamp=" + std::to_string(getCurrentTimestamp());
-        
-        std::string signature = createSignature(query_string);
-        query_string += "&signature=" + signature;
+}
+
+bool BinanceAPI::isMarketDataStreamLive() const {
+    return (spot_stream_ && spot_stream_->isLive()) || (futures_stream_ && futures_stream_->isLive());
+}
+
+PriceSnapshot BinanceAPI::getStreamPrice(const std::string& symbol, MarketType type) const {
+    const std::shared_ptr<MarketDataStream>& stream = (type == MarketType::Spot) ? spot_stream_ : futures_stream_;
+    if (!stream) {
+        PriceSnapshot snapshot;
+        snapshot.symbol = symbol;
+        snapshot.bidPrice = snapshot.askPrice = snapshot.lastPrice = snapshot.markPrice = 0.0;
+        snapshot.eventTimeMs = 0;
+        snapshot.valid = false;
+        return snapshot;
     }
+    return stream->getPrice(symbol);
+}
+
+void BinanceAPI::setStreamEndpoints(const std::string& spot_url, const std::string& futures_url) {
+    spot_stream_url_ = spot_url;
+    futures_stream_url_ = futures_url;
+}
+
+DepthSnapshot BinanceAPI::getDepthSnapshot(MarketType type, const std::string& symbol, int limit) {
+    DepthSnapshot snapshot;
+    snapshot.symbol = symbol;
+    snapshot.lastUpdateId = 0;
+    snapshot.success = false;
     
-    std::string full_url = base_url_ + endpoint;
+    std::map<std::string, std::string> params;
+    params["symbol"] = symbol;
+    params["limit"] = std::to_string(limit);
     
-    // POST 요청의 경우 데이터를 body에 넣기
-    if (method == "POST") {
-        curl_easy_setopt(curl, CURLOPT_URL, full_url.c_str());
-        curl_easy_setopt(curl, CURLOPT_POST, 1L);
-        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, query_string.c_str());
-        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, query_string.length());
-    } else {
-        // GET 요청의 경우 URL에 쿼리 스트링 추가
-        if (!query_string.empty()) {
-            full_url += "?" + query_string;
+    const char* endpoint = (type == MarketType::Spot) ? "/api/v3/depth" : "/fapi/v1/depth";
+    std::string response = (type == MarketType::Spot) ? makeRequest(endpoint, "GET", params, false)
+                                                      : makeFuturesRequest(endpoint, "GET", params, false);
+    if (response.find("\"error\"") != std::string::npos || response.find("\"code\"") != std::string::npos) {
+        snapshot.error = JSONParser::extractString(response, "msg");
+        if (snapshot.error.empty()) {
+            snapshot.error = JSONParser::extractString(response, "error");
         }
-        curl_easy_setopt(curl, CURLOPT_URL, full_url.c_str());
+        return snapshot;
     }
     
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+    LatencyTimer timer(endpoint, LatencyStage::Parse);
+    snapshot.success = parseDepthSnapshot(response, snapshot);
+    return snapshot;
+}
+
+void BinanceAPI::startOrderBookStream(MarketType type, const std::vector<std::string>& symbols) {
+    stopOrderBookStream(type);
     
-    // 실제 주문의 경우 더 짧은 타임아웃 사용
-    if (endpoint == "/api/v3/order") {
-        curl_easy_setopt(curl, CURLOPT_TIMEOUT, 15L);  // 15초로 단축
-        curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 5L);  // 5초로 단축
-    } else {
-        curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);
-        curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
+    std::shared_ptr<OrderBookStream>& stream = (type == MarketType::Spot) ? spot_book_stream_ : futures_book_stream_;
+    const std::string& url = (type == MarketType::Spot) ? spot_stream_url_ : futures_stream_url_;
+    stream = std::make_shared<OrderBookStream>(type, restClient(), url, symbols);
+    stream->start();
+}
+
+void BinanceAPI::stopOrderBookStream(MarketType type) {
+    std::shared_ptr<OrderBookStream>& stream = (type == MarketType::Spot) ? spot_book_stream_ : futures_book_stream_;
+    if (stream) {
+        stream->stop();
+        stream.reset();
+    }
+}
+
+bool BinanceAPI::isOrderBookStreamLive(MarketType type) const {
+    const std::shared_ptr<OrderBookStream>& stream = (type == MarketType::Spot) ? spot_book_stream_ : futures_book_stream_;
+    return stream && stream->isLive();
+}
+
+std::shared_ptr<const OrderBook> BinanceAPI::getOrderBook(MarketType type, const std::string& symbol) const {
+    const std::shared_ptr<OrderBookStream>& stream = (type == MarketType::Spot) ? spot_book_stream_ : futures_book_stream_;
+    return stream ? stream->book(symbol) : nullptr;
+}
+
+BinanceAPI BinanceAPI::restClient() const {
+    BinanceAPI rest = *this;
+    rest.spot_stream_.reset();
+    rest.futures_stream_.reset();
+    rest.spot_book_stream_.reset();
+    rest.futures_book_stream_.reset();
+    rest.account_store_.reset();
+    rest.spot_user_stream_.reset();
+    rest.futures_user_stream_.reset();
+    rest.mark_stream_.reset();
+    rest.spot_order_session_.reset();
+    rest.futures_order_session_.reset();
+    rest.order_session_enabled_ = false;
+    rest.order_gateway_.reset();
+    return rest;
+}
+
+void BinanceAPI::startOrderGateway(size_t capacity) {
+    stopOrderGateway();
+    
+    // 시세/호가/계정 저장소는 공유하고 주문 세션만 게이트웨이 전용으로 새로 연결
+    BinanceAPI gateway = *this;
+    gateway.order_gateway_.reset();
+    gateway.spot_order_session_.reset();
+    gateway.futures_order_session_.reset();
+    if (gateway.order_session_enabled_) {
+        gateway.orderSession(MarketType::Spot)->connect();
+        gateway.orderSession(MarketType::Futures)->connect();
+    }
+    
+    order_gateway_ = std::make_shared<OrderGateway>(gateway, capacity);
+    order_gateway_->start();
+}
+
+void BinanceAPI::stopOrderGateway() {
+    if (order_gateway_) {
+        order_gateway_->stop();
+        order_gateway_.reset();
+    }
+}
+
+bool BinanceAPI::isOrderGatewayRunning() const {
+    return order_gateway_ && order_gateway_->isRunning();
+}
+
+bool BinanceAPI::submitOrder(const OrderIntent& intent) {
+    return order_gateway_ && order_gateway_->submit(intent);
+}
+
+bool BinanceAPI::submitOrderShared(const OrderIntent& intent) {
+    return order_gateway_ && order_gateway_->submitShared(intent);
+}
+
+bool BinanceAPI::pollOrderReply(OrderReply& reply) {
+    return order_gateway_ && order_gateway_->poll(reply);
+}
+
+bool BinanceAPI::getOrderGatewayStats(OrderGatewayStats& stats) const {
+    if (!order_gateway_) {
+        return false;
+    }
+    stats = order_gateway_->stats();
+    return true;
+}
+
+void BinanceAPI::setOrderSessionEnabled(bool enabled) {
+    order_session_enabled_ = enabled;
+}
+
+bool BinanceAPI::isOrderSessionEnabled() const {
+    return order_session_enabled_;
+}
+
+void BinanceAPI::setOrderSessionEndpoints(const std::string& spot_url, const std::string& futures_url) {
+    spot_ws_api_url_ = spot_url;
+    futures_ws_api_url_ = futures_url;
+    spot_order_session_.reset();
+    futures_order_session_.reset();
+}
+
+double BinanceAPI::getOrderSessionLatencyMs(MarketType type) const {
+    const std::shared_ptr<OrderSession>& session = (type == MarketType::Spot) ? spot_order_session_ : futures_order_session_;
+    return session ? session->averageRoundTripMs() : 0.0;
+}
+
+std::shared_ptr<OrderSession> BinanceAPI::orderSession(MarketType type) {
+    std::shared_ptr<OrderSession>& session = (type == MarketType::Spot) ? spot_order_session_ : futures_order_session_;
+    if (!session) {
+        // 서명기만 공유 (세션 → API → 세션 순환 참조 방지)
+        std::shared_ptr<const RequestSigner> signer = signer_;
+        session = std::make_shared<OrderSession>(
+            (type == MarketType::Spot) ? spot_ws_api_url_ : futures_ws_api_url_, api_key_,
+            [signer](const std::string& payload) { return signer->sign(payload); });
     }
+    return session;
+}
+
+std::string BinanceAPI::makeOrderRequest(MarketType type, const std::string& ws_method, const std::string& http_method,
+                                         const std::map<std::string, std::string>& params) {
+    const std::string endpoint = (type == MarketType::Spot) ? "/api/v3/order" : "/fapi/v1/order";
     
-    curl_easy_setopt(curl, CURLOPT_VERBOSE, 0L);
-    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, "Binance-Trader/1.0");
+    if (order_session_enabled_) {
+        std::shared_ptr<OrderSession> session = orderSession(type);
+        
+        // 연결 실패 시에는 아무것도 전송되지 않았으므로 REST로 안전하게 전환
+        if (session->connect()) {
+            RequestScheduler& scheduler = (type == MarketType::Spot) ? *spot_scheduler_ : *futures_scheduler_;
+            scheduler.acquire(RequestScheduler::endpointWeight(endpoint, params),
+                              RequestScheduler::priorityOf(endpoint, http_method, true),
+                              RequestScheduler::orderCountOf(endpoint, http_method));
+            std::string response = session->call(ws_method, params, true);
+            checkFilterError(type, response);
+            return response;
+        }
+    }
     
-    // 헤더 설정
-    struct curl_slist* headers = nullptr;
-    std::string api_key_header = "X-MBX-APIKEY: " + api_key_;
-    headers = curl_slist_append(headers, api_key_header.c_str());
-    headers = curl_slist_append(headers, "Content-Type: application/x-www-form-urlencoded");
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    std::string response = (type == MarketType::Spot) ? makeRequest(endpoint, http_method, params, true)
+                                                      : makeFuturesRequest(endpoint, http_method, params, true);
+    checkFilterError(type, response);
+    return response;
+}
+
+void BinanceAPI::checkFilterError(MarketType type, const std::string& response) {
+    // -1013: 필터 위반 (LOT_SIZE, PRICE_FILTER 등), -1111: 허용 정밀도 초과
+    if (response.find("\"code\":-1013") == std::string::npos && response.find("\"code\":-1111") == std::string::npos) {
+        return;
+    }
+    refreshSymbols(type);
+}
+
+bool BinanceAPI::getSymbolInfo(MarketType type, const std::string& symbol, SymbolInfo& info) {
+    std::shared_ptr<SymbolRegistry> registry = (type == MarketType::Spot) ? spot_symbols_ : futures_symbols_;
+    return registry && registry->find(symbol, info);
+}
+
+void BinanceAPI::refreshSymbols(MarketType type) {
+    std::shared_ptr<SymbolRegistry> registry = (type == MarketType::Spot) ? spot_symbols_ : futures_symbols_;
+    if (registry) {
+        registry->invalidate();
+    }
+}
+
+void BinanceAPI::startUserDataStream() {
+    stopUserDataStream();
+    
+    account_store_ = std::make_shared<AccountStore>();
+    BinanceAPI rest = restClient();
+    spot_user_stream_ = std::make_shared<UserDataStream>(MarketType::Spot, rest, spot_stream_url_, account_store_);
+    futures_user_stream_ = std::make_shared<UserDataStream>(MarketType::Futures, rest, futures_stream_url_, account_store_);
+    spot_user_stream_->start();
+    futures_user_stream_->start();
+    
+    // 전체 심볼 마크 가격은 키가 필요 없는 공개 스트림이므로 계정 스트림과 함께 시작
+    mark_stream_ = std::make_shared<MarkPriceStream>(futures_stream_url_, account_store_->positionStore());
+    mark_stream_->start();
+}
+
+void BinanceAPI::stopUserDataStream() {
+    if (spot_user_stream_) {
+        spot_user_stream_->stop();
+        spot_user_stream_.reset();
+    }
+    if (futures_user_stream_) {
+        futures_user_stream_->stop();
+        futures_user_stream_.reset();
+    }
+    if (mark_stream_) {
+        mark_stream_->stop();
+        mark_stream_.reset();
+    }
+    account_store_.reset();
+}
+
+bool BinanceAPI::isMarkPriceStreamLive() const {
+    return mark_stream_ && mark_stream_->isLive();
+}
+
+bool BinanceAPI::getPositionTotals(PositionTotals& totals) const {
+    if (!isUserDataStreamLive(MarketType::Futures)) {
+        return false;
+    }
+    refreshPositionMarks();
+    totals = account_store_->positionStore()->totals();
+    return true;
+}
+
+bool BinanceAPI::isUserDataStreamLive(MarketType type) const {
+    return account_store_ && account_store_->isLive(type);
+}
+
+bool BinanceAPI::getStreamOrderUpdate(const std::string& orderId, FuturesOrderResponse& order) const {
+    return account_store_ && account_store_->getFuturesOrder(orderId, order);
+}
+
+bool BinanceAPI::getStreamOrderUpdate(const std::string& orderId, OrderResponse& order) const {
+    return account_store_ && account_store_->getSpotOrder(orderId, order);
+}
+
+std::string BinanceAPI::createListenKey(MarketType type) {
+    std::string response = (type == MarketType::Spot)
+        ? makeRequest("/api/v3/userDataStream", "POST", {}, false)
+        : makeFuturesRequest("/fapi/v1/listenKey", "POST", {}, false);
     
-    CURLcode res = curl_easy_perform(curl);
+    if (response.find("\"error\"") != std::string::npos) {
+        return "";
+    }
+    return JSONParser::extractString(response, "listenKey");
+}
+
+bool BinanceAPI::keepAliveListenKey(MarketType type, const std::string& listen_key) {
+    std::map<std::string, std::string> params;
+    params["listenKey"] = listen_key;
     
-    // HTTP 응답 코드 확인
-    long response_code;
-    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+    std::string response = (type == MarketType::Spot)
+        ? makeRequest("/api/v3/userDataStream", "PUT", params, false)
+        : makeFuturesRequest("/fapi/v1/listenKey", "PUT", params, false);
+    return response.find("\"error\"") == std::string::npos;
+}
+
+void BinanceAPI::closeListenKey(MarketType type, const std::string& listen_key) {
+    std::map<std::string, std::string> params;
+    params["listenKey"] = listen_key;
     
-    curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
+    if (type == MarketType::Spot) {
+        makeRequest("/api/v3/userDataStream", "DELETE", params, false);
+    } else {
+        makeFuturesRequest("/fapi/v1/listenKey", "DELETE", params, false);
+    }
+}
+
+int BinanceAPI::openOrderCount(MarketType type, const std::string& symbol) const {
+    if (!account_store_ || !account_store_->isLive(type)) {
+        return -1;
+    }
+    SymbolId id = SymbolTable::instance().find(symbol);
+    return (id != INVALID_SYMBOL_ID) ? account_store_->openOrderCount(type, id) : 0;
+}
+
+void BinanceAPI::refreshPositionMarks() const {
+    if (isMarkPriceStreamLive() || !account_store_ || !futures_stream_ || !futures_stream_->isLive()) {
+        return;
+    }
     
-    if (res != CURLE_OK) {
-        std::string error_msg = "네트워크 요청 실패: ";
-        switch (res) {
-            case CURLE_OPERATION_TIMEDOUT:
-                error_msg += "타임아웃 (15초 초과)";
-                break;
-            case CURLE_COULDNT_CONNECT:
-                error_msg += "연결 실패";
-                break;
-            case CURLE_COULDNT_RESOLVE_HOST:
-                error_msg += "DNS 해석 실패";
-                break;
-            case CURLE_SSL_CONNECT_ERROR:
-                error_msg += "SSL 연결 실패";
-                break;
-            default:
-                error_msg += curl_easy_strerror(res);
-                break;
+    // 마크 가격 스트림이 없을 때만 시세 스트림(구독 심볼)의 마크 가격을 포지션 저장소에 반영
+    std::shared_ptr<PositionStore> store = account_store_->positionStore();
+    std::vector<SymbolId> symbols = store->symbols();
+    std::vector<double> marks(symbols.size(), 0.0);
+    for (size_t i = 0; i < symbols.size(); i++) {
+        PriceSnapshot snapshot = futures_stream_->getPrice(SymbolTable::instance().name(symbols[i]));
+        if (snapshot.valid) {
+            marks[i] = snapshot.markPrice;
         }
-        return "{\"error\":\"" + error_msg + "\"}";
+    }
+    store->applyMarks(symbols.data(), marks.data(), symbols.size());
+}
+
+bool BinanceAPI::streamPrice(MarketType type, const std::string& symbol, double& price) const {
+    const std::shared_ptr<MarketDataStream>& stream = (type == MarketType::Spot) ? spot_stream_ : futures_stream_;
+    if (!stream || !stream->isLive()) {
+        return false;
     }
     
-    if (response_code >= 400) {
-        return "{\"error\":\"HTTP 오류 " + std::to_string(response_code) + ": " + response.data + "\"}";
+    PriceSnapshot snapshot = stream->getPrice(symbol);
+    if (!snapshot.valid) {
+        return false;
     }
     
-    return response.data;
+    // 최근 체결가 우선, 없으면 호가 중간값, 선물은 마크 가격까지 사용
+    if (snapshot.lastPrice > 0) {
+        price = snapshot.lastPrice;
+    } else if (snapshot.bidPrice > 0 && snapshot.askPrice > 0) {
+        price = (snapshot.bidPrice + snapshot.askPrice) / 2.0;
+    } else if (snapshot.markPrice > 0) {
+        price = snapshot.markPrice;
+    } else {
+        return false;
+    }
+    return true;
 }
 
-std::string BinanceAPI::makeFuturesRequest(const std::string& endpoint, const std::string& method,
-                                          const std::map<std::string, std::string>& params, bool is_signed) {
-    CURL* curl = curl_easy_init();
-    CurlResponse response;
+HttpRequest BinanceAPI::prepareRequest(const std::string& base_url, const std::string& endpoint,
+                                      const std::string& method,
+                                      const std::map<std::string, std::string>& params, bool is_signed) {
+    auto build_start = std::chrono::steady_clock::now();
     
-    if (!curl) {
-        return "{\"error\":\"Failed to initialize CURL\"}";
+    // 쿼리 스트링 생성 (타임스탬프와 서명까지 들어갈 길이를 미리 예약)
+    size_t capacity = 128;
+    for (const auto& param : params) {
+        capacity += param.first.size() + param.second.size() + 2;
     }
-    
-    // 쿼리 스트링 생성
-    std::string query_string;
+    QueryBuilder query(capacity);
     for (const auto& param : params) {
-        if (!query_string.empty()) query_string += "&";
-        query_string += param.first + "=" + param.second;
+        query.append(param.first, param.second);
     }
     
     if (is_signed) {
-        if (!query_string.empty()) query_string += "&";
-        query_string += "timestamp=" + std::to_string(getCurrentTimestamp());
-        
-        std::string signature = createSignature(query_string);
-        query_string += "&signature=" + signature;
+        query.append("timestamp", getCurrentTimestamp());
+        query.appendSignature(*signer_);
+        LatencyMonitor::instance().record(endpoint, LatencyStage::Sign,
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - build_start).count());
     }
+    std::string query_string = query.release();
     
-    std::string full_url = futures_base_url_ + endpoint;
+    HttpRequest request;
+    request.url = base_url + endpoint;
+    request.method = method;
+    request.headers = headers_;
+    request.http2 = http2_enabled_;
     
     // POST 요청의 경우 데이터를 body에 넣기
     if (method == "POST" || method == "PUT") {
-        curl_easy_setopt(curl, CURLOPT_URL, full_url.c_str());
-        if (method == "POST") {
-            curl_easy_setopt(curl, CURLOPT_POST, 1L);
-        } else {
-            curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "PUT");
-        }
-        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, query_string.c_str());
-        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, query_string.length());
-    } else {
+        request.body = query_string;
+    } else if (!query_string.empty()) {
         // GET 요청의 경우 URL에 쿼리 스트링 추가
-        if (!query_string.empty()) {
-            full_url += "?" + query_string;
-        }
-        curl_easy_setopt(curl, CURLOPT_URL, full_url.c_str());
+        request.url += "?" + query_string;
     }
     
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);
-    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
-    curl_easy_setopt(curl, CURLOPT_VERBOSE, 0L);
-    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, "Binance-Trader/1.0");
-    
-    // 헤더 설정
-    struct curl_slist* headers = nullptr;
-    std::string api_key_header = "X-MBX-APIKEY: " + api_key_;
-    headers = curl_slist_append(headers, api_key_header.c_str());
-    headers = curl_slist_append(headers, "Content-Type: application/x-www-form-urlencoded");
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-    
-    CURLcode res = curl_easy_perform(curl);
-    
-    // HTTP 응답 코드 확인
-    long response_code;
-    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
-    
-    curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
+    // 실제 주문의 경우 더 짧은 타임아웃 사용
+    if (endpoint == "/api/v3/order") {
+        request.timeout = 15;  // 15초로 단축
+        request.connectTimeout = 5;  // 5초로 단축
+    } else {
+        request.timeout = 30;
+        request.connectTimeout = 10;
+    }
     
-    if (res != CURLE_OK) {
-        std::string error_msg = "선물거래 API 요청 실패: ";
-        switch (res) {
+    return request;
+}
+
+std::string BinanceAPI::handleResponse(const HttpRequest& request, const HttpResponse& response,
+                                       const std::string& error_prefix) {
+    if (response.curlCode != CURLE_OK) {
+        std::string error_msg = error_prefix;
+        switch (response.curlCode) {
+            case CURLE_FAILED_INIT:
+                return "{\"error\":\"Failed to initialize CURL\"}";
             case CURLE_OPERATION_TIMEDOUT:
-                error_msg += "타임아웃 (30초 초과)";
+                error_msg += "타임아웃 (" + std::to_string(request.timeout) + "초 초과)";
                 break;
             case CURLE_COULDNT_CONNECT:
                 error_msg += "연결 실패";
@@ -236,21 +682,105 @@ std::string BinanceAPI::makeFuturesRequest(const std::string& endpoint, const st
                 error_msg += "SSL 연결 실패";
                 break;
             default:
-                error_msg += curl_easy_strerror(res);
+                error_msg += curl_easy_strerror(response.curlCode);
                 break;
         }
         return "{\"error\":\"" + error_msg + "\"}";
     }
     
-    if (response_code >= 400) {
-        return "{\"error\":\"HTTP 오류 " + std::to_string(response_code) + ": " + response.data + "\"}";
+    if (response.statusCode >= 400) {
+        return "{\"error\":\"HTTP 오류 " + std::to_string(response.statusCode) + ": " + response.body + "\"}";
     }
     
-    return response.data;
+    return response.body;
+}
+
+std::string BinanceAPI::makeRequest(const std::string& endpoint, const std::string& method,
+                                   const std::map<std::string, std::string>& params, bool is_signed,
+                                   const std::function<bool(const char*, size_t)>& on_data) {
+    // 서명 타임스탬프가 오래되지 않도록 예산을 확보한 뒤 요청 생성
+    spot_scheduler_->acquire(RequestScheduler::endpointWeight(endpoint, params),
+                             RequestScheduler::priorityOf(endpoint, method, is_signed),
+                             RequestScheduler::orderCountOf(endpoint, method));
+    HttpRequest request = prepareRequest(base_url_, endpoint, method, params, is_signed);
+    request.onData = on_data;
+    HttpResponse response = connection_pool_->perform(request);
+    LatencyMonitor::instance().recordTransfer(endpoint, response.timings, response.reusedConnection);
+    spot_scheduler_->update(response);
+    return handleResponse(request, response, "네트워크 요청 실패: ");
+}
+
+std::string BinanceAPI::makeFuturesRequest(const std::string& endpoint, const std::string& method,
+                                          const std::map<std::string, std::string>& params, bool is_signed,
+                                          const std::function<bool(const char*, size_t)>& on_data) {
+    futures_scheduler_->acquire(RequestScheduler::endpointWeight(endpoint, params),
+                                RequestScheduler::priorityOf(endpoint, method, is_signed),
+                                RequestScheduler::orderCountOf(endpoint, method));
+    HttpRequest request = prepareRequest(futures_base_url_, endpoint, method, params, is_signed);
+    request.onData = on_data;
+    HttpResponse response = connection_pool_->perform(request);
+    LatencyMonitor::instance().recordTransfer(endpoint, response.timings, response.reusedConnection);
+    futures_scheduler_->update(response);
+    return handleResponse(request, response, "선물거래 API 요청 실패: ");
+}
+
+std::future<std::string> BinanceAPI::makeRequestAsync(const std::string& endpoint, const std::string& method,
+                                                      const std::map<std::string, std::string>& params, bool is_signed) {
+    spot_scheduler_->acquire(RequestScheduler::endpointWeight(endpoint, params),
+                             RequestScheduler::priorityOf(endpoint, method, is_signed),
+                             RequestScheduler::orderCountOf(endpoint, method));
+    HttpRequest request = prepareRequest(base_url_, endpoint, method, params, is_signed);
+    auto promise = std::make_shared<std::promise<std::string>>();
+    std::future<std::string> future = promise->get_future();
+    
+    std::shared_ptr<RequestScheduler> scheduler = spot_scheduler_;
+    async_client_->submit(request, [promise, request, scheduler, endpoint](HttpResponse response) {
+        LatencyMonitor::instance().recordTransfer(endpoint, response.timings, response.reusedConnection);
+        scheduler->update(response);
+        promise->set_value(handleResponse(request, response, "네트워크 요청 실패: "));
+    });
+    
+    return future;
+}
+
+std::future<std::string> BinanceAPI::makeFuturesRequestAsync(const std::string& endpoint, const std::string& method,
+                                                             const std::map<std::string, std::string>& params, bool is_signed,
+                                                             int order_count) {
+    futures_scheduler_->acquire(RequestScheduler::endpointWeight(endpoint, params),
+                                RequestScheduler::priorityOf(endpoint, method, is_signed),
+                                order_count >= 0 ? order_count : RequestScheduler::orderCountOf(endpoint, method));
+    HttpRequest request = prepareRequest(futures_base_url_, endpoint, method, params, is_signed);
+    auto promise = std::make_shared<std::promise<std::string>>();
+    std::future<std::string> future = promise->get_future();
+    
+    std::shared_ptr<RequestScheduler> scheduler = futures_scheduler_;
+    async_client_->submit(request, [promise, request, scheduler, endpoint](HttpResponse response) {
+        LatencyMonitor::instance().recordTransfer(endpoint, response.timings, response.reusedConnection);
+        scheduler->update(response);
+        promise->set_value(handleResponse(request, response, "선물거래 API 요청 실패: "));
+    });
+    
+    return future;
+}
+
+// 응답 도착은 전송 스레드가 처리하고, 파싱은 결과를 꺼내는 스레드에서 수행
+template <typename T, typename Parser>
+static std::future<T> deferParse(std::future<std::string> response, Parser parser) {
+    return std::async(std::launch::deferred,
+                      [response = std::move(response), parser]() mutable {
+                          return parser(response.get());
+                      });
 }
 
 AccountInfo BinanceAPI::getAccountInfo() {
+    // 사용자 데이터 스트림이 연결되어 있으면 저장소에서 응답
+    if (isUserDataStreamLive(MarketType::Spot)) {
+        return account_store_->getAccountInfo();
+    }
+    
     AccountInfo info;
+    info.btcBalance = 0.0;
+    info.usdtBalance = 0.0;
     
     std::string response = makeRequest("/api/v3/account", "GET", {}, true);
     
@@ -261,22 +791,13 @@ AccountInfo BinanceAPI::getAccountInfo() {
     }
     
     // balances 배열에서 BTC와 USDT 잔고 찾기
-    size_t balances_pos = response.find("\"balances\"");
-    if (balances_pos != std::string::npos) {
-        size_t btc_pos = response.find("\"asset\":\"BTC\"", balances_pos);
-        if (btc_pos != std::string::npos) {
-            size_t free_pos = response.find("\"free\":", btc_pos);
-            if (free_pos != std::string::npos) {
-                info.btcBalance = JSONParser::extractDouble(response.substr(free_pos - 20, 100), "free");
-            }
-        }
-        
-        size_t usdt_pos = response.find("\"asset\":\"USDT\"", balances_pos);
-        if (usdt_pos != std::string::npos) {
-            size_t free_pos = response.find("\"free\":", usdt_pos);
-            if (free_pos != std::string::npos) {
-                info.usdtBalance = JSONParser::extractDouble(response.substr(free_pos - 20, 100), "free");
-            }
+    JSONDocument doc(response);
+    for (JSONValue balance : doc.root()["balances"]) {
+        std::string_view asset = balance["asset"].raw();
+        if (asset == "BTC") {
+            info.btcBalance = balance["free"].asDouble();
+        } else if (asset == "USDT") {
+            info.usdtBalance = balance["free"].asDouble();
         }
     }
     
@@ -284,99 +805,290 @@ AccountInfo BinanceAPI::getAccountInfo() {
     return info;
 }
 
+// batchOrders / symbols 파라미터 값은 URL 인코딩된 JSON 배열
+static std::string urlEncode(const std::string& value) {
+    static const char hex[] = "0123456789ABCDEF";
+    std::string encoded;
+    encoded.reserve(value.length() * 3);
+    
+    for (unsigned char c : value) {
+        if (std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+            encoded += static_cast<char>(c);
+        } else {
+            encoded += '%';
+            encoded += hex[c >> 4];
+            encoded += hex[c & 0x0F];
+        }
+    }
+    return encoded;
+}
+
 MarketPrice BinanceAPI::getCurrentPrice(const std::string& symbol) {
-    MarketPrice price_info;
-    price_info.symbol = symbol;
+    // 스트림이 연결되어 있으면 최신 시세 테이블에서 바로 반환
+    MarketPrice streamed;
+    if (streamPrice(MarketType::Spot, symbol, streamed.price)) {
+        streamed.symbol = symbol;
+        streamed.success = true;
+        return streamed;
+    }
     
     std::map<std::string, std::string> params;
     params["symbol"] = symbol;
     
     std::string response = makeRequest("/api/v3/ticker/price", "GET", params, false);
+    return parseCurrentPrice(symbol, response);
+}
+
+std::future<MarketPrice> BinanceAPI::getCurrentPriceAsync(const std::string& symbol) {
+    MarketPrice streamed;
+    if (streamPrice(MarketType::Spot, symbol, streamed.price)) {
+        streamed.symbol = symbol;
+        streamed.success = true;
+        std::promise<MarketPrice> ready;
+        ready.set_value(streamed);
+        return ready.get_future();
+    }
     
-    if (response.find("\"error\"") != std::string::npos) {
-        price_info.success = false;
-        price_info.error = JSONParser::extractString(response, "error");
-        return price_info;
+    std::map<std::string, std::string> params;
+    params["symbol"] = symbol;
+    
+    return deferParse<MarketPrice>(makeRequestAsync("/api/v3/ticker/price", "GET", params, false),
+                                   [symbol](const std::string& response) {
+                                       return parseCurrentPrice(symbol, response);
+                                   });
+}
+
+std::future<MarketPrice> BinanceAPI::getFuturesPriceAsync(const std::string& symbol) {
+    MarketPrice cached;
+    cached.symbol = symbol;
+    cached.success = streamPrice(MarketType::Futures, symbol, cached.price);
+    if (!cached.success) {
+        std::shared_ptr<const OrderBook> book = getOrderBook(MarketType::Futures, symbol);
+        BookTop top = book ? book->top() : BookTop();
+        if (book && top.synced && top.bid.price.isPositive() && top.ask.price.isPositive()) {
+            cached.price = (top.bid.price.toDouble() + top.ask.price.toDouble()) / 2.0;
+            cached.success = true;
+        }
+    }
+    if (cached.success) {
+        std::promise<MarketPrice> ready;
+        ready.set_value(cached);
+        return ready.get_future();
     }
     
-    price_info.price = JSONParser::extractDouble(response, "price");
-    price_info.success = true;
+    std::map<std::string, std::string> params;
+    params["symbol"] = symbol;
     
-    return price_info;
+    return deferParse<MarketPrice>(makeFuturesRequestAsync("/fapi/v1/ticker/price", "GET", params, false),
+                                   [symbol](const std::string& response) {
+                                       return parseCurrentPrice(symbol, response);
+                                   });
 }
 
-double BinanceAPI::getMinOrderQuantity(const std::string& symbol) {
+void BinanceAPI::getCurrentPriceAsync(const std::string& symbol, std::function<void(MarketPrice)> callback) {
+    MarketPrice streamed;
+    if (streamPrice(MarketType::Spot, symbol, streamed.price)) {
+        streamed.symbol = symbol;
+        streamed.success = true;
+        callback(streamed);
+        return;
+    }
+    
     std::map<std::string, std::string> params;
     params["symbol"] = symbol;
     
-    std::string response = makeRequest("/api/v3/exchangeInfo", "GET", params, false);
+    spot_scheduler_->acquire(RequestScheduler::endpointWeight("/api/v3/ticker/price", params), RequestPriority::Market);
+    HttpRequest request = prepareRequest(base_url_, "/api/v3/ticker/price", "GET", params, false);
     
-    // symbols 배열에서 해당 심볼의 필터 정보 찾기
-    size_t symbol_pos = response.find("\"symbol\":\"" + symbol + "\"");
-    if (symbol_pos != std::string::npos) {
-        size_t filters_pos = response.find("\"filters\"", symbol_pos);
-        if (filters_pos != std::string::npos) {
-            size_t lot_size_pos = response.find("\"filterType\":\"LOT_SIZE\"", filters_pos);
-            if (lot_size_pos != std::string::npos) {
-                return JSONParser::extractDouble(response.substr(lot_size_pos, 200), "minQty");
-            }
+    std::shared_ptr<RequestScheduler> scheduler = spot_scheduler_;
+    async_client_->submit(request, [symbol, request, callback, scheduler](HttpResponse response) {
+        LatencyMonitor::instance().recordTransfer("/api/v3/ticker/price", response.timings, response.reusedConnection);
+        scheduler->update(response);
+        callback(parseCurrentPrice(symbol, handleResponse(request, response, "네트워크 요청 실패: ")));
+    });
+}
+
+MarketPriceTable BinanceAPI::getPrices(const std::vector<std::string>& symbols, MarketType type) {
+    MarketPriceTable table;
+    table.market = type;
+    table.success = true;
+    if (symbols.empty()) {
+        return table;
+    }
+    
+    // 요청한 심볼 ID (중복 제거, 처음 보는 이름이면 등록)
+    SymbolTable& names = SymbolTable::instance();
+    std::vector<SymbolId> ids;
+    std::vector<bool> wanted;
+    for (const auto& symbol : symbols) {
+        SymbolId id = names.intern(symbol);
+        if (id >= wanted.size()) {
+            wanted.resize(id + 1, false);
+        }
+        if (!wanted[id]) {
+            wanted[id] = true;
+            ids.push_back(id);
+        }
+    }
+    
+    // 모두 스트림에 있으면 요청하지 않음
+    table.prices.assign(wanted.size(), 0.0);
+    bool streamed = true;
+    for (SymbolId id : ids) {
+        if (!streamPrice(type, names.name(id), table.prices[id])) {
+            streamed = false;
+            break;
         }
+        table.symbols.push_back(id);
+    }
+    if (streamed) {
+        return table;
     }
     
-    return 0.00001; // 기본값
+    std::map<std::string, std::string> params;
+    if (type == MarketType::Spot) {
+        std::string list = "[";
+        for (size_t i = 0; i < ids.size(); i++) {
+            if (i > 0) list += ',';
+            list += '"';
+            list += names.name(ids[i]);
+            list += '"';
+        }
+        list += ']';
+        params["symbols"] = urlEncode(list);
+        
+        // 목록에 거래 중지된 심볼이 하나라도 있으면 요청 전체가 거절되므로 전체 조회로 다시 받음 (가중치 동일)
+        // 네트워크 오류, 타임아웃, 429 등은 다시 보내도 같은 결과이거나 한도를 더 소모하므로 그대로 반환
+        bool list_rejected = false;
+        table = fetchPriceTable(type, params, wanted, &list_rejected);
+        if (table.success || !list_rejected) {
+            return table;
+        }
+        params.clear();
+    }
+    return fetchPriceTable(type, params, wanted);
 }
 
-double BinanceAPI::adjustQuantityForLotSize(const std::string& symbol, double quantity) {
-    std::map<std::string, std::string> params;
-    params["symbol"] = symbol;
+MarketPriceTable BinanceAPI::getAllPrices(MarketType type) {
+    return fetchPriceTable(type, {}, {});
+}
+
+MarketPriceTable BinanceAPI::fetchPriceTable(MarketType type, const std::map<std::string, std::string>& params,
+                                             const std::vector<bool>& wanted, bool* list_rejected) {
+    MarketPriceTable table;
+    table.market = type;
+    table.success = false;
+    
+    SymbolTable& names = SymbolTable::instance();
+    table.prices.assign(std::max(names.size(), wanted.size()), 0.0);
+    
+    // 응답 배열을 수신하면서 원소마다 ID를 찾아 가격 기록 (원소당 해시 조회 한 번, 중간 객체 없음)
+    JSONArrayStream stream("", [&](JSONValue ticker) {
+        std::string_view symbol = ticker["symbol"].raw();
+        SymbolId id = wanted.empty() ? names.intern(symbol) : names.find(symbol);
+        if (id == INVALID_SYMBOL_ID || (!wanted.empty() && (id >= wanted.size() || !wanted[id]))) {
+            return true;
+        }
+        if (id >= table.prices.size()) {
+            table.prices.resize(id + 1, 0.0);
+        }
+        if (table.prices[id] == 0.0) {
+            table.symbols.push_back(id);
+        }
+        table.prices[id] = ticker["price"].asDouble();
+        return true;
+    });
+    auto on_data = [&stream](const char* data, size_t length) {
+        return stream.feed(data, length);
+    };
+    std::string response = (type == MarketType::Spot)
+        ? makeRequest("/api/v3/ticker/price", "GET", params, false, on_data)
+        : makeFuturesRequest("/fapi/v1/ticker/price", "GET", params, false, on_data);
+    
+    if (stream.failed()) {
+        table.error = "시세 응답을 해석할 수 없습니다";
+    } else if (response.find("\"error\"") != std::string::npos) {
+        table.error = JSONParser::extractString(response, "error");
+        if (list_rejected) {
+            *list_rejected = response.find("\"code\":-1121") != std::string::npos ||
+                             response.find("\"code\":-1100") != std::string::npos;
+        }
+    } else if (!stream.finished()) {
+        table.error = "시세 응답을 찾을 수 없습니다";
+    } else {
+        table.success = true;
+    }
+    
+    if (!table.success) {
+        table.prices.clear();
+        table.symbols.clear();
+    }
+    return table;
+}
+
+MarketPrice BinanceAPI::parseCurrentPrice(const std::string& symbol, const std::string& response) {
+    LatencyTimer timer("/api/v3/ticker/price", LatencyStage::Parse);
+    MarketPrice price_info;
+    price_info.symbol = symbol;
+    
+    if (response.find("\"error\"") != std::string::npos) {
+        price_info.success = false;
+        price_info.error = JSONParser::extractString(response, "error");
+        return price_info;
+    }
+    
+    JSONDocument doc(response);
+    price_info.price = doc.root()["price"].asDouble();
+    price_info.success = true;
     
-    std::string response = makeRequest("/api/v3/exchangeInfo", "GET", params, false);
+    return price_info;
+}
+
+Decimal BinanceAPI::getMinOrderQuantity(const std::string& symbol) {
+    SymbolInfo info;
+    if (getSymbolInfo(MarketType::Spot, symbol, info)) {
+        return info.minQty;
+    }
     
+    return Decimal::fromRaw(1000); // 기본값 0.00001
+}
+
+std::future<Decimal> BinanceAPI::getMinOrderQuantityAsync(const std::string& symbol) {
+    // 심볼 캐시가 아직 비어 있으면 첫 로드를 별도 스레드에서 수행
+    BinanceAPI api = *this;
+    return std::async(std::launch::async, [api, symbol]() mutable {
+        return api.getMinOrderQuantity(symbol);
+    });
+}
+
+Decimal BinanceAPI::adjustQuantityForLotSize(const std::string& symbol, Decimal quantity) {
     // LOT_SIZE 필터 정보 찾기
-    size_t symbol_pos = response.find("\"symbol\":\"" + symbol + "\"");
-    if (symbol_pos != std::string::npos) {
-        size_t filters_pos = response.find("\"filters\"", symbol_pos);
-        if (filters_pos != std::string::npos) {
-            size_t lot_size_pos = response.find("\"filterType\":\"LOT_SIZE\"", filters_pos);
-            if (lot_size_pos != std::string::npos) {
-                std::string filter_section = response.substr(lot_size_pos, 300);
-                
-                double minQty = JSONParser::extractDouble(filter_section, "minQty");
-                double stepSize = JSONParser::extractDouble(filter_section, "stepSize");
-                
-                std::cout << "LOT_SIZE 필터 정보:" << std::endl;
-                std::cout << "  최소 수량: " << std::fixed << std::setprecision(8) << minQty << std::endl;
-                std::cout << "  단위 크기: " << std::fixed << std::setprecision(8) << stepSize << std::endl;
-                
-                // stepSize가 0이면 기본값 사용
-                if (stepSize <= 0) {
-                    stepSize = 0.00001;
-                }
-                
-                // 최소 수량보다 작으면 최소 수량 사용
-                if (quantity < minQty) {
-                    quantity = minQty;
-                }
-                
-                // stepSize의 배수로 조정
-                double adjusted = std::floor(quantity / stepSize) * stepSize;
-                
-                // 조정된 수량이 최소 수량보다 작으면 한 단계 올림
-                if (adjusted < minQty) {
-                    adjusted = std::ceil(minQty / stepSize) * stepSize;
-                }
-                
-                // 원래 수량보다 작아졌다면 한 단계 올림 (NOTIONAL 필터 고려)
-                if (adjusted < quantity) {
-                    adjusted = std::ceil(quantity / stepSize) * stepSize;
-                }
-                
-                std::cout << "  원래 수량: " << std::fixed << std::setprecision(8) << quantity << std::endl;
-                std::cout << "  조정된 수량: " << std::fixed << std::setprecision(8) << adjusted << std::endl;
-                
-                return adjusted;
-            }
+    SymbolInfo info;
+    if (getSymbolInfo(MarketType::Spot, symbol, info)) {
+        Decimal minQty = info.minQty;
+        Decimal stepSize = info.stepSize;
+        
+        std::cout << "LOT_SIZE 필터 정보:" << std::endl;
+        std::cout << "  최소 수량: " << minQty << std::endl;
+        std::cout << "  단위 크기: " << stepSize << std::endl;
+        
+        // stepSize가 0이면 기본값 사용
+        if (!stepSize.isPositive()) {
+            stepSize = Decimal::fromRaw(1000);
         }
+        
+        // 최소 수량보다 작으면 최소 수량 사용
+        if (quantity < minQty) {
+            quantity = minQty;
+        }
+        
+        // stepSize의 배수로 올림 (원래 수량보다 작아지면 NOTIONAL 필터를 못 맞출 수 있음)
+        Decimal adjusted = quantity.ceilToStep(stepSize);
+        
+        std::cout << "  원래 수량: " << quantity << std::endl;
+        std::cout << "  조정된 수량: " << adjusted << std::endl;
+        
+        return adjusted;
     }
     
     return quantity; // 필터 정보를 찾을 수 없으면 원래 수량 반환
@@ -385,7 +1097,14 @@ double BinanceAPI::adjustQuantityForLotSize(const std::string& symbol, double qu
 bool BinanceAPI::checkApiPermissions() {
     // API 키 권한 확인을 위해 계정 정보 조회 시도
     std::string response = makeRequest("/api/v3/account", "GET", {}, true);
-    
+    return parseApiPermissions(response);
+}
+
+std::future<bool> BinanceAPI::checkApiPermissionsAsync() {
+    return deferParse<bool>(makeRequestAsync("/api/v3/account", "GET", {}, true), parseApiPermissions);
+}
+
+bool BinanceAPI::parseApiPermissions(const std::string& response) {
     if (response.find("\"error\"") != std::string::npos || response.find("\"code\"") != std::string::npos) {
         std::cout << "API 권한 확인 실패: " << response << std::endl;
         return false;
@@ -395,16 +1114,18 @@ bool BinanceAPI::checkApiPermissions() {
     std::cout << "API 권한 확인 성공" << std::endl;
     
     // 권한 정보 추출
-    if (response.find("\"canTrade\":true") != std::string::npos) {
+    JSONDocument doc(response);
+    JSONValue can_trade = doc.root()["canTrade"];
+    if (can_trade.asBool()) {
         std::cout << "✅ 거래 권한: 활성화됨" << std::endl;
-    } else if (response.find("\"canTrade\":false") != std::string::npos) {
+    } else if (can_trade.type() == JSONType::Bool) {
         std::cout << "❌ 거래 권한: 비활성화됨 - 바이낸스에서 Spot Trading 권한을 활성화하세요!" << std::endl;
         return false;
     } else {
         std::cout << "⚠️  거래 권한 상태를 확인할 수 없습니다." << std::endl;
     }
     
-    if (response.find("\"canWithdraw\":true") != std::string::npos) {
+    if (doc.root()["canWithdraw"].asBool()) {
         std::cout << "✅ 출금 권한: 활성화됨" << std::endl;
     } else {
         std::cout << "ℹ️  출금 권한: 비활성화됨 (거래에는 영향 없음)" << std::endl;
@@ -413,12 +1134,12 @@ bool BinanceAPI::checkApiPermissions() {
     return true;
 }
 
-OrderResponse BinanceAPI::testOrder(const std::string& side, double quantity) {
+OrderResponse BinanceAPI::testOrder(const std::string& side, Decimal quantity) {
     OrderResponse order;
     order.symbol = "BTCUSDT";
     order.side = side;
     
-    std::cout << "테스트 주문 요청 준비 중... (" << side << " " << std::fixed << std::setprecision(8) << quantity << " BTC)" << std::endl;
+    std::cout << "테스트 주문 요청 준비 중... (" << side << " " << quantity << " BTC)" << std::endl;
     
     // 먼저 현재 가격 조회로 API 연결 확인
     std::cout << "현재 가격 조회 중..." << std::endl;
@@ -445,7 +1166,7 @@ OrderResponse BinanceAPI::testOrder(const std::string& side, double quantity) {
     
     // 잔고 확인
     if (side == "BUY") {
-        double requiredUsdt = quantity * price.price;
+        double requiredUsdt = quantity.toDouble() * price.price;
         std::cout << "필요 USDT: " << std::fixed << std::setprecision(2) << requiredUsdt << std::endl;
         std::cout << "보유 USDT: " << std::fixed << std::setprecision(2) << account.usdtBalance << std::endl;
         
@@ -455,12 +1176,12 @@ OrderResponse BinanceAPI::testOrder(const std::string& side, double quantity) {
             return order;
         }
     } else if (side == "SELL") {
-        std::cout << "필요 BTC: " << std::fixed << std::setprecision(8) << quantity << std::endl;
+        std::cout << "필요 BTC: " << quantity << std::endl;
         std::cout << "보유 BTC: " << std::fixed << std::setprecision(8) << account.btcBalance << std::endl;
         
-        if (account.btcBalance < quantity) {
+        if (account.btcBalance < quantity.toDouble()) {
             order.success = false;
-            order.error = "잔고 부족: " + std::to_string(quantity - account.btcBalance) + " BTC 부족";
+            order.error = "잔고 부족: " + std::to_string(quantity.toDouble() - account.btcBalance) + " BTC 부족";
             return order;
         }
     }
@@ -468,227 +1189,214 @@ OrderResponse BinanceAPI::testOrder(const std::string& side, double quantity) {
     // 테스트 성공
     order.success = true;
     order.status = "TEST_SUCCESS";
-    order.quantity = quantity;
+    order.quantity = quantity.toDouble();
     
     return order;
 }
 
-bool BinanceAPI::testConnection() {
-    std::cout << "바이낸스 서버 연결 테스트 중..." << std::endl;
-    
-    // 단순한 서버 시간 조회 (인증 불필요)
-    std::string response = makeRequest("/api/v3/time", "GET", {}, false);
-    
-    if (response.empty()) {
-        std::cout << "❌ 연결 실패: 응답 없음" << std::endl;
-        return false;
-    }
-    
-    if (response.find("\"error\"") != std::string::npos) {
-        std::cout << "❌ 연결 실패: " << response << std::endl;
-        return false;
-    }
+OrderResponse BinanceAPI::cancelSpotOrder(const std::string& symbol, const std::string& orderId) {
+    OrderResponse order;
+    order.symbol = symbol;
+    order.orderId = orderId;
     
-    if (response.find("serverTime") != std::string::npos) {
-        std::cout << "✅ 바이낸스 서버 연결 성공" << std::endl;
-        return true;
-    }
+    std::map<std::string, std::string> params;
+    params["symbol"] = symbol;
+    params["orderId"] = orderId;
     
-    std::cout << "⚠️  예상하지 못한 응답: " << response << std::endl;
-    return false;
+    parseSpotOrderResult(makeOrderRequest(MarketType::Spot, "order.cancel", "DELETE", params), order);
+    return order;
 }
 
-OrderResponse BinanceAPI::buyBitcoin(double quantity) {
+OrderResponse BinanceAPI::getSpotOrderStatus(const std::string& symbol, const std::string& orderId) {
     OrderResponse order;
-    order.symbol = "BTCUSDT";
-    order.side = "BUY";
-    
-    std::cout << "=== 실제 구매 주문 시작 ===" << std::endl;
-    std::cout << "주문 수량: " << std::fixed << std::setprecision(8) << quantity << " BTC" << std::endl;
-    
-    // 현재 시간 확인
-    long long timestamp = getCurrentTimestamp();
-    std::cout << "현재 타임스탬프: " << timestamp << std::endl;
+    order.symbol = symbol;
+    order.orderId = orderId;
     
     std::map<std::string, std::string> params;
-    params["symbol"] = "BTCUSDT";
-    params["side"] = "BUY";
-    params["type"] = "MARKET";
-    
-    // 수량을 8자리 소수점으로 포맷팅
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(8) << quantity;
-    params["quantity"] = ss.str();
-    
-    std::cout << "주문 파라미터:" << std::endl;
-    for (const auto& param : params) {
-        std::cout << "  " << param.first << " = " << param.second << std::endl;
-    }
-    
-    std::cout << "\n바이낸스 API 호출 시작..." << std::endl;
-    
-    // 한 번만 시도 (재시도 제거)
-    std::string response = makeRequest("/api/v3/order", "POST", params, true);
-    
-    std::cout << "API 호출 완료!" << std::endl;
-    std::cout << "응답 수신됨 (길이: " << response.length() << " 바이트)" << std::endl;
-    
-    // 응답이 비어있는지 확인
-    if (response.empty()) {
-        std::cout << "❌ 빈 응답 수신" << std::endl;
-        order.success = false;
-        order.error = "API 응답 없음";
-        return order;
-    }
-    
-    // 응답 내용 출력 (처음 500자만)
-    std::cout << "API 응답 내용: " << response.substr(0, std::min(500, (int)response.length())) << std::endl;
+    params["symbol"] = symbol;
+    params["orderId"] = orderId;
     
-    // 오류 응답 확인
+    parseSpotOrderResult(makeOrderRequest(MarketType::Spot, "order.status", "GET", params), order);
+    return order;
+}
+
+void BinanceAPI::parseSpotOrderResult(const std::string& response, OrderResponse& order) {
+    LatencyTimer timer("/api/v3/order", LatencyStage::Parse);
     if (response.find("\"error\"") != std::string::npos || response.find("\"code\"") != std::string::npos) {
-        std::cout << "❌ 오류 응답 감지" << std::endl;
         order.success = false;
         
-        // 오류 메시지 추출
         std::string error_msg = JSONParser::extractString(response, "msg");
         if (error_msg.empty()) {
             error_msg = JSONParser::extractString(response, "error");
         }
         
-        // 오류 코드 확인
         std::string error_code = JSONParser::extractString(response, "code");
         if (!error_code.empty()) {
             error_msg = "오류 코드 " + error_code + ": " + error_msg;
         }
         
-        if (error_msg.empty()) {
-            error_msg = "알 수 없는 오류: " + response;
-        }
-        
         order.error = error_msg;
-        std::cout << "오류 내용: " << order.error << std::endl;
-        return order;
+        return;
     }
     
-    // 성공 응답 처리
-    std::cout << "✅ 주문 성공적으로 처리됨!" << std::endl;
+    JSONDocument doc(response);
+    std::string decode_error;
+    order.quantity = 0.0;
+    order.price = 0.0;
+    if (!decodeJSON<SpotOrderSchema>(doc.root(), order, decode_error)) {
+        order.success = false;
+        order.error = "주문 응답 해석 실패: " + decode_error;
+        return;
+    }
     
-    order.orderId = JSONParser::extractString(response, "orderId");
-    order.status = JSONParser::extractString(response, "status");
-    order.quantity = JSONParser::extractDouble(response, "executedQty");
+    // 체결된 경우 평균 체결가, 아니면 주문 가격
+    double quote = doc.root()["cummulativeQuoteQty"].asDouble();
+    if (order.quantity > 0 && quote > 0) {
+        order.price = quote / order.quantity;
+    }
     order.success = true;
-    
-    std::cout << "주문 ID: " << order.orderId << std::endl;
-    std::cout << "주문 상태: " << order.status << std::endl;
-    std::cout << "실행 수량: " << std::fixed << std::setprecision(8) << order.quantity << " BTC" << std::endl;
-    
-    return order;
 }
 
-OrderResponse BinanceAPI::sellBitcoin(double quantity) {
-    OrderResponse order;
-    order.symbol = "BTCUSDT";
-    order.side = "SELL";
-    
-    std::cout << "실제 판매 주문을 준비하는 중..." << std::endl;
-    
-    std::map<std::string, std::string> params;
-    params["symbol"] = "BTCUSDT";
-    params["side"] = "SELL";
-    params["type"] = "MARKET";
-    
-    // 수량을 8자리 소수점으로 포맷팅
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(8) << quantity;
-    params["quantity"] = ss.str();
-    
-    std::cout << "바이낸스 API 호출 중... (최대 15초 대기)" << std::endl;
-    std::cout << "주문 정보: " << params["side"] << " " << params["quantity"] << " " << params["symbol"] << std::endl;
+bool BinanceAPI::testConnection() {
+    std::cout << "바이낸스 서버 연결 테스트 중..." << std::endl;
     
-    // 재시도 메커니즘 (최대 2번 시도)
-    std::string response;
-    int max_retries = 2;
+    // 단순한 서버 시간 조회 (인증 불필요)
+    std::string response = makeRequest("/api/v3/time", "GET", {}, false);
     
-    for (int attempt = 1; attempt <= max_retries; attempt++) {
-        if (attempt > 1) {
-            std::cout << "재시도 중... (" << attempt << "/" << max_retries << ")" << std::endl;
-        }
-        
-        response = makeRequest("/api/v3/order", "POST", params, true);
-        
-        // 타임아웃이 아닌 경우 재시도 중단
-        if (response.find("타임아웃") == std::string::npos) {
-            break;
-        }
-        
-        if (attempt < max_retries) {
-            std::cout << "⚠️  타임아웃 발생, 2초 후 재시도..." << std::endl;
-            std::this_thread::sleep_for(std::chrono::seconds(2));
-        }
+    if (response.empty()) {
+        std::cout << "❌ 연결 실패: 응답 없음" << std::endl;
+        return false;
     }
     
-    std::cout << "API 호출 완료!" << std::endl;
-    
-    // 응답이 비어있는지 확인
-    if (response.empty()) {
-        std::cout << "❌ API 응답이 비어있습니다." << std::endl;
-        order.success = false;
-        order.error = "API 응답 없음 - 네트워크 연결을 확인하세요";
-        return order;
+    if (response.find("\"error\"") != std::string::npos) {
+        std::cout << "❌ 연결 실패: " << response << std::endl;
+        return false;
     }
     
-    // 타임아웃 확인
-    if (response.find("타임아웃") != std::string::npos) {
-        std::cout << "❌ 주문 타임아웃 발생" << std::endl;
-        order.success = false;
-        order.error = "주문 타임아웃 - 바이낸스 서버 응답 지연";
-        return order;
+    if (response.find("serverTime") != std::string::npos) {
+        std::cout << "✅ 바이낸스 서버 연결 성공" << std::endl;
+        return true;
     }
     
-    // 디버깅: 응답 출력
-    std::cout << "API 응답 길이: " << response.length() << " 바이트" << std::endl;
-    std::cout << "API 응답: " << response << std::endl;
+    std::cout << "⚠️  예상하지 못한 응답: " << response << std::endl;
+    return false;
+}
+
+bool BinanceAPI::buildSpotOrderParams(const std::string& symbol, const std::string& side, const std::string& type,
+                                      Decimal quantity, Decimal price, const std::string& timeInForce,
+                                      const std::string& newClientOrderId, std::map<std::string, std::string>& params,
+                                      OrderResponse& order) {
+    order.symbol = symbol;
+    order.side = side;
+    order.success = false;
     
-    // 오류 응답 확인
-    if (response.find("\"error\"") != std::string::npos || response.find("\"code\"") != std::string::npos) {
-        order.success = false;
-        
-        // 오류 메시지 추출
-        std::string error_msg = JSONParser::extractString(response, "msg");
-        if (error_msg.empty()) {
-            error_msg = JSONParser::extractString(response, "error");
+    OrderFilterRequest check;
+    if (!fromString(side, check.side) || !fromString(type, check.type)) {
+        order.error = "지원하지 않는 주문 방향/유형입니다: " + side + " " + type;
+        return false;
+    }
+    check.quantity = quantity;
+    check.price = price;
+    
+    // 캐시된 필터로 검증하고 가격/수량을 단위에 맞춤 (심볼 정보가 없으면 거래소 검증에 맡김)
+    SymbolInfo symbolInfo;
+    if (getSymbolInfo(MarketType::Spot, symbol, symbolInfo)) {
+        double reference = 0.0;
+        if (streamPrice(MarketType::Spot, symbol, reference)) {
+            check.referencePrice = Decimal::fromDouble(reference);
         }
+        check.openOrders = openOrderCount(MarketType::Spot, symbol);
         
-        // 오류 코드 확인
-        std::string error_code = JSONParser::extractString(response, "code");
-        if (!error_code.empty()) {
-            error_msg = "오류 코드 " + error_code + ": " + error_msg;
+        OrderFilterResult filtered = applyOrderFilters(symbolInfo, check);
+        if (filtered.error != FilterError::None) {
+            order.error = filterErrorMessage(filtered.error);
+            return false;
         }
-        
-        if (error_msg.empty()) {
-            error_msg = "API 오류: " + response;
+        quantity = filtered.quantity;
+        price = filtered.price;
+    }
+    
+    params["symbol"] = symbol;
+    params["side"] = side;
+    params["type"] = type;
+    params["quantity"] = quantity.toString();
+    if (orderTypeHasPrice(check.type)) {
+        params["price"] = price.toString();
+        // LIMIT_MAKER는 시간 조건을 받지 않음
+        if (check.type != OrderType::LimitMaker) {
+            params["timeInForce"] = timeInForce;
         }
-        
-        order.error = error_msg;
-        std::cout << "❌ 주문 실패: " << order.error << std::endl;
+    }
+    if (!newClientOrderId.empty()) {
+        params["newClientOrderId"] = newClientOrderId;
+    }
+    return true;
+}
+
+OrderResponse BinanceAPI::placeSpotOrder(const std::string& symbol, const std::string& side, const std::string& type,
+                                         Decimal quantity, Decimal price, const std::string& timeInForce,
+                                         const std::string& newClientOrderId) {
+    OrderResponse order;
+    order.quantity = 0.0;
+    order.price = 0.0;
+    
+    std::map<std::string, std::string> params;
+    if (!buildSpotOrderParams(symbol, side, type, quantity, price, timeInForce, newClientOrderId, params, order)) {
         return order;
     }
     
-    // 성공 응답 처리
-    std::cout << "✅ 주문 성공!" << std::endl;
+    parseSpotOrderResult(makeOrderRequest(MarketType::Spot, "order.place", "POST", params), order);
+    return order;
+}
+
+OrderResponse BinanceAPI::testSpotOrder(const std::string& symbol, const std::string& side, const std::string& type,
+                                        Decimal quantity, Decimal price, const std::string& timeInForce,
+                                        const std::string& newClientOrderId) {
+    OrderResponse order;
+    order.quantity = 0.0;
+    order.price = 0.0;
+    
+    std::map<std::string, std::string> params;
+    if (!buildSpotOrderParams(symbol, side, type, quantity, price, timeInForce, newClientOrderId, params, order)) {
+        return order;
+    }
     
-    order.orderId = JSONParser::extractString(response, "orderId");
-    order.status = JSONParser::extractString(response, "status");
-    order.quantity = JSONParser::extractDouble(response, "executedQty");
-    order.success = true;
+    // 테스트 주문은 성공 시 빈 객체({})를 반환
+    std::string response = makeRequest("/api/v3/order/test", "POST", params, true);
+    if (response.find("\"code\"") != std::string::npos || response.find("\"error\"") != std::string::npos) {
+        parseSpotOrderResult(response, order);
+        return order;
+    }
     
+    order.success = true;
+    order.status = "TEST_SUCCESS";
+    Decimal tested;
+    if (Decimal::parse(params["quantity"], tested)) {
+        order.quantity = tested.toDouble();
+    }
     return order;
 }
 
+OrderResponse BinanceAPI::buyBitcoin(Decimal quantity) {
+    return placeSpotOrder("BTCUSDT", "BUY", "MARKET", quantity);
+}
+
+OrderResponse BinanceAPI::sellBitcoin(Decimal quantity) {
+    return placeSpotOrder("BTCUSDT", "SELL", "MARKET", quantity);
+}
+
 // === 선물거래 기능 구현 ===
 
 FuturesAccountInfo BinanceAPI::getFuturesAccountInfo() {
+    if (isUserDataStreamLive(MarketType::Futures)) {
+        // 미실현 손익은 포지션 저장소가 마크 가격 틱마다 다시 계산한 합계
+        refreshPositionMarks();
+        return account_store_->getFuturesAccountInfo();
+    }
+    
     FuturesAccountInfo info;
+    info.usdtCrossWalletBalance = 0.0;
+    info.hasUsdtCrossWallet = false;
     
     std::string response = makeFuturesRequest("/fapi/v2/account", "GET", {}, true);
     
@@ -698,70 +1406,99 @@ FuturesAccountInfo BinanceAPI::getFuturesAccountInfo() {
         return info;
     }
     
-    info.totalWalletBalance = JSONParser::extractDouble(response, "totalWalletBalance");
-    info.totalUnrealizedPnl = JSONParser::extractDouble(response, "totalUnrealizedPnl");
-    info.totalMarginBalance = JSONParser::extractDouble(response, "totalMarginBalance");
-    info.availableBalance = JSONParser::extractDouble(response, "availableBalance");
-    info.maxWithdrawAmount = JSONParser::extractDouble(response, "maxWithdrawAmount");
+    JSONDocument doc(response);
+    std::string decode_error;
+    if (!decodeJSON<FuturesAccountSchema>(doc.root(), info, decode_error)) {
+        info.success = false;
+        info.error = "계정 응답 해석 실패: " + decode_error;
+        return info;
+    }
+    
+    // 사용자 데이터 스트림의 ACCOUNT_UPDATE는 자산별 crossWalletBalance를 보내므로 같은 기준값을 보관
+    for (JSONValue asset : doc.root()["assets"]) {
+        if (asset["asset"].raw() == "USDT") {
+            info.usdtCrossWalletBalance = asset["crossWalletBalance"].asDouble();
+            info.hasUsdtCrossWallet = true;
+            break;
+        }
+    }
     info.success = true;
     
     return info;
 }
 
-std::vector<FuturesPosition> BinanceAPI::getFuturesPositions() {
-    std::vector<FuturesPosition> positions;
+// positionRisk 항목 하나를 포지션으로 변환 (필드 누락/형식 오류 시 success = false)
+static void parsePositionRisk(JSONValue data, FuturesPosition& position) {
+    position.leverage = 0;
+    std::string decode_error;
+    if (!decodeJSON<FuturesPositionSchema>(data, position, decode_error)) {
+        position.success = false;
+        position.error = "포지션 응답 해석 실패: " + decode_error;
+        return;
+    }
     
-    std::string response = makeFuturesRequest("/fapi/v2/positionRisk", "GET", {}, true);
+    // 수익률 계산
+    if (position.entryPrice > 0) {
+        position.percentage = ((position.markPrice - position.entryPrice) / position.entryPrice) * 100.0;
+        if (position.positionAmt < 0) position.percentage *= -1; // 숏 포지션의 경우 반전
+    } else {
+        position.percentage = 0.0;
+    }
     
-    if (response.find("\"error\"") != std::string::npos) {
-        FuturesPosition error_pos;
-        error_pos.success = false;
-        error_pos.error = JSONParser::extractString(response, "error");
-        positions.push_back(error_pos);
-        return positions;
+    position.success = true;
+}
+
+std::vector<FuturesPosition> BinanceAPI::getFuturesPositions(bool include_flat) {
+    if (!include_flat && isUserDataStreamLive(MarketType::Futures)) {
+        refreshPositionMarks();
+        return account_store_->getFuturesPositions();
     }
     
-    // JSON 배열 파싱 (간단한 구현)
-    size_t pos = 0;
-    while ((pos = response.find("\"symbol\":", pos)) != std::string::npos) {
+    std::vector<FuturesPosition> positions;
+    
+    // 전체 심볼의 positionRisk 배열을 수신하면서 항목별로 변환
+    std::string decode_error;
+    JSONArrayStream stream("", [&](JSONValue position_data) {
         FuturesPosition position;
-        
-        // 해당 포지션 데이터 추출
-        size_t end_pos = response.find("}", pos);
-        if (end_pos == std::string::npos) break;
-        
-        std::string position_data = response.substr(pos - 1, end_pos - pos + 2);
-        
-        position.symbol = JSONParser::extractString(position_data, "symbol");
-        position.positionAmt = JSONParser::extractDouble(position_data, "positionAmt");
-        position.entryPrice = JSONParser::extractDouble(position_data, "entryPrice");
-        position.markPrice = JSONParser::extractDouble(position_data, "markPrice");
-        position.unRealizedProfit = JSONParser::extractDouble(position_data, "unRealizedProfit");
-        position.positionSide = JSONParser::extractString(position_data, "positionSide");
-        position.leverage = static_cast<int>(JSONParser::extractDouble(position_data, "leverage"));
-        
-        // 수익률 계산
-        if (position.entryPrice > 0) {
-            position.percentage = ((position.markPrice - position.entryPrice) / position.entryPrice) * 100.0;
-            if (position.positionAmt < 0) position.percentage *= -1; // 숏 포지션의 경우 반전
-        } else {
-            position.percentage = 0.0;
+        parsePositionRisk(position_data, position);
+        if (!position.success) {
+            decode_error = position.error;
+            return false;
         }
         
-        position.success = true;
-        
         // 포지션이 있는 경우만 추가
-        if (position.positionAmt != 0) {
+        if (include_flat || position.positionAmt != 0) {
             positions.push_back(position);
         }
-        
-        pos = end_pos;
+        return true;
+    });
+    std::string response = makeFuturesRequest("/fapi/v2/positionRisk", "GET", {}, true,
+                                              [&stream](const char* data, size_t length) {
+                                                  return stream.feed(data, length);
+                                              });
+    
+    if (response.find("\"error\"") != std::string::npos || stream.failed() || !decode_error.empty()) {
+        FuturesPosition error_pos;
+        error_pos.success = false;
+        if (!decode_error.empty()) {
+            error_pos.error = decode_error;
+        } else {
+            error_pos.error = stream.failed() ? "포지션 응답을 해석할 수 없습니다" : JSONParser::extractString(response, "error");
+        }
+        positions.clear();
+        positions.push_back(error_pos);
+        return positions;
     }
     
     return positions;
 }
 
 FuturesPosition BinanceAPI::getFuturesPosition(const std::string& symbol) {
+    if (isUserDataStreamLive(MarketType::Futures)) {
+        refreshPositionMarks();
+        return account_store_->getFuturesPosition(symbol);
+    }
+    
     FuturesPosition position;
     position.symbol = symbol;
     
@@ -777,28 +1514,11 @@ FuturesPosition BinanceAPI::getFuturesPosition(const std::string& symbol) {
     }
     
     // 첫 번째 포지션 데이터 추출 (BOTH 모드의 경우)
-    size_t pos = response.find("\"symbol\":\"" + symbol + "\"");
-    if (pos != std::string::npos) {
-        size_t end_pos = response.find("}", pos);
-        if (end_pos != std::string::npos) {
-            std::string position_data = response.substr(pos - 1, end_pos - pos + 2);
-            
-            position.positionAmt = JSONParser::extractDouble(position_data, "positionAmt");
-            position.entryPrice = JSONParser::extractDouble(position_data, "entryPrice");
-            position.markPrice = JSONParser::extractDouble(position_data, "markPrice");
-            position.unRealizedProfit = JSONParser::extractDouble(position_data, "unRealizedProfit");
-            position.positionSide = JSONParser::extractString(position_data, "positionSide");
-            position.leverage = static_cast<int>(JSONParser::extractDouble(position_data, "leverage"));
-            
-            // 수익률 계산
-            if (position.entryPrice > 0) {
-                position.percentage = ((position.markPrice - position.entryPrice) / position.entryPrice) * 100.0;
-                if (position.positionAmt < 0) position.percentage *= -1; // 숏 포지션의 경우 반전
-            } else {
-                position.percentage = 0.0;
-            }
-            
-            position.success = true;
+    JSONDocument doc(response);
+    for (JSONValue position_data : doc.root()) {
+        if (position_data["symbol"].raw() == symbol) {
+            parsePositionRisk(position_data, position);
+            break;
         }
     }
     
@@ -838,7 +1558,7 @@ bool BinanceAPI::setMarginType(const std::string& symbol, const std::string& mar
 }
 
 FuturesOrderResponse BinanceAPI::futuresMarketOrder(const std::string& symbol, const std::string& side, 
-                                                   double quantity, const std::string& positionSide) {
+                                                   Decimal quantity, const std::string& positionSide) {
     // openLongPosition/openShortPosition에서 이미 검증했으므로 여기서는 검증하지 않음
     // 직접 호출되는 경우에만 검증
     
@@ -853,44 +1573,18 @@ FuturesOrderResponse BinanceAPI::futuresMarketOrder(const std::string& symbol, c
     params["side"] = side;
     params["type"] = "MARKET";
     params["positionSide"] = positionSide;
+    params["quantity"] = quantity.toString();
     
-    // 수량을 적절한 소수점으로 포맷팅
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(3) << quantity;
-    params["quantity"] = ss.str();
-    
-    std::string response = makeFuturesRequest("/fapi/v1/order", "POST", params, true);
-    
-    if (response.find("\"error\"") != std::string::npos || response.find("\"code\"") != std::string::npos) {
-        order.success = false;
-        
-        std::string error_msg = JSONParser::extractString(response, "msg");
-        if (error_msg.empty()) {
-            error_msg = JSONParser::extractString(response, "error");
-        }
-        
-        std::string error_code = JSONParser::extractString(response, "code");
-        if (!error_code.empty()) {
-            error_msg = "오류 코드 " + error_code + ": " + error_msg;
-        }
-        
-        order.error = error_msg;
-        return order;
-    }
-    
-    order.orderId = JSONParser::extractString(response, "orderId");
-    order.clientOrderId = JSONParser::extractString(response, "clientOrderId");
-    order.status = JSONParser::extractString(response, "status");
-    order.quantity = JSONParser::extractDouble(response, "executedQty");
-    order.price = JSONParser::extractDouble(response, "avgPrice");
-    order.success = true;
+    std::string response = makeOrderRequest(MarketType::Futures, "order.place", "POST", params);
+    parseFuturesOrderResult(response, true, order);
     
     return order;
 }
 
 FuturesOrderResponse BinanceAPI::futuresLimitOrder(const std::string& symbol, const std::string& side, 
-                                                  double quantity, double price, const std::string& positionSide) {
-    // 최소주문수량 검증
+                                                  Decimal quantity, Decimal price, const std::string& positionSide,
+                                                  QuantityAdjustPolicy policy) {
+    // 최소주문수량 검증 (조정 여부는 호출자가 policy로 미리 정함)
     FuturesOrderValidation validation = validateFuturesOrderQuantity(symbol, quantity);
     
     if (!validation.error.empty()) {
@@ -900,26 +1594,32 @@ FuturesOrderResponse BinanceAPI::futuresLimitOrder(const std::string& symbol, co
         return order;
     }
     
-    if (!validation.warning.empty()) {
-        std::cout << "\n" << validation.warning << std::endl;
-        
-        if (!validation.isValid) {
-            std::cout << "\n❌ 주문을 실행할 수 없습니다. 수량을 " << validation.adjustedQuantity << "로 조정하시겠습니까? (y/N): ";
-            std::string response;
-            std::getline(std::cin, response);
-            
-            if (response != "y" && response != "Y") {
-                FuturesOrderResponse order;
-                order.success = false;
-                order.error = "사용자가 주문을 취소했습니다";
-                return order;
-            }
-            
-            quantity = validation.adjustedQuantity;
-        } else {
-            std::cout << "\n🔧 수량이 자동으로 조정되었습니다: " << validation.adjustedQuantity << std::endl;
-            quantity = validation.adjustedQuantity;
+    if (!validation.isValid && policy == QuantityAdjustPolicy::Reject) {
+        FuturesOrderResponse order;
+        order.success = false;
+        order.error = quantityBelowMinimumError(validation.adjustedQuantity);
+        return order;
+    }
+    quantity = validation.adjustedQuantity;
+    
+    // 지정가 기준으로 가격 필터 적용 (매수는 내림, 매도는 올림으로 지정 가격보다 불리해지지 않게)
+    SymbolInfo symbolInfo;
+    if (getSymbolInfo(MarketType::Futures, symbol, symbolInfo)) {
+        OrderFilterRequest request;
+        fromString(side, request.side);
+        request.type = OrderType::Limit;
+        request.quantity = quantity;
+        request.price = price;
+        request.referencePrice = validation.currentPrice;
+        OrderFilterResult filtered = applyOrderFilters(symbolInfo, request);
+        if (filtered.error != FilterError::None) {
+            FuturesOrderResponse order;
+            order.success = false;
+            order.error = filterErrorMessage(filtered.error);
+            return order;
         }
+        quantity = filtered.quantity;
+        price = filtered.price;
     }
     
     FuturesOrderResponse order;
@@ -935,15 +1635,17 @@ FuturesOrderResponse BinanceAPI::futuresLimitOrder(const std::string& symbol, co
     params["positionSide"] = positionSide;
     params["timeInForce"] = "GTC";
     
-    // 수량과 가격을 적절한 소수점으로 포맷팅
-    std::stringstream ss_qty, ss_price;
-    ss_qty << std::fixed << std::setprecision(3) << quantity;
-    ss_price << std::fixed << std::setprecision(2) << price;
-    params["quantity"] = ss_qty.str();
-    params["price"] = ss_price.str();
+    params["quantity"] = quantity.toString();
+    params["price"] = price.toString();
     
-    std::string response = makeFuturesRequest("/fapi/v1/order", "POST", params, true);
+    std::string response = makeOrderRequest(MarketType::Futures, "order.place", "POST", params);
+    parseFuturesOrderResult(response, false, order);
     
+    return order;
+}
+
+void BinanceAPI::parseFuturesOrderResult(const std::string& response, bool is_market, FuturesOrderResponse& order) {
+    LatencyTimer timer("/fapi/v1/order", LatencyStage::Parse);
     if (response.find("\"error\"") != std::string::npos || response.find("\"code\"") != std::string::npos) {
         order.success = false;
         
@@ -958,61 +1660,232 @@ FuturesOrderResponse BinanceAPI::futuresLimitOrder(const std::string& symbol, co
         }
         
         order.error = error_msg;
-        return order;
+        return;
     }
     
-    order.orderId = JSONParser::extractString(response, "orderId");
-    order.clientOrderId = JSONParser::extractString(response, "clientOrderId");
-    order.status = JSONParser::extractString(response, "status");
-    order.quantity = JSONParser::extractDouble(response, "origQty");
-    order.price = JSONParser::extractDouble(response, "price");
+    JSONDocument doc(response);
+    std::string decode_error;
+    order.quantity = 0.0;
+    order.price = 0.0;
+    bool decoded = is_market ? decodeJSON<FuturesMarketOrderSchema>(doc.root(), order, decode_error)
+                             : decodeJSON<FuturesLimitOrderSchema>(doc.root(), order, decode_error);
+    if (!decoded) {
+        order.success = false;
+        order.error = "주문 응답 해석 실패: " + decode_error;
+        return;
+    }
     order.success = true;
+}
+
+FuturesOrderResponse BinanceAPI::cancelFuturesOrder(const std::string& symbol, const std::string& orderId) {
+    FuturesOrderResponse order;
+    order.symbol = symbol;
+    order.orderId = orderId;
     
+    std::map<std::string, std::string> params;
+    params["symbol"] = symbol;
+    params["orderId"] = orderId;
+    
+    std::string response = makeOrderRequest(MarketType::Futures, "order.cancel", "DELETE", params);
+    parseFuturesOrderResult(response, false, order);
     return order;
 }
 
-FuturesOrderResponse BinanceAPI::openLongPosition(const std::string& symbol, double quantity) {
-    std::cout << "롱 포지션 진입: " << quantity << " " << symbol << std::endl;
+FuturesOrderResponse BinanceAPI::getFuturesOrderStatus(const std::string& symbol, const std::string& orderId) {
+    FuturesOrderResponse order;
+    order.symbol = symbol;
+    order.orderId = orderId;
     
-    // 최소주문수량 검증
-    FuturesOrderValidation validation = validateFuturesOrderQuantity(symbol, quantity);
+    std::map<std::string, std::string> params;
+    params["symbol"] = symbol;
+    params["orderId"] = orderId;
     
-    if (!validation.error.empty()) {
-        FuturesOrderResponse order;
-        order.success = false;
-        order.error = validation.error;
+    std::string response = makeOrderRequest(MarketType::Futures, "order.status", "GET", params);
+    JSONDocument doc(response);
+    parseFuturesOrderResult(response, doc.root()["type"].raw() == "MARKET", order);
+    return order;
+}
+
+bool BinanceAPI::normalizeFuturesOrder(const FuturesOrderRequest& request, FuturesOrderRequest& normalized,
+                                       std::string& error) {
+    normalized = request;
+    SymbolInfo symbolInfo;
+    if (!getSymbolInfo(MarketType::Futures, request.symbol, symbolInfo)) {
+        return true;  // 필터를 모르면 거래소 검증에 맡김
+    }
+    
+    OrderFilterRequest check;
+    fromString(request.side, check.side);
+    fromString(request.type, check.type);
+    check.quantity = request.quantity;
+    check.price = request.price;
+    double reference = 0.0;
+    if (streamPrice(MarketType::Futures, request.symbol, reference)) {
+        check.referencePrice = Decimal::fromDouble(reference);
+    }
+    check.openOrders = openOrderCount(MarketType::Futures, request.symbol);
+    
+    OrderFilterResult filtered = applyOrderFilters(symbolInfo, check);
+    if (filtered.error != FilterError::None) {
+        error = filterErrorMessage(filtered.error);
+        return false;
+    }
+    normalized.quantity = filtered.quantity;
+    normalized.price = filtered.price;
+    return true;
+}
+
+FuturesOrderResponse BinanceAPI::placeFuturesOrder(const FuturesOrderRequest& request) {
+    FuturesOrderResponse order;
+    order.symbol = request.symbol;
+    order.side = request.side;
+    order.positionSide = request.positionSide;
+    order.type = request.type;
+    order.timeInForce = (request.type == "LIMIT") ? request.timeInForce : "";
+    order.reduceOnly = request.reduceOnly;
+    order.success = false;
+    
+    FuturesOrderRequest normalized;
+    if (!normalizeFuturesOrder(request, normalized, order.error)) {
         return order;
     }
     
-    if (!validation.warning.empty()) {
-        std::cout << "\n" << validation.warning << std::endl;
+    std::map<std::string, std::string> params;
+    params["symbol"] = normalized.symbol;
+    params["side"] = normalized.side;
+    params["type"] = normalized.type;
+    params["positionSide"] = normalized.positionSide;
+    params["quantity"] = normalized.quantity.toString();
+    if (normalized.type == "LIMIT") {
+        params["price"] = normalized.price.toString();
+        params["timeInForce"] = normalized.timeInForce;
+    }
+    if (normalized.reduceOnly) {
+        params["reduceOnly"] = "true";
+    }
+    if (!normalized.newClientOrderId.empty()) {
+        params["newClientOrderId"] = normalized.newClientOrderId;
+    }
+    
+    std::string response = makeOrderRequest(MarketType::Futures, "order.place", "POST", params);
+    parseFuturesOrderResult(response, normalized.type == "MARKET", order);
+    return order;
+}
+
+std::vector<FuturesOrderResponse> BinanceAPI::placeFuturesOrders(const std::vector<FuturesOrderRequest>& orders) {
+    const size_t MAX_BATCH_SIZE = 5; // batchOrders 한 번에 최대 5개
+    
+    std::vector<FuturesOrderResponse> results(orders.size());
+    
+    // 거래소 필터를 미리 적용해 통과한 주문만 전송 (가격/수량은 단위에 맞춘 값으로 교체)
+    std::vector<FuturesOrderRequest> accepted_orders;
+    std::vector<size_t> accepted;
+    accepted_orders.reserve(orders.size());
+    accepted.reserve(orders.size());
+    for (size_t i = 0; i < orders.size(); i++) {
+        const FuturesOrderRequest& request = orders[i];
+        
+        FuturesOrderResponse& result = results[i];
+        result.symbol = request.symbol;
+        result.side = request.side;
+        result.positionSide = request.positionSide;
+        result.type = request.type;
+        result.timeInForce = (request.type == "LIMIT") ? request.timeInForce : "";
+        result.reduceOnly = request.reduceOnly;
+        result.success = false;
+        
+        FuturesOrderRequest normalized;
+        if (!normalizeFuturesOrder(request, normalized, result.error)) {
+            continue;
+        }
+        
+        accepted_orders.push_back(normalized);
+        accepted.push_back(i);
+    }
+    
+    // 5개씩 묶어 전송 (묶음들은 동시에 진행)
+    std::vector<std::future<std::string>> pending;
+    for (size_t batch_start = 0; batch_start < accepted_orders.size(); batch_start += MAX_BATCH_SIZE) {
+        size_t batch_end = std::min(batch_start + MAX_BATCH_SIZE, accepted_orders.size());
         
-        if (!validation.isValid) {
-            std::cout << "\n❌ 주문을 실행할 수 없습니다. 수량을 " << validation.adjustedQuantity << "로 조정하시겠습니까? (y/N): ";
-            std::string response;
-            std::getline(std::cin, response);
+        std::string batch_json = "[";
+        for (size_t i = batch_start; i < batch_end; i++) {
+            const FuturesOrderRequest& request = accepted_orders[i];
             
-            if (response != "y" && response != "Y") {
-                FuturesOrderResponse order;
-                order.success = false;
-                order.error = "사용자가 주문을 취소했습니다";
-                return order;
+            if (i > batch_start) batch_json += ",";
+            batch_json += "{\"symbol\":\"" + request.symbol + "\"";
+            batch_json += ",\"side\":\"" + request.side + "\"";
+            batch_json += ",\"type\":\"" + request.type + "\"";
+            batch_json += ",\"positionSide\":\"" + request.positionSide + "\"";
+            batch_json += ",\"quantity\":\"" + request.quantity.toString() + "\"";
+            if (request.type == "LIMIT") {
+                batch_json += ",\"price\":\"" + request.price.toString() + "\"";
+                batch_json += ",\"timeInForce\":\"" + request.timeInForce + "\"";
+            }
+            if (request.reduceOnly) {
+                batch_json += ",\"reduceOnly\":\"true\"";
             }
+            if (!request.newClientOrderId.empty()) {
+                batch_json += ",\"newClientOrderId\":\"" + request.newClientOrderId + "\"";
+            }
+            batch_json += "}";
+        }
+        batch_json += "]";
+        
+        std::map<std::string, std::string> params;
+        params["batchOrders"] = urlEncode(batch_json);
+        // 묶음 안의 주문마다 주문 수 한도를 하나씩 사용
+        pending.push_back(makeFuturesRequestAsync("/fapi/v1/batchOrders", "POST", params, true,
+                                                  static_cast<int>(batch_end - batch_start)));
+    }
+    
+    // 묶음별 응답을 주문 순서대로 분배
+    for (size_t batch = 0; batch < pending.size(); batch++) {
+        size_t batch_start = batch * MAX_BATCH_SIZE;
+        size_t batch_end = std::min(batch_start + MAX_BATCH_SIZE, accepted_orders.size());
+        
+        std::string response = pending[batch].get();
+        checkFilterError(MarketType::Futures, response);
+        std::vector<std::string> entries = JSONParser::splitArray(response);
+        
+        for (size_t i = batch_start; i < batch_end; i++) {
+            size_t entry_index = i - batch_start;
+            bool is_market = accepted_orders[i].type == "MARKET";
+            FuturesOrderResponse& result = results[accepted[i]];
             
-            quantity = validation.adjustedQuantity;
-        } else {
-            std::cout << "\n🔧 수량이 자동으로 조정되었습니다: " << validation.adjustedQuantity << std::endl;
-            quantity = validation.adjustedQuantity;
+            if (entry_index < entries.size()) {
+                // 각 항목은 주문 결과 또는 {"code":...,"msg":...} 오류
+                parseFuturesOrderResult(entries[entry_index], is_market, result);
+            } else if (entries.empty()) {
+                // 묶음 전체가 실패한 경우 (서명 오류, 네트워크 오류 등)
+                parseFuturesOrderResult(response, is_market, result);
+                if (result.success) {
+                    result.success = false;
+                    result.error = "일괄 주문 응답을 해석할 수 없습니다: " + response;
+                }
+            } else {
+                result.success = false;
+                result.error = "일괄 주문 응답에 해당 주문 결과가 없습니다";
+            }
         }
     }
     
-    return futuresMarketOrder(symbol, "BUY", quantity, "BOTH");
+    return results;
 }
 
-FuturesOrderResponse BinanceAPI::openShortPosition(const std::string& symbol, double quantity) {
-    std::cout << "숏 포지션 진입: " << quantity << " " << symbol << std::endl;
-    
-    // 최소주문수량 검증
+FuturesOrderResponse BinanceAPI::openLongPosition(const std::string& symbol, Decimal quantity,
+                                                  QuantityAdjustPolicy policy) {
+    return openPosition(symbol, "BUY", quantity, policy);
+}
+
+FuturesOrderResponse BinanceAPI::openShortPosition(const std::string& symbol, Decimal quantity,
+                                                   QuantityAdjustPolicy policy) {
+    return openPosition(symbol, "SELL", quantity, policy);
+}
+
+FuturesOrderResponse BinanceAPI::openPosition(const std::string& symbol, const std::string& side, Decimal quantity,
+                                              QuantityAdjustPolicy policy) {
+    // 기준 가격/필터는 캐시에서 가져오므로 서명 요청은 아래 주문 한 번뿐
     FuturesOrderValidation validation = validateFuturesOrderQuantity(symbol, quantity);
     
     if (!validation.error.empty()) {
@@ -1022,29 +1895,15 @@ FuturesOrderResponse BinanceAPI::openShortPosition(const std::string& symbol, do
         return order;
     }
     
-    if (!validation.warning.empty()) {
-        std::cout << "\n" << validation.warning << std::endl;
-        
-        if (!validation.isValid) {
-            std::cout << "\n❌ 주문을 실행할 수 없습니다. 수량을 " << validation.adjustedQuantity << "로 조정하시겠습니까? (y/N): ";
-            std::string response;
-            std::getline(std::cin, response);
-            
-            if (response != "y" && response != "Y") {
-                FuturesOrderResponse order;
-                order.success = false;
-                order.error = "사용자가 주문을 취소했습니다";
-                return order;
-            }
-            
-            quantity = validation.adjustedQuantity;
-        } else {
-            std::cout << "\n🔧 수량이 자동으로 조정되었습니다: " << validation.adjustedQuantity << std::endl;
-            quantity = validation.adjustedQuantity;
-        }
+    // 최소 수량 미달은 호출자가 정한 방식대로 처리 (stepSize 내림은 adjustedQuantity에 이미 반영됨)
+    if (!validation.isValid && policy == QuantityAdjustPolicy::Reject) {
+        FuturesOrderResponse order;
+        order.success = false;
+        order.error = quantityBelowMinimumError(validation.adjustedQuantity);
+        return order;
     }
     
-    return futuresMarketOrder(symbol, "SELL", quantity, "BOTH");
+    return futuresMarketOrder(symbol, side, validation.adjustedQuantity, "BOTH");
 }
 
 FuturesOrderResponse BinanceAPI::closePosition(const std::string& symbol, const std::string& positionSide) {
@@ -1067,7 +1926,7 @@ FuturesOrderResponse BinanceAPI::closePosition(const std::string& symbol, const
     
     // 포지션 방향에 따라 반대 주문 실행
     std::string side = (position.positionAmt > 0) ? "SELL" : "BUY";
-    double quantity = std::abs(position.positionAmt);
+    Decimal quantity = Decimal::fromDouble(std::abs(position.positionAmt));
     
     std::cout << "포지션 종료: " << side << " " << quantity << " " << symbol << std::endl;
     
@@ -1077,215 +1936,206 @@ FuturesOrderResponse BinanceAPI::closePosition(const std::string& symbol, const
     return order;
 }
 
-FuturesSymbolsResponse BinanceAPI::getFuturesSymbols() {
-    FuturesSymbolsResponse response;
-    
-    std::string api_response = makeFuturesRequest("/fapi/v1/exchangeInfo", "GET", {}, false);
-    
-    std::cout << "API 응답 길이: " << api_response.length() << " 바이트" << std::endl;
-    
-    if (api_response.find("\"error\"") != std::string::npos) {
-        response.success = false;
-        response.error = JSONParser::extractString(api_response, "error");
-        return response;
+// exchangeInfo의 심볼 항목 하나를 심볼 정보로 변환 (필드 누락/형식 오류 시 false)
+static bool parseExchangeSymbol(JSONValue symbol_data, SymbolInfo& symbol_info, std::string& error) {
+    symbol_info.minQty = Decimal();
+    symbol_info.maxQty = Decimal();
+    symbol_info.stepSize = Decimal();
+    symbol_info.marketMinQty = Decimal();
+    symbol_info.marketMaxQty = Decimal();
+    symbol_info.marketStepSize = Decimal();
+    symbol_info.tickSize = Decimal();
+    symbol_info.minPrice = Decimal();
+    symbol_info.maxPrice = Decimal();
+    symbol_info.minNotional = Decimal();
+    symbol_info.maxNotional = Decimal();
+    symbol_info.multiplierUp = Decimal();
+    symbol_info.multiplierDown = Decimal();
+    symbol_info.maxNumOrders = 0;
+    symbol_info.pricePrecision = 0;
+    symbol_info.quantityPrecision = 0;
+    if (!decodeJSON<FuturesSymbolSchema>(symbol_data, symbol_info, error)) {
+        return false;
     }
     
-    if (api_response.length() < 100) {
-        response.success = false;
-        response.error = "API 응답이 너무 짧습니다: " + api_response;
-        return response;
+    // 필터 정보 추출 (주문 필터 엔진이 사용하는 필터만, 나머지는 무시)
+    for (JSONValue filter : symbol_data["filters"]) {
+        std::string_view filter_type = filter["filterType"].raw();
+        bool decoded = true;
+        if (filter_type == "LOT_SIZE") {
+            decoded = decodeJSON<LotSizeFilterSchema>(filter, symbol_info, error);
+        } else if (filter_type == "MARKET_LOT_SIZE") {
+            decoded = decodeJSON<MarketLotSizeFilterSchema>(filter, symbol_info, error);
+        } else if (filter_type == "PRICE_FILTER") {
+            decoded = decodeJSON<PriceFilterSchema>(filter, symbol_info, error);
+        } else if (filter_type == "MIN_NOTIONAL" || filter_type == "NOTIONAL") {
+            decoded = decodeJSON<MinNotionalFilterSchema>(filter, symbol_info, error);
+        } else if (filter_type == "PERCENT_PRICE") {
+            decoded = decodeJSON<PercentPriceFilterSchema>(filter, symbol_info, error);
+        } else if (filter_type == "MAX_NUM_ORDERS") {
+            decoded = decodeJSON<MaxNumOrdersFilterSchema>(filter, symbol_info, error);
+        }
+        if (!decoded) {
+            error = std::string(filter_type) + " 필터 " + error;
+            return false;
+        }
     }
     
-    // symbols 배열 찾기
-    size_t symbols_start = api_response.find("\"symbols\":[");
-    if (symbols_start == std::string::npos) {
+    return true;
+}
+
+FuturesSymbolsResponse BinanceAPI::getFuturesSymbols() {
+    FuturesSymbolsResponse response;
+    
+    std::shared_ptr<const std::vector<SymbolInfo>> symbols = futures_symbols_ ? futures_symbols_->symbols() : nullptr;
+    if (!symbols) {
         response.success = false;
-        response.error = "심볼 정보를 찾을 수 없습니다";
+        response.error = futures_symbols_ ? futures_symbols_->lastError() : "심볼 정보 캐시가 없습니다";
         return response;
     }
     
-    size_t pos = symbols_start + 11; // "symbols":[의 길이
-    int total_symbols = 0;
-    int usdt_symbols = 0;
-    
-    while (pos < api_response.length()) {
-        size_t symbol_start = api_response.find("{", pos);
-        if (symbol_start == std::string::npos) break;
-        
-        // 중첩된 JSON 구조를 고려한 올바른 끝 위치 찾기
-        size_t symbol_end = symbol_start + 1;
-        int brace_count = 1;
-        while (symbol_end < api_response.length() && brace_count > 0) {
-            if (api_response[symbol_end] == '{') {
-                brace_count++;
-            } else if (api_response[symbol_end] == '}') {
-                brace_count--;
-            }
-            symbol_end++;
-        }
-        
-        if (brace_count > 0) break; // 매칭되는 } 를 찾지 못함
-        
-        std::string symbol_data = api_response.substr(symbol_start, symbol_end - symbol_start);
-        
-        FuturesSymbolInfo symbol_info;
-        symbol_info.symbol = JSONParser::extractString(symbol_data, "symbol");
-        symbol_info.baseAsset = JSONParser::extractString(symbol_data, "baseAsset");
-        symbol_info.quoteAsset = JSONParser::extractString(symbol_data, "quoteAsset");
-        symbol_info.status = JSONParser::extractString(symbol_data, "status");
-        
-        total_symbols++;
-        
-        // USDT 페어이고 거래 가능한 상태인 것만 추가
+    // USDT 페어이고 거래 가능한 상태인 것만 추가
+    for (const auto& symbol_info : *symbols) {
         if (symbol_info.quoteAsset == "USDT" && symbol_info.status == "TRADING") {
-            usdt_symbols++;
-            // 필터 정보 추출
-            size_t filters_start = symbol_data.find("\"filters\":[");
-            if (filters_start != std::string::npos) {
-                size_t filters_end = symbol_data.find("]", filters_start);
-                std::string filters_data = symbol_data.substr(filters_start, filters_end - filters_start + 1);
-                
-                // LOT_SIZE 필터 찾기
-                size_t lot_size_pos = filters_data.find("\"filterType\":\"LOT_SIZE\"");
-                if (lot_size_pos != std::string::npos) {
-                    size_t lot_size_end = filters_data.find("}", lot_size_pos);
-                    std::string lot_size_data = filters_data.substr(lot_size_pos, lot_size_end - lot_size_pos + 1);
-                    
-                    symbol_info.minQty = JSONParser::extractDouble(lot_size_data, "minQty");
-                    symbol_info.maxQty = JSONParser::extractDouble(lot_size_data, "maxQty");
-                    symbol_info.stepSize = JSONParser::extractDouble(lot_size_data, "stepSize");
-                }
-                
-                // MIN_NOTIONAL 필터 찾기
-                size_t notional_pos = filters_data.find("\"filterType\":\"MIN_NOTIONAL\"");
-                if (notional_pos != std::string::npos) {
-                    size_t notional_end = filters_data.find("}", notional_pos);
-                    std::string notional_data = filters_data.substr(notional_pos, notional_end - notional_pos + 1);
-                    
-                    symbol_info.minNotional = JSONParser::extractDouble(notional_data, "notional");
-                }
-            }
-            
-            // 정밀도 정보 추출
-            symbol_info.pricePrecision = static_cast<int>(JSONParser::extractDouble(symbol_data, "pricePrecision"));
-            symbol_info.quantityPrecision = static_cast<int>(JSONParser::extractDouble(symbol_data, "quantityPrecision"));
-            
             response.symbols.push_back(symbol_info);
         }
-        
-        pos = symbol_end + 1;
-        
-        // 배열 끝 확인
-        if (api_response.find("]", pos) < api_response.find("{", pos)) {
-            break;
-        }
     }
     
-    std::cout << "파싱 완료: 전체 " << total_symbols << "개 심볼 중 " << usdt_symbols << "개 USDT 페어 발견" << std::endl;
-    std::cout << "최종 결과: " << response.symbols.size() << "개 심볼 추가됨" << std::endl;
-    
+    std::cout << "파싱 완료: 전체 " << symbols->size() << "개 심볼 중 " << response.symbols.size() << "개 USDT 페어 발견" << std::endl;
     response.success = true;
     return response;
 }
 
-BinanceAPI::FuturesOrderValidation BinanceAPI::validateFuturesOrderQuantity(const std::string& symbol, double quantity) {
+std::future<FuturesSymbolsResponse> BinanceAPI::getFuturesSymbolsAsync() {
+    // 심볼 캐시가 아직 비어 있으면 첫 로드를 별도 스레드에서 수행
+    BinanceAPI api = *this;
+    return std::async(std::launch::async, [api]() mutable {
+        return api.getFuturesSymbols();
+    });
+}
+
+FuturesSymbolsResponse BinanceAPI::streamFuturesSymbols(const std::function<void(const SymbolInfo&)>& on_symbol) {
+    return streamExchangeSymbols(MarketType::Futures, on_symbol);
+}
+
+FuturesSymbolsResponse BinanceAPI::streamExchangeSymbols(MarketType type, const std::function<void(const SymbolInfo&)>& on_symbol) {
+    FuturesSymbolsResponse response;
+    
+    // 해석할 수 없는 심볼(새 필터 형식, 필드 누락 등)은 건너뛰고 나머지는 계속 받음
+    // 건너뛴 심볼은 캐시에 없으므로 해당 심볼 주문은 로컬 검증에서 거부됨
+    // 심볼 캐시의 백그라운드 갱신 스레드에서도 호출되므로 출력하지 않고 수와 이유만 응답에 남김
+    size_t decoded = 0;
+    std::string decode_error;
+    JSONArrayStream stream("symbols", [&](JSONValue symbol_data) {
+        SymbolInfo symbol_info;
+        std::string error;
+        if (!parseExchangeSymbol(symbol_data, symbol_info, error)) {
+            decode_error = "심볼 정보 해석 실패 (" + std::string(symbol_data["symbol"].raw()) + "): " + error;
+            response.skippedSymbols++;
+            return true;
+        }
+        decoded++;
+        on_symbol(symbol_info);
+        return true;
+    });
+    auto on_data = [&stream](const char* data, size_t length) {
+        return stream.feed(data, length);
+    };
+    std::string api_response = (type == MarketType::Spot)
+        ? makeRequest("/api/v3/exchangeInfo", "GET", {}, false, on_data)
+        : makeFuturesRequest("/fapi/v1/exchangeInfo", "GET", {}, false, on_data);
+    
+    response.success = false;
+    if (stream.failed()) {
+        response.error = "심볼 정보 응답을 해석할 수 없습니다";
+    } else if (api_response.find("\"error\"") != std::string::npos) {
+        response.error = JSONParser::extractString(api_response, "error");
+    } else if (!stream.finished()) {
+        response.error = "심볼 정보를 찾을 수 없습니다";
+    } else if (decoded == 0 && response.skippedSymbols > 0) {
+        response.error = decode_error;
+    } else {
+        response.success = true;
+        if (response.skippedSymbols > 0) {
+            response.error = "심볼 " + std::to_string(response.skippedSymbols) + "개 해석 실패로 제외, 마지막 " + decode_error;
+        }
+    }
+    return response;
+}
+
+BinanceAPI::FuturesOrderValidation BinanceAPI::validateFuturesOrderQuantity(const std::string& symbol, Decimal quantity) {
     FuturesOrderValidation validation;
     validation.isValid = false;
     validation.adjustedQuantity = quantity;
-    validation.minQuantity = 0.0;
-    validation.minNotional = 0.0;
-    validation.currentPrice = 0.0;
     
-    // 1. 현재 가격 조회
-    MarketPrice priceInfo = getCurrentPrice(symbol);
+    // 1. 현재 가격 (스트림/호가창에 있으면 즉시, 없으면 가격 요청을 먼저 보내 두고 필터 조회와 겹침)
+    std::future<MarketPrice> pendingPrice = getFuturesPriceAsync(symbol);
+    
+    // 2. 심볼 필터 조회 (캐시에서 O(1), 첫 주문에만 exchangeInfo 요청)
+    SymbolInfo symbolInfo;
+    bool hasSymbolInfo = getSymbolInfo(MarketType::Futures, symbol, symbolInfo);
+    MarketPrice priceInfo = pendingPrice.get();
+    
     if (!priceInfo.success) {
         validation.error = "가격 조회 실패: " + priceInfo.error;
         return validation;
     }
-    validation.currentPrice = priceInfo.price;
-    
-    // 2. 심볼 정보 조회 (필터 정보 포함)
-    FuturesSymbolsResponse symbolsResponse = getFuturesSymbols();
-    if (!symbolsResponse.success) {
-        validation.error = "심볼 정보 조회 실패: " + symbolsResponse.error;
-        return validation;
-    }
-    
-    // 3. 해당 심볼 찾기
-    FuturesSymbolInfo symbolInfo;
-    bool found = false;
-    for (const auto& sym : symbolsResponse.symbols) {
-        if (sym.symbol == symbol) {
-            symbolInfo = sym;
-            found = true;
-            break;
-        }
-    }
+    validation.currentPrice = Decimal::fromDouble(priceInfo.price);
     
-    if (!found) {
-        validation.error = "심볼 " + symbol + "을(를) 찾을 수 없습니다";
+    if (!hasSymbolInfo) {
+        validation.error = "심볼 정보 조회 실패: " + (futures_symbols_ ? futures_symbols_->lastError() : "심볼 정보 캐시가 없습니다");
         return validation;
     }
     
     validation.minQuantity = symbolInfo.minQty;
     validation.minNotional = symbolInfo.minNotional;
-    
-    // 4. 바이낸스 공식 최소주문수량 계산
-    // 최소주문수량 = MAX(LOT_SIZE.minQty, MIN_NOTIONAL.minNotional/price)
-    double minQtyFromLotSize = symbolInfo.minQty;
-    double minQtyFromNotional = symbolInfo.minNotional / validation.currentPrice;
-    double actualMinQuantity = std::max(minQtyFromLotSize, minQtyFromNotional);
-    
-    // 5. 입력된 수량 검증
-    if (quantity < actualMinQuantity) {
+    validation.tickSize = symbolInfo.tickSize;
+    
+    // 3. 거래소 필터 적용 (시장가 기준, 메모리의 필터만 사용하므로 네트워크 요청 없음)
+    OrderFilterRequest request;
+    request.type = OrderType::Market;
+    request.quantity = quantity;
+    request.referencePrice = validation.currentPrice;
+    request.openOrders = openOrderCount(MarketType::Futures, symbol);
+    OrderFilterResult filtered = applyOrderFilters(symbolInfo, request);
+    
+    // 4. 수량/금액이 부족하면 모든 필터를 통과하는 최소 수량을 제안
+    // 최소주문수량 = MAX(LOT_SIZE.minQty, MIN_NOTIONAL.minNotional/price)를 stepSize 배수로 올림
+    if (filtered.error == FilterError::QuantityTooLow || filtered.error == FilterError::NotionalTooLow) {
         validation.isValid = false;
-        validation.adjustedQuantity = actualMinQuantity;
-        
-        // stepSize에 맞게 조정
-        if (symbolInfo.stepSize > 0) {
-            validation.adjustedQuantity = std::ceil(actualMinQuantity / symbolInfo.stepSize) * symbolInfo.stepSize;
-        }
+        validation.adjustedQuantity = filtered.minQuantity;
         
         std::stringstream ss;
         ss << "⚠️ 주문 수량 부족 경고!\n"
-           << "📊 현재 입력: " << std::fixed << std::setprecision(6) << quantity << " " << symbol << "\n"
-           << "💰 현재 가격: $" << std::fixed << std::setprecision(2) << validation.currentPrice << "\n"
-           << "📏 LOT_SIZE 최소수량: " << std::fixed << std::setprecision(6) << minQtyFromLotSize << "\n"
-           << "💵 MIN_NOTIONAL 최소수량: " << std::fixed << std::setprecision(6) << minQtyFromNotional << " (최소 $" << std::fixed << std::setprecision(2) << symbolInfo.minNotional << ")\n"
-           << "✅ 실제 최소수량: " << std::fixed << std::setprecision(6) << actualMinQuantity << "\n"
-           << "🔧 권장 조정수량: " << std::fixed << std::setprecision(6) << validation.adjustedQuantity << "\n"
-           << "💡 조정 후 주문금액: $" << std::fixed << std::setprecision(2) << (validation.adjustedQuantity * validation.currentPrice);
+           << "📊 현재 입력: " << quantity << " " << symbol << "\n"
+           << "💰 현재 가격: $" << validation.currentPrice << "\n"
+           << "📏 LOT_SIZE 최소수량: " << symbolInfo.minQty << "\n"
+           << "💵 MIN_NOTIONAL 최소수량: " << symbolInfo.minNotional.divideCeil(validation.currentPrice)
+           << " (최소 $" << symbolInfo.minNotional << ")\n"
+           << "🔧 권장 조정수량: " << validation.adjustedQuantity << "\n"
+           << "💡 조정 후 주문금액: $" << (validation.adjustedQuantity * validation.currentPrice);
         
         validation.warning = ss.str();
         return validation;
     }
     
-    // 6. stepSize 검증 및 조정
-    if (symbolInfo.stepSize > 0) {
-        double remainder = fmod(quantity, symbolInfo.stepSize);
-        if (remainder > 1e-8) { // 부동소수점 오차 고려
-            validation.adjustedQuantity = quantity - remainder;
-            if (validation.adjustedQuantity < actualMinQuantity) {
-                validation.adjustedQuantity = std::ceil(quantity / symbolInfo.stepSize) * symbolInfo.stepSize;
-            }
-            
-            std::stringstream ss;
-            ss << "🔧 수량 조정 알림\n"
-               << "📊 입력 수량: " << std::fixed << std::setprecision(6) << quantity << "\n"
-               << "📏 stepSize: " << std::fixed << std::setprecision(6) << symbolInfo.stepSize << "\n"
-               << "✅ 조정 수량: " << std::fixed << std::setprecision(6) << validation.adjustedQuantity << "\n"
-               << "💰 조정 후 주문금액: $" << std::fixed << std::setprecision(2) << (validation.adjustedQuantity * validation.currentPrice);
-            
-            validation.warning = ss.str();
-        }
+    if (filtered.error != FilterError::None) {
+        validation.error = filterErrorMessage(filtered.error);
+        return validation;
     }
     
-    // 7. 최종 검증
-    double finalOrderValue = validation.adjustedQuantity * validation.currentPrice;
-    if (finalOrderValue < symbolInfo.minNotional) {
-        validation.isValid = false;
-        validation.error = "최종 주문 금액이 최소 주문 금액보다 작습니다";
-        return validation;
+    // 5. stepSize 배수로 내림한 경우 조정 알림
+    if (filtered.quantity != quantity) {
+        validation.adjustedQuantity = filtered.quantity;
+        
+        std::stringstream ss;
+        ss << "🔧 수량 조정 알림\n"
+           << "📊 입력 수량: " << quantity << "\n"
+           << "📏 stepSize: " << symbolInfo.stepSize << "\n"
+           << "✅ 조정 수량: " << validation.adjustedQuantity << "\n"
+           << "💰 조정 후 주문금액: $" << (validation.adjustedQuantity * validation.currentPrice);
+        
+        validation.warning = ss.str();
     }
     
     validation.isValid = true;
@@ -0,0 +1,260 @@
+#include "connection_pool.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+// CURL 응답 콜백 함수
+static size_t WriteCallback(void* contents, size_t size, size_t nmemb, HttpResponse* response) {
+    size_t totalSize = size * nmemb;
+
+    // 스트리밍 요청은 성공 응답만 바로 전달 (오류 응답은 메시지 확인을 위해 body에 보관)
+    if (response->onData && response->statusCode < 300) {
+        return response->onData((const char*)contents, totalSize) ? totalSize : 0;
+    }
+
+    response->body.append((char*)contents, totalSize);
+    return totalSize;
+}
+
+// 응답 헤더 콜백: 요청 한도 관련 헤더만 보관
+static size_t HeaderCallback(char* buffer, size_t size, size_t nitems, HttpResponse* response) {
+    size_t totalSize = size * nitems;
+    std::string line(buffer, totalSize);
+
+    // 상태 줄 (HTTP/1.1 200 OK, HTTP/2 200): 본문 전달 여부를 판단하기 위해 먼저 기록
+    if (line.compare(0, 5, "HTTP/") == 0) {
+        size_t code_start = line.find(' ');
+        if (code_start != std::string::npos) {
+            response->statusCode = std::strtol(line.c_str() + code_start + 1, nullptr, 10);
+        }
+        return totalSize;
+    }
+
+    size_t colon = line.find(':');
+    if (colon == std::string::npos) {
+        return totalSize;
+    }
+
+    std::string name = line.substr(0, colon);
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    if (name.compare(0, 6, "x-mbx-") == 0 || name == "retry-after") {
+        size_t value_start = line.find_first_not_of(" \t", colon + 1);
+        size_t value_end = line.find_last_not_of(" \t\r\n");
+        if (value_start != std::string::npos && value_end != std::string::npos && value_end >= value_start) {
+            response->headers[name] = line.substr(value_start, value_end - value_start + 1);
+        }
+    }
+
+    return totalSize;
+}
+
+ConnectionPool::ConnectionPool() : requests_(0), handshakes_(0), reused_(0), http2_responses_(0) {
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    // DNS 캐시, SSL 세션만 핸들 간에 공유
+    // 연결 캐시는 공유하지 않는다: libcurl은 여러 스레드가 동시에 쓰는 연결 캐시 공유를 지원하지 않으며
+    // (동기 perform이 여러 스레드에서 실행되면 poll()에서 멈춤), 연결 재사용은 유휴 핸들 풀이 핸들별로 맡는다
+    share_ = curl_share_init();
+    if (share_) {
+        curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, lockShare);
+        curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, unlockShare);
+        curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+}
+
+ConnectionPool::~ConnectionPool() {
+    for (auto& entry : idle_handles_) {
+        for (CURL* curl : entry.second) {
+            curl_easy_cleanup(curl);
+        }
+    }
+    idle_handles_.clear();
+
+    if (share_) {
+        curl_share_cleanup(share_);
+    }
+}
+
+void ConnectionPool::lockShare(CURL*, curl_lock_data data, curl_lock_access, void* userptr) {
+    static_cast<ConnectionPool*>(userptr)->share_locks_[data].lock();
+}
+
+void ConnectionPool::unlockShare(CURL*, curl_lock_data data, void* userptr) {
+    static_cast<ConnectionPool*>(userptr)->share_locks_[data].unlock();
+}
+
+std::string ConnectionPool::baseUrlOf(const std::string& url) {
+    size_t scheme_end = url.find("://");
+    size_t host_start = (scheme_end == std::string::npos) ? 0 : scheme_end + 3;
+    size_t path_start = url.find_first_of("/?", host_start);
+    return (path_start == std::string::npos) ? url : url.substr(0, path_start);
+}
+
+CURL* ConnectionPool::acquire(const std::string& base_url) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = idle_handles_.find(base_url);
+        if (it != idle_handles_.end() && !it->second.empty()) {
+            CURL* curl = it->second.back();
+            it->second.pop_back();
+            // 옵션만 초기화되고 핸들의 연결 캐시는 유지됨 (DNS 캐시, SSL 세션은 공유 객체에 있음)
+            curl_easy_reset(curl);
+            return curl;
+        }
+    }
+
+    return curl_easy_init();
+}
+
+void ConnectionPool::release(const std::string& base_url, CURL* curl) {
+    if (!curl) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<CURL*>& handles = idle_handles_[base_url];
+        if (handles.size() < MAX_IDLE_PER_HOST) {
+            handles.push_back(curl);
+            return;
+        }
+    }
+
+    curl_easy_cleanup(curl);
+}
+
+void ConnectionPool::configure(CURL* curl, const HttpRequest& request, HttpResponse* response, bool multiplexed) {
+    curl_easy_setopt(curl, CURLOPT_URL, request.url.c_str());
+
+    // 요청 방식에 따라 본문 설정
+    if (request.method == "POST") {
+        curl_easy_setopt(curl, CURLOPT_POST, 1L);
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, request.body.c_str());
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, (long)request.body.length());
+    } else if (request.method == "PUT" || request.method == "DELETE") {
+        curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, request.method.c_str());
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, request.body.c_str());
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, (long)request.body.length());
+    } else {
+        curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+    }
+
+    response->onData = request.onData;
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, response);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, response);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, request.timeout);
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, request.connectTimeout);
+    curl_easy_setopt(curl, CURLOPT_VERBOSE, 0L);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
+    if (!ca_file_.empty()) {
+        curl_easy_setopt(curl, CURLOPT_CAINFO, ca_file_.c_str());
+    }
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, "Binance-Trader/1.0");
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, request.headers.get());
+
+    // 연결 유지 설정
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPIDLE, 60L);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPINTVL, 30L);
+    curl_easy_setopt(curl, CURLOPT_TCP_NODELAY, 1L);
+
+    // HTTP/2 모드: 같은 호스트로의 동시 요청이 하나의 연결을 다중화하여 공유
+    // (curl_multi 전송만 해당, 동기 curl_easy_perform 핸들은 다중화할 수 없어 HTTP/1.1 유지)
+    if (request.http2 && multiplexed) {
+        bool plain_http = request.url.compare(0, 7, "http://") == 0;
+        curl_easy_setopt(curl, CURLOPT_HTTP_VERSION,
+                         plain_http ? (long)CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE : (long)CURL_HTTP_VERSION_2TLS);
+        // 새 연결을 만들기 전에 기존 연결의 다중화 가능 여부를 기다림
+        curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+    } else {
+        curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_1_1);
+    }
+
+    if (share_) {
+        curl_easy_setopt(curl, CURLOPT_SHARE, share_);
+    }
+}
+
+void ConnectionPool::recordResult(CURL* curl, HttpResponse& response) {
+    long response_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+    response.statusCode = response_code;
+
+    // 이번 전송에서 새로 맺은 연결 수 (0이면 기존 연결 재사용)
+    long new_connects = 0;
+    curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &new_connects);
+    response.reusedConnection = (response.curlCode == CURLE_OK && new_connects == 0);
+
+    long http_version = 0;
+    curl_easy_getinfo(curl, CURLINFO_HTTP_VERSION, &http_version);
+    response.http2 = (http_version == CURL_HTTP_VERSION_2_0);
+
+    curl_off_t micros = 0;
+    RequestTimings& timings = response.timings;
+    if (curl_easy_getinfo(curl, CURLINFO_NAMELOOKUP_TIME_T, &micros) == CURLE_OK) timings.nameLookup = micros;
+    if (curl_easy_getinfo(curl, CURLINFO_CONNECT_TIME_T, &micros) == CURLE_OK) timings.connect = micros;
+    if (curl_easy_getinfo(curl, CURLINFO_APPCONNECT_TIME_T, &micros) == CURLE_OK) timings.appConnect = micros;
+    if (curl_easy_getinfo(curl, CURLINFO_PRETRANSFER_TIME_T, &micros) == CURLE_OK) timings.preTransfer = micros;
+    if (curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME_T, &micros) == CURLE_OK) timings.startTransfer = micros;
+    if (curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME_T, &micros) == CURLE_OK) timings.total = micros;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_++;
+    if (response.http2) {
+        http2_responses_++;
+    }
+    if (new_connects > 0) {
+        handshakes_ += new_connects;
+    } else if (response.reusedConnection) {
+        reused_++;
+    }
+}
+
+HttpResponse ConnectionPool::perform(const HttpRequest& request) {
+    HttpResponse response;
+    std::string base_url = baseUrlOf(request.url);
+
+    CURL* curl = acquire(base_url);
+    if (!curl) {
+        response.curlCode = CURLE_FAILED_INIT;
+        return response;
+    }
+
+    configure(curl, request, &response, false);
+    response.curlCode = curl_easy_perform(curl);
+    recordResult(curl, response);
+
+    // 전송 실패한 핸들은 연결 상태를 알 수 없으므로 폐기
+    if (response.curlCode == CURLE_OK) {
+        release(base_url, curl);
+    } else {
+        curl_easy_cleanup(curl);
+    }
+
+    return response;
+}
+
+void ConnectionPool::setCaFile(const std::string& path) {
+    ca_file_ = path;
+}
+
+ConnectionPoolStats ConnectionPool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ConnectionPoolStats stats;
+    stats.requests = requests_;
+    stats.handshakes = handshakes_;
+    stats.reusedConnections = reused_;
+    stats.http2Responses = http2_responses_;
+    stats.idleHandles = 0;
+    for (const auto& entry : idle_handles_) {
+        stats.idleHandles += static_cast<long>(entry.second.size());
+    }
+    return stats;
+}
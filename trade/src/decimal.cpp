@@ -0,0 +1,150 @@
+#include "decimal.h"
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+namespace {
+
+#if defined(__SIZEOF_INT128__)
+using Wide = __int128;
+#else
+using Wide = long double;
+#endif
+
+const int64_t MAX_INTEGER_PART = std::numeric_limits<int64_t>::max() / Decimal::SCALE;
+
+inline int64_t narrow(Wide value) {
+    return static_cast<int64_t>(value);
+}
+
+}  // namespace
+
+Decimal Decimal::fromDouble(double value) {
+    double scaled = value * SCALE;
+    if (!std::isfinite(scaled) || std::fabs(scaled) >= 9.2e18) {
+        return Decimal();
+    }
+    return Decimal(std::llround(scaled));
+}
+
+bool Decimal::parse(std::string_view text, Decimal& out) {
+    size_t pos = 0;
+    size_t n = text.size();
+    bool negative = false;
+    if (pos < n && (text[pos] == '-' || text[pos] == '+')) {
+        negative = (text[pos] == '-');
+        pos++;
+    }
+
+    int64_t integer_part = 0;
+    size_t integer_digits = 0;
+    for (; pos < n && text[pos] >= '0' && text[pos] <= '9'; pos++, integer_digits++) {
+        integer_part = integer_part * 10 + (text[pos] - '0');
+        if (integer_part > MAX_INTEGER_PART) return false;
+    }
+
+    int64_t fraction = 0;
+    size_t fraction_digits = 0;
+    if (pos < n && text[pos] == '.') {
+        pos++;
+        for (; pos < n && text[pos] >= '0' && text[pos] <= '9'; pos++, fraction_digits++) {
+            // 9번째 자리부터는 버림
+            if (fraction_digits < static_cast<size_t>(DIGITS)) {
+                fraction = fraction * 10 + (text[pos] - '0');
+            }
+        }
+    }
+
+    if (pos != n || integer_digits + fraction_digits == 0) return false;
+
+    for (size_t i = fraction_digits; i < static_cast<size_t>(DIGITS); i++) {
+        fraction *= 10;
+    }
+
+    // 정수부가 최댓값이면 소수부까지 더했을 때 int64 범위를 넘는지 곱하기 전에 확인
+    if (integer_part == MAX_INTEGER_PART && fraction > std::numeric_limits<int64_t>::max() % SCALE) return false;
+    int64_t raw = integer_part * SCALE + fraction;
+    out = Decimal(negative ? -raw : raw);
+    return true;
+}
+
+size_t Decimal::format(char* buffer) const {
+    // INT64_MIN도 처리할 수 있도록 부호 없는 크기로 변환
+    uint64_t magnitude = raw_ < 0 ? uint64_t(0) - static_cast<uint64_t>(raw_) : static_cast<uint64_t>(raw_);
+    uint64_t integer_part = magnitude / SCALE;
+    uint64_t fraction = magnitude % SCALE;
+
+    char digits[MAX_LENGTH];
+    size_t length = 0;
+
+    // 소수부 (끝의 0 제거)
+    int fraction_digits = DIGITS;
+    while (fraction_digits > 0 && fraction % 10 == 0) {
+        fraction /= 10;
+        fraction_digits--;
+    }
+    for (int i = 0; i < fraction_digits; i++) {
+        digits[length++] = static_cast<char>('0' + fraction % 10);
+        fraction /= 10;
+    }
+    if (fraction_digits > 0) digits[length++] = '.';
+
+    // 정수부
+    do {
+        digits[length++] = static_cast<char>('0' + integer_part % 10);
+        integer_part /= 10;
+    } while (integer_part != 0);
+
+    size_t written = 0;
+    if (raw_ < 0) buffer[written++] = '-';
+    while (length > 0) buffer[written++] = digits[--length];
+    return written;
+}
+
+std::string Decimal::toString() const {
+    char buffer[MAX_LENGTH];
+    return std::string(buffer, format(buffer));
+}
+
+Decimal Decimal::floorToStep(Decimal step) const {
+    if (step.raw_ <= 0) return *this;
+    int64_t count = raw_ / step.raw_;
+    if (raw_ % step.raw_ != 0 && raw_ < 0) count--;
+    return Decimal(count * step.raw_);
+}
+
+Decimal Decimal::ceilToStep(Decimal step) const {
+    if (step.raw_ <= 0) return *this;
+    int64_t count = raw_ / step.raw_;
+    if (raw_ % step.raw_ != 0 && raw_ > 0) count++;
+    return Decimal(count * step.raw_);
+}
+
+bool Decimal::isMultipleOf(Decimal step) const {
+    if (step.raw_ <= 0) return true;
+    return raw_ % step.raw_ == 0;
+}
+
+Decimal Decimal::operator*(Decimal other) const {
+    return Decimal(narrow(Wide(raw_) * other.raw_ / SCALE));
+}
+
+Decimal Decimal::operator/(Decimal other) const {
+    if (other.raw_ == 0) return Decimal();
+    return Decimal(narrow(Wide(raw_) * SCALE / other.raw_));
+}
+
+Decimal Decimal::divideCeil(Decimal divisor) const {
+    if (divisor.raw_ == 0) return Decimal();
+    Wide numerator = Wide(raw_) * SCALE;
+    int64_t quotient = narrow(numerator / divisor.raw_);
+    if (Wide(quotient) * divisor.raw_ != numerator && (raw_ < 0) == (divisor.raw_ < 0)) {
+        quotient++;
+    }
+    return Decimal(quotient);
+}
+
+std::ostream& operator<<(std::ostream& os, Decimal value) {
+    char buffer[Decimal::MAX_LENGTH];
+    return os.write(buffer, static_cast<std::streamsize>(value.format(buffer)));
+}
@@ -1,8 +1,765 @@
 #include "json_parser.h"
+#include "json_scanner.h"
 #include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <sstream>
 
+// ===== JSONDocument =====
+
+namespace {
+
+inline bool isWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+inline bool isNumberChar(char c) {
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+// 구조 문자 색인 구간 크기 (색인 항목이 L2 캐시에 남아 있는 동안 소비)
+constexpr size_t INDEX_WINDOW = 64 * 1024;
+
+}  // namespace
+
+bool JSONDocument::fail(size_t offset) {
+    ok_ = false;
+    error_offset_ = offset;
+    tokens_.clear();
+    stack_.clear();
+    return false;
+}
+
+bool JSONDocument::parse(std::string_view json) {
+    json_ = json;
+    stack_.clear();
+    ok_ = false;
+    error_offset_ = 0;
+
+    const size_t n = json.size();
+    if (n >= std::numeric_limits<uint32_t>::max()) {
+        return fail(0);
+    }
+    // 토큰 버퍼는 앞에서부터 직접 채운다 (대략 8바이트당 토큰 하나, 이전 파싱에서 늘린 크기는 그대로 재사용)
+    // 토큰은 end로 하위 트리 범위를 가리키므로 마지막 토큰 뒤의 남은 칸은 읽히지 않는다
+    if (tokens_.size() < n / 8 + 4) {
+        tokens_.resize(n / 8 + 4);
+    }
+    Token* tokens = tokens_.data();
+    size_t token_count = 0;
+
+    // 구조 문자 색인(벡터화)을 구간 단위로 만들면서 색인 항목만 순서대로 방문해 토큰화한다
+    const char* data = json.data();
+    structurals_.reset();
+    const uint32_t* index = nullptr;
+    size_t count = 0;
+    size_t next = 0;
+
+    // 다음 색인 항목이 있는지 (현재 구간을 다 썼으면 다음 구간 색인)
+    auto available = [&]() {
+        while (next >= count) {
+            if (structurals_.scanned >= n) return false;
+            JSONScanner::buildStructuralIndex(data, n, structurals_, INDEX_WINDOW);
+            index = structurals_.positions.data();
+            count = structurals_.count;
+            next = 0;
+        }
+        return true;
+    };
+
+    // 현재 열린 컨테이너 (stack_.back()을 지역 변수로 들고 있음, 최상위면 ROOT)
+    constexpr uint32_t ROOT = std::numeric_limits<uint32_t>::max();
+    uint32_t parent = ROOT;
+    bool parent_is_array = false;
+
+    // 새 토큰 추가 (배열 요소면 부모의 요소 수 증가)
+    auto push = [&](JSONType type, size_t start, size_t length, bool is_key, bool escaped) {
+        if (parent_is_array) {
+            tokens[parent].count++;
+        }
+        if (token_count == tokens_.size()) {
+            tokens_.resize(tokens_.size() * 2);
+            tokens = tokens_.data();
+        }
+        Token& token = tokens[token_count++];
+        token.start = static_cast<uint32_t>(start);
+        token.length = static_cast<uint32_t>(length);
+        token.end = static_cast<uint32_t>(token_count);
+        token.count = 0;
+        token.type = type;
+        token.is_key = is_key;
+        token.escaped = escaped;
+    };
+
+    // 열린 객체/배열 닫기
+    auto closeContainer = [&](size_t close_pos) {
+        Token& token = tokens[parent];
+        token.length = static_cast<uint32_t>(close_pos + 1 - token.start);
+        token.end = static_cast<uint32_t>(token_count);
+        stack_.pop_back();
+        if (stack_.empty()) {
+            parent = ROOT;
+            parent_is_array = false;
+        } else {
+            parent = stack_.back();
+            parent_is_array = tokens[parent].type == JSONType::Array;
+        }
+    };
+
+    // 여는 따옴표 다음 색인 항목이 닫는 따옴표 (문자열 안은 색인되지 않음)
+    auto pushString = [&](size_t open, bool is_key) {
+        if (!available()) return false;
+        size_t close = index[next++];
+        size_t length = close - open - 1;
+        bool escaped = structurals_.hasBackslash && std::memchr(data + open + 1, '\\', length) != nullptr;
+        push(JSONType::String, open + 1, length, is_key, escaped);
+        return true;
+    };
+
+    // 숫자/리터럴 바로 뒤는 공백 또는 다음 색인 항목이어야 함 ("12x", "truex" 거부)
+    auto scalarEnds = [&](size_t end) {
+        return end >= n || isWhitespace(data[end]) || (available() && index[next] == end);
+    };
+
+    // 문자열 안 제어 문자와 토큰 오류 중 문서에서 먼저 나온 위치로 실패
+    // (색인하지 않은 뒷부분의 제어 문자는 offset보다 뒤이므로 지금까지의 결과만 보면 됨)
+    auto failAt = [&](size_t offset) {
+        return fail(std::min(offset, structurals_.stringError));
+    };
+
+    // 값 하나(객체 안이면 키와 ':' 포함)를 읽고, 컨테이너 안이면 뒤따르는 ',' 또는 닫는 괄호까지 처리하는 것을 반복
+    // (상태 변수로 분기하지 않고 문법 순서대로 읽어 색인 항목당 분기를 줄임)
+    bool expect_key = false;
+    while (true) {
+        if (!available()) return failAt(n);
+        size_t i = index[next++];
+        if (expect_key) {
+            if (data[i] != '"') return failAt(i);
+            tokens[parent].count++;
+            if (!pushString(i, true)) return failAt(i);
+            if (!available()) return failAt(n);
+            size_t colon = index[next++];
+            if (data[colon] != ':') return failAt(colon);
+            if (!available()) return failAt(n);
+            i = index[next++];
+        }
+
+        char c = data[i];
+        if (c == '"') {
+            if (!pushString(i, false)) return failAt(i);
+        } else if (c == '{' || c == '[') {
+            bool is_object = c == '{';
+            push(is_object ? JSONType::Object : JSONType::Array, i, 0, false, false);
+            parent = static_cast<uint32_t>(token_count - 1);
+            parent_is_array = !is_object;
+            stack_.push_back(parent);
+            if (!available()) return failAt(n);
+            size_t first = index[next];
+            if (data[first] != (is_object ? '}' : ']')) {
+                // 첫 멤버 / 첫 요소
+                expect_key = is_object;
+                continue;
+            }
+            next++;
+            closeContainer(first);
+        } else if (c == '-' || (c >= '0' && c <= '9')) {
+            size_t end = i;
+            while (end < n && isNumberChar(data[end])) end++;
+            if (!scalarEnds(end)) return failAt(end);
+            push(JSONType::Number, i, end - i, false, false);
+        } else if (json.compare(i, 4, "true") == 0 || json.compare(i, 4, "null") == 0) {
+            if (!scalarEnds(i + 4)) return failAt(i + 4);
+            push(c == 't' ? JSONType::Bool : JSONType::Null, i, 4, false, false);
+        } else if (json.compare(i, 5, "false") == 0) {
+            if (!scalarEnds(i + 5)) return failAt(i + 5);
+            push(JSONType::Bool, i, 5, false, false);
+        } else {
+            return failAt(i);
+        }
+
+        // 값 다음: ','면 다음 값(객체는 키부터), 닫는 괄호면 컨테이너도 값 하나가 끝난 것이므로 반복
+        bool more = false;
+        while (parent != ROOT) {
+            if (!available()) return failAt(n);
+            size_t j = index[next++];
+            char separator = data[j];
+            if (separator == ',') {
+                expect_key = !parent_is_array;
+                more = true;
+                break;
+            }
+            if (separator != (parent_is_array ? ']' : '}')) return failAt(j);
+            closeContainer(j);
+        }
+        if (!more) break;
+    }
+
+    // 최상위 값 뒤에는 공백만
+    if (available()) {
+        return failAt(index[next]);
+    }
+    if (structurals_.stringError != JSONScanner::npos) {
+        return fail(structurals_.stringError);
+    }
+
+    ok_ = true;
+    return true;
+}
+
+JSONValue JSONDocument::root() const {
+    return ok_ ? JSONValue(this, 0) : JSONValue();
+}
+
+// ===== JSONValue =====
+
+JSONType JSONValue::type() const {
+    return valid() ? doc_->tokens_[index_].type : JSONType::Null;
+}
+
+std::string_view JSONValue::raw() const {
+    if (!valid()) return std::string_view();
+    const JSONDocument::Token& token = doc_->tokens_[index_];
+    return doc_->json_.substr(token.start, token.length);
+}
+
+std::string JSONValue::asString() const {
+    if (!valid()) return "";
+    const JSONDocument::Token& token = doc_->tokens_[index_];
+    std::string_view text = raw();
+    if (token.type != JSONType::String || !token.escaped) {
+        return std::string(text);
+    }
+
+    std::string decoded;
+    decoded.reserve(text.size());
+    for (size_t i = 0; i < text.size(); i++) {
+        char c = text[i];
+        if (c != '\\' || i + 1 >= text.size()) {
+            decoded += c;
+            continue;
+        }
+        char e = text[++i];
+        switch (e) {
+        case 'n': decoded += '\n'; break;
+        case 't': decoded += '\t'; break;
+        case 'r': decoded += '\r'; break;
+        case 'b': decoded += '\b'; break;
+        case 'f': decoded += '\f'; break;
+        case 'u': {
+            auto hex4 = [&](size_t pos, unsigned& out) {
+                if (pos + 4 > text.size()) return false;
+                out = 0;
+                for (size_t k = pos; k < pos + 4; k++) {
+                    char h = text[k];
+                    out <<= 4;
+                    if (h >= '0' && h <= '9') out |= h - '0';
+                    else if (h >= 'a' && h <= 'f') out |= h - 'a' + 10;
+                    else if (h >= 'A' && h <= 'F') out |= h - 'A' + 10;
+                    else return false;
+                }
+                return true;
+            };
+            unsigned cp;
+            if (!hex4(i + 1, cp)) {
+                decoded += e;
+                break;
+            }
+            i += 4;
+            // 서로게이트 쌍
+            unsigned low;
+            if (cp >= 0xD800 && cp <= 0xDBFF && i + 2 < text.size() && text[i + 1] == '\\' &&
+                text[i + 2] == 'u' && hex4(i + 3, low) && low >= 0xDC00 && low <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                i += 6;
+            }
+            // UTF-8 인코딩
+            if (cp < 0x80) {
+                decoded += static_cast<char>(cp);
+            } else if (cp < 0x800) {
+                decoded += static_cast<char>(0xC0 | (cp >> 6));
+                decoded += static_cast<char>(0x80 | (cp & 0x3F));
+            } else if (cp < 0x10000) {
+                decoded += static_cast<char>(0xE0 | (cp >> 12));
+                decoded += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                decoded += static_cast<char>(0x80 | (cp & 0x3F));
+            } else {
+                decoded += static_cast<char>(0xF0 | (cp >> 18));
+                decoded += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                decoded += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                decoded += static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            break;
+        }
+        default: decoded += e; break;   // \" \\ \/
+        }
+    }
+    return decoded;
+}
+
+// 10진수 문자열을 double로 변환
+// 유효 숫자 15자리 이하, 10의 지수 22 이하인 일반적인 가격/수량 문자열은 정확히 표현되는
+// 두 값의 곱/나눗셈 한 번으로 변환하고 (올바르게 반올림됨), 그 외에는 strtod를 사용한다
+static bool parseDecimal(std::string_view text, double& out) {
+    static const double POW10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    size_t i = 0;
+    size_t n = text.size();
+    bool negative = false;
+    if (i < n && (text[i] == '-' || text[i] == '+')) {
+        negative = text[i] == '-';
+        i++;
+    }
+
+    uint64_t mantissa = 0;
+    int significant = 0;     // 가수에 담긴 유효 숫자 수
+    int exponent = 0;
+    bool any_digit = false;
+
+    for (; i < n && text[i] >= '0' && text[i] <= '9'; i++) {
+        any_digit = true;
+        if (significant < 19) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(text[i] - '0');
+            if (mantissa != 0) significant++;
+        } else {
+            exponent++;
+        }
+    }
+    if (i < n && text[i] == '.') {
+        for (i++; i < n && text[i] >= '0' && text[i] <= '9'; i++) {
+            any_digit = true;
+            if (significant < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(text[i] - '0');
+                if (mantissa != 0) significant++;
+                exponent--;
+            }
+        }
+    }
+    if (!any_digit) return false;
+
+    if (i < n && (text[i] == 'e' || text[i] == 'E')) {
+        i++;
+        bool exp_negative = false;
+        if (i < n && (text[i] == '-' || text[i] == '+')) {
+            exp_negative = text[i] == '-';
+            i++;
+        }
+        int exp_value = 0;
+        bool exp_digit = false;
+        for (; i < n && text[i] >= '0' && text[i] <= '9'; i++) {
+            exp_digit = true;
+            if (exp_value < 10000) exp_value = exp_value * 10 + (text[i] - '0');
+        }
+        if (!exp_digit) return false;
+        exponent += exp_negative ? -exp_value : exp_value;
+    }
+    if (i != n) return false;
+
+    if (significant <= 15 && exponent >= -22 && exponent <= 22) {
+        double value = static_cast<double>(mantissa);
+        value = exponent < 0 ? value / POW10[-exponent] : value * POW10[exponent];
+        out = negative ? -value : value;
+        return true;
+    }
+
+    // 드문 형식: strtod (NUL 종료가 필요하므로 스택 버퍼에 복사)
+    char buffer[64];
+    if (n >= sizeof(buffer)) return false;
+    std::memcpy(buffer, text.data(), n);
+    buffer[n] = '\0';
+    char* end = nullptr;
+    out = std::strtod(buffer, &end);
+    return end == buffer + n;
+}
+
+bool JSONValue::getDouble(double& out) const {
+    JSONType t = type();
+    if (!valid() || (t != JSONType::Number && t != JSONType::String)) return false;
+    return parseDecimal(raw(), out);
+}
+
+bool JSONValue::getInt(long long& out) const {
+    JSONType t = type();
+    if (!valid() || (t != JSONType::Number && t != JSONType::String)) return false;
+
+    std::string_view text = raw();
+    const char* first = text.data();
+    const char* last = first + text.size();
+    if (first != last && *first == '+') first++;
+    std::from_chars_result result = std::from_chars(first, last, out);
+    return result.ec == std::errc() && result.ptr == last;
+}
+
+double JSONValue::asDouble(double fallback) const {
+    double value;
+    return getDouble(value) ? value : fallback;
+}
+
+long long JSONValue::asInt(long long fallback) const {
+    long long value;
+    if (getInt(value)) return value;
+
+    // "1.0e3" 같은 실수 표기
+    double real;
+    return getDouble(real) ? static_cast<long long>(real) : fallback;
+}
+
+bool JSONValue::asBool(bool fallback) const {
+    JSONType t = type();
+    if (t == JSONType::Bool || t == JSONType::String) {
+        std::string_view text = raw();
+        if (text == "true") return true;
+        if (text == "false") return false;
+    }
+    return fallback;
+}
+
+JSONValue JSONValue::operator[](std::string_view key) const {
+    if (!isObject()) return JSONValue();
+    const auto& tokens = doc_->tokens_;
+    uint32_t end = tokens[index_].end;
+    for (uint32_t i = index_ + 1; i < end; i = tokens[i + 1].end) {
+        if (doc_->json_.substr(tokens[i].start, tokens[i].length) == key) {
+            return JSONValue(doc_, i + 1);
+        }
+    }
+    return JSONValue();
+}
+
+JSONValue JSONValue::at(size_t index) const {
+    if (!isArray()) return JSONValue();
+    const auto& tokens = doc_->tokens_;
+    uint32_t end = tokens[index_].end;
+    uint32_t i = index_ + 1;
+    for (size_t k = 0; k < index && i < end; k++) {
+        i = tokens[i].end;
+    }
+    return i < end ? JSONValue(doc_, i) : JSONValue();
+}
+
+size_t JSONValue::size() const {
+    JSONType t = type();
+    if (!valid() || (t != JSONType::Object && t != JSONType::Array)) return 0;
+    return doc_->tokens_[index_].count;
+}
+
+JSONValue JSONValue::find(std::string_view key) const {
+    if (!valid()) return JSONValue();
+    const auto& tokens = doc_->tokens_;
+    uint32_t end = tokens[index_].end;
+    for (uint32_t i = index_ + 1; i < end; i++) {
+        if (tokens[i].is_key && doc_->json_.substr(tokens[i].start, tokens[i].length) == key) {
+            return JSONValue(doc_, i + 1);
+        }
+    }
+    return JSONValue();
+}
+
+JSONValue::Iterator JSONValue::begin() const {
+    bool is_object = isObject();
+    if (!is_object && !isArray()) return end();
+    return Iterator(doc_, index_ + 1, is_object);
+}
+
+JSONValue::Iterator JSONValue::end() const {
+    if (!valid()) return Iterator(nullptr, 0, false);
+    return Iterator(doc_, doc_->tokens_[index_].end, isObject());
+}
+
+JSONValue JSONValue::Iterator::operator*() const {
+    return JSONValue(doc_, is_object_ ? index_ + 1 : index_);
+}
+
+std::string_view JSONValue::Iterator::key() const {
+    if (!is_object_) return std::string_view();
+    const JSONDocument::Token& token = doc_->tokens_[index_];
+    return doc_->json_.substr(token.start, token.length);
+}
+
+JSONValue::Iterator& JSONValue::Iterator::operator++() {
+    index_ = doc_->tokens_[is_object_ ? index_ + 1 : index_].end;
+    return *this;
+}
+
+// ===== JSONArrayStream =====
+
+JSONArrayStream::JSONArrayStream(std::string key, ElementHandler handler)
+    : key_(std::move(key)), handler_(std::move(handler)), state_(State::Seeking), failed_(false), elements_(0),
+      depth_(0), array_depth_(-1), in_string_(false), escape_(false), key_pending_(false),
+      last_string_matches_(false), capturing_(false), scalar_element_(false) {
+}
+
+bool JSONArrayStream::emitElement() {
+    if (!doc_.parse(element_)) {
+        failed_ = true;
+        return false;
+    }
+    elements_++;
+    if (!handler_(doc_.root())) {
+        state_ = State::Done;
+        return false;
+    }
+    return true;
+}
+
+bool JSONArrayStream::feed(const char* data, size_t length) {
+    // 키 비교용 문자열은 이 길이까지만 보관 (더 길면 키와 일치할 수 없음)
+    const size_t MAX_KEY_LENGTH = 64;
+
+    if (failed_) return false;
+    if (state_ == State::Done) return true;
+
+    size_t capture_start = 0;   // 이번 청크에서 요소 수집이 시작된 위치
+    auto startCapture = [&](size_t pos, bool scalar) {
+        capturing_ = true;
+        scalar_element_ = scalar;
+        element_.clear();
+        capture_start = pos;
+    };
+    auto finishCapture = [&](size_t end) {
+        element_.append(data + capture_start, end - capture_start);
+        capturing_ = false;
+        return emitElement();
+    };
+
+    size_t i = 0;
+    while (i < length) {
+        if (in_string_) {
+            if (escape_) {
+                // 청크 경계에 걸친 이스케이프 문자
+                escape_ = false;
+                if (!capturing_) string_buffer_ += data[i];
+                i++;
+                continue;
+            }
+
+            size_t start = i;
+            i = JSONScanner::findStringSpecial(data, i, length);
+            if (!capturing_ && string_buffer_.size() <= MAX_KEY_LENGTH) {
+                string_buffer_.append(data + start, std::min(i - start, MAX_KEY_LENGTH + 1));
+            }
+            if (i >= length) break;
+
+            char c = data[i++];
+            if (c == '"') {
+                in_string_ = false;
+                if (!capturing_) last_string_matches_ = string_buffer_ == key_;
+            } else if (c == '\\') {
+                escape_ = true;
+                if (!capturing_) string_buffer_ += c;
+            }
+            continue;
+        }
+
+        char c = data[i];
+
+        // 숫자/리터럴/문자열 요소는 구분자에서 끝남
+        if (capturing_ && scalar_element_ && (c == ',' || c == ']' || isWhitespace(c))) {
+            if (!finishCapture(i)) return false;
+        }
+
+        bool element_start = state_ == State::InArray && depth_ == array_depth_ && !capturing_;
+        switch (c) {
+        case '"':
+            in_string_ = true;
+            key_pending_ = false;
+            if (element_start) startCapture(i, true);   // 문자열 요소도 닫는 따옴표 뒤 구분자에서 끝남
+            if (!capturing_) string_buffer_.clear();
+            break;
+        case ':':
+            // 최상위 객체의 직접 멤버만 (요소 안의 같은 이름 키가 먼저 나와도 대상이 아님)
+            key_pending_ = last_string_matches_ && depth_ == 1;
+            break;
+        case '{':
+        case '[':
+            if (state_ == State::Seeking && c == '[' && (key_.empty() ? depth_ == 0 : key_pending_)) {
+                state_ = State::InArray;
+                array_depth_ = depth_ + 1;
+            } else if (element_start) {
+                startCapture(i, false);
+            }
+            key_pending_ = false;
+            depth_++;
+            break;
+        case '}':
+        case ']':
+            depth_--;
+            if (state_ == State::InArray) {
+                if (capturing_ && depth_ == array_depth_) {
+                    if (!finishCapture(i + 1)) return false;
+                } else if (depth_ < array_depth_) {
+                    state_ = State::Done;
+                    return true;
+                }
+            }
+            break;
+        default:
+            if (!isWhitespace(c)) {
+                key_pending_ = false;
+                if (element_start && c != ',') startCapture(i, true);
+            }
+            break;
+        }
+        i++;
+    }
+
+    // 청크 끝까지 수집한 부분 보관
+    if (capturing_) {
+        element_.append(data + capture_start, length - capture_start);
+    }
+    return true;
+}
+
+// ===== JSONParser (호환용 래퍼) =====
+
 std::string JSONParser::extractValue(const std::string& json, const std::string& key) {
+    JSONDocument doc(json);
+    if (!doc.ok()) {
+        return legacyExtractValue(json, key);
+    }
+    return std::string(doc.root().find(key).raw());
+}
+
+double JSONParser::extractDouble(const std::string& json, const std::string& key) {
+    std::string value = extractValue(json, key);
+    if (value.empty()) return 0.0;
+    
+    try {
+        return std::stod(removeQuotes(value));
+    } catch (...) {
+        return 0.0;
+    }
+}
+
+std::string JSONParser::extractString(const std::string& json, const std::string& key) {
+    return removeQuotes(extractValue(json, key));
+}
+
+bool JSONParser::extractBool(const std::string& json, const std::string& key) {
+    std::string value = removeQuotes(extractValue(json, key));
+    return value == "true";
+}
+
+std::vector<std::string> JSONParser::splitArray(const std::string& json) {
+    std::vector<std::string> elements;
+    
+    JSONDocument doc(json);
+    if (doc.ok()) {
+        JSONValue root = doc.root();
+        if (root.isArray()) {
+            elements.reserve(root.size());
+            for (JSONValue element : root) {
+                elements.emplace_back(element.isString() ? "\"" + std::string(element.raw()) + "\""
+                                                         : std::string(element.raw()));
+            }
+        }
+        return elements;
+    }
+    
+    size_t pos = json.find_first_not_of(" \t\r\n");
+    if (pos == std::string::npos || json[pos] != '[') {
+        return elements;
+    }
+    
+    int depth = 0;
+    bool in_string = false;
+    size_t element_start = std::string::npos;
+    
+    for (size_t i = pos + 1; i < json.length(); i++) {
+        char c = json[i];
+        
+        if (in_string) {
+            if (c == '\\') {
+                i++; // 이스케이프된 문자 건너뛰기
+            } else if (c == '"') {
+                in_string = false;
+            }
+            continue;
+        }
+        
+        if (element_start == std::string::npos && c != ' ' && c != '\t' && c != '\r' && c != '\n' && c != ',' && c != ']') {
+            element_start = i;
+        }
+        
+        if (c == '"') {
+            in_string = true;
+        } else if (c == '{' || c == '[') {
+            depth++;
+        } else if ((c == '}' || c == ']') && depth > 0) {
+            depth--;
+        } else if ((c == ',' || c == ']') && depth == 0) {
+            if (element_start != std::string::npos) {
+                elements.push_back(trim(json.substr(element_start, i - element_start)));
+                element_start = std::string::npos;
+            }
+            if (c == ']') break;
+        }
+    }
+    
+    return elements;
+}
+
+// 키 뒤에 오는 값의 시작 위치 (값이 open 문자로 시작하지 않으면 npos)
+static size_t findValueStart(const std::string& json, const std::string& key, char open) {
+    std::string search_key = "\"" + key + "\"";
+    size_t pos = 0;
+    while ((pos = json.find(search_key, pos)) != std::string::npos) {
+        size_t value = json.find_first_not_of(" \t\r\n", pos + search_key.length());
+        if (value != std::string::npos && json[value] == ':') {
+            value = json.find_first_not_of(" \t\r\n", value + 1);
+            if (value != std::string::npos && json[value] == open) return value;
+        }
+        pos += search_key.length();
+    }
+    return std::string::npos;
+}
+
+// 키에 해당하는 하위 객체를 중괄호 포함 문자열로 추출 (예: "o":{...})
+std::string JSONParser::extractObject(const std::string& json, const std::string& key) {
+    JSONDocument doc(json);
+    if (doc.ok()) {
+        JSONValue value = doc.root().find(key);
+        return value.isObject() ? std::string(value.raw()) : "";
+    }
+
+    size_t start = findValueStart(json, key, '{');
+    if (start == std::string::npos) return "";
+
+    int depth = 0;
+    bool in_string = false;
+    for (size_t i = start; i < json.length(); i++) {
+        char c = json[i];
+        if (in_string) {
+            if (c == '\\') i++;
+            else if (c == '"') in_string = false;
+            continue;
+        }
+        if (c == '"') in_string = true;
+        else if (c == '{') depth++;
+        else if (c == '}' && --depth == 0) return json.substr(start, i - start + 1);
+    }
+    return "";
+}
+
+// 키에 해당하는 배열의 각 요소 추출 (예: "B":[...])
+std::vector<std::string> JSONParser::extractArray(const std::string& json, const std::string& key) {
+    JSONDocument doc(json);
+    if (doc.ok()) {
+        JSONValue value = doc.root().find(key);
+        return value.isArray() ? splitArray(std::string(value.raw())) : std::vector<std::string>();
+    }
+
+    size_t start = findValueStart(json, key, '[');
+    if (start == std::string::npos) return {};
+    return splitArray(json.substr(start));
+}
+
+// 완전한 JSON이 아닌 조각용 문자열 검색 (기존 구현)
+std::string JSONParser::legacyExtractValue(const std::string& json, const std::string& key) {
     std::string search_key = "\"" + key + "\"";
     size_t key_pos = json.find(search_key);
     
@@ -37,26 +794,6 @@ std::string JSONParser::extractValue(const std::string& json, const std::string&
     return trim(json.substr(value_start, value_end - value_start));
 }
 
-double JSONParser::extractDouble(const std::string& json, const std::string& key) {
-    std::string value = extractValue(json, key);
-    if (value.empty()) return 0.0;
-    
-    try {
-        return std::stod(removeQuotes(value));
-    } catch (...) {
-        return 0.0;
-    }
-}
-
-std::string JSONParser::extractString(const std::string& json, const std::string& key) {
-    return removeQuotes(extractValue(json, key));
-}
-
-bool JSONParser::extractBool(const std::string& json, const std::string& key) {
-    std::string value = removeQuotes(extractValue(json, key));
-    return value == "true";
-}
-
 std::string JSONParser::trim(const std::string& str) {
     size_t start = str.find_first_not_of(" \t\r\n");
     if (start == std::string::npos) return "";
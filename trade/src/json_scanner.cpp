@@ -0,0 +1,484 @@
+#include "json_scanner.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define JSON_SCANNER_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__)
+#define JSON_SCANNER_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+// 색인 공통 과정은 각 구현의 target 함수 안으로 펼쳐져야 popcnt/tzcnt 명령을 쓴다
+#if defined(__GNUC__)
+#define JSON_SCANNER_INLINE inline __attribute__((always_inline))
+#else
+#define JSON_SCANNER_INLINE inline
+#endif
+
+namespace {
+
+inline bool isSpecial(char c) {
+    return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+}
+
+inline bool isWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+inline unsigned countTrailingZeros(unsigned mask) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+    unsigned count = 0;
+    while ((mask & 1u) == 0) {
+        mask >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+JSON_SCANNER_INLINE unsigned countTrailingZeros64(uint64_t mask) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#else
+    unsigned count = 0;
+    while ((mask & 1u) == 0) {
+        mask >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+JSON_SCANNER_INLINE unsigned popCount64(uint64_t mask) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_popcountll(mask));
+#else
+    unsigned count = 0;
+    for (; mask != 0; mask &= mask - 1) count++;
+    return count;
+#endif
+}
+
+// ===== 스칼라 구현 =====
+
+size_t findStringSpecialScalar(const char* data, size_t pos, size_t n) {
+    while (pos < n && !isSpecial(data[pos])) pos++;
+    return pos;
+}
+
+size_t skipWhitespaceScalar(const char* data, size_t pos, size_t n) {
+    while (pos < n && isWhitespace(data[pos])) pos++;
+    return pos;
+}
+
+#ifdef JSON_SCANNER_SSE2
+
+// ===== SSE2 구현 (16바이트) =====
+
+size_t findStringSpecialSSE2(const char* data, size_t pos, size_t n) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control_max = _mm_set1_epi8(0x1F);
+
+    for (; pos + 16 <= n; pos += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        // 부호 없는 비교: max(c, 0x1F) == 0x1F 이면 c <= 0x1F
+        __m128i control = _mm_cmpeq_epi8(_mm_max_epu8(chunk, control_max), control_max);
+        __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                                       control);
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(special));
+        if (mask != 0) return pos + countTrailingZeros(mask);
+    }
+    return findStringSpecialScalar(data, pos, n);
+}
+
+size_t skipWhitespaceSSE2(const char* data, size_t pos, size_t n) {
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+
+    for (; pos + 16 <= n; pos += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(chunk, cr), _mm_cmpeq_epi8(chunk, lf)));
+        unsigned mask = ~static_cast<unsigned>(_mm_movemask_epi8(ws)) & 0xFFFFu;
+        if (mask != 0) return pos + countTrailingZeros(mask);
+    }
+    return skipWhitespaceScalar(data, pos, n);
+}
+
+#endif
+
+#ifdef JSON_SCANNER_AVX2
+
+// ===== AVX2 구현 (32바이트, 실행 시 CPU 지원 확인 후 사용) =====
+
+__attribute__((target("avx2")))
+size_t findStringSpecialAVX2(const char* data, size_t pos, size_t n) {
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i control_max = _mm256_set1_epi8(0x1F);
+
+    for (; pos + 32 <= n; pos += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        __m256i control = _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, control_max), control_max);
+        __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote),
+                                                          _mm256_cmpeq_epi8(chunk, backslash)),
+                                          control);
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(special));
+        if (mask != 0) return pos + countTrailingZeros(mask);
+    }
+    return findStringSpecialSSE2(data, pos, n);
+}
+
+__attribute__((target("avx2")))
+size_t skipWhitespaceAVX2(const char* data, size_t pos, size_t n) {
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+
+    for (; pos + 32 <= n; pos += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        __m256i ws = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, space), _mm256_cmpeq_epi8(chunk, tab)),
+                                     _mm256_or_si256(_mm256_cmpeq_epi8(chunk, cr), _mm256_cmpeq_epi8(chunk, lf)));
+        unsigned mask = ~static_cast<unsigned>(_mm256_movemask_epi8(ws));
+        if (mask != 0) return pos + countTrailingZeros(mask);
+    }
+    return skipWhitespaceSSE2(data, pos, n);
+}
+
+#endif
+
+// ===== 구조 문자 색인 =====
+//
+// 64바이트 블록마다 바이트 종류별 비트마스크(비트 i = 블록의 i번째 바이트)를 만든 뒤
+// 비트 연산으로 이스케이프와 문자열 범위를 걸러 색인할 위치만 남긴다.
+// 구현별로 다른 것은 블록 분류뿐이고 그 뒤 과정(IndexBuilder)은 공통이다
+
+struct BlockMasks {
+    uint64_t structural;    // { } [ ] : ,
+    uint64_t whitespace;    // ' ' \t \n \r
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t control;       // < 0x20 (\t \n \r 포함)
+};
+
+// 비트 i = 비트 0..i의 누적 XOR: 여는 따옴표부터 닫는 따옴표 직전까지 1이 된다
+JSON_SCANNER_INLINE uint64_t prefixXor(uint64_t mask) {
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+    return mask;
+}
+
+// 비트가 0이면 63 (분기 없는 펼치기에서 count 뒤의 버려지는 칸에만 쓰임)
+JSON_SCANNER_INLINE unsigned lowestBit(uint64_t mask) {
+    return countTrailingZeros64(mask | (uint64_t{1} << 63));
+}
+
+class IndexBuilder {
+public:
+    explicit IndexBuilder(JSONScanner::StructuralIndex& index)
+        : index_(index),
+          escape_carry_(index.escapeCarry),
+          in_string_carry_(index.inStringCarry),
+          scalar_carry_(index.scalarCarry) {
+        index_.count = 0;
+    }
+
+    // 구간 끝: 다음 구간으로 이어질 상태 저장
+    void finish(size_t end) {
+        index_.scanned = end;
+        index_.escapeCarry = escape_carry_;
+        index_.inStringCarry = in_string_carry_;
+        index_.scalarCarry = scalar_carry_;
+    }
+
+    // base에서 시작하는 블록 하나를 색인에 추가
+    JSON_SCANNER_INLINE void addBlock(const BlockMasks& block, size_t base) {
+        // 이스케이프된 바이트: 이스케이프되지 않은 '\\' 바로 다음 바이트 ('\\'는 드물어서 비트 단위로 처리)
+        uint64_t escaped = escape_carry_;
+        escape_carry_ = 0;
+        if (block.backslash != 0) {
+            index_.hasBackslash = true;
+            for (uint64_t backslash = block.backslash; backslash != 0; backslash &= backslash - 1) {
+                unsigned bit = countTrailingZeros64(backslash);
+                if ((escaped >> bit) & 1) continue;
+                if (bit == 63) {
+                    escape_carry_ = 1;
+                } else {
+                    escaped |= uint64_t{1} << (bit + 1);
+                }
+            }
+        }
+
+        uint64_t quote = block.quote & ~escaped;
+        uint64_t in_string = prefixXor(quote) ^ in_string_carry_;
+        in_string_carry_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+        uint64_t bad = block.control & in_string & ~escaped;
+        if (bad != 0 && index_.stringError == JSONScanner::npos) {
+            index_.stringError = base + countTrailingZeros64(bad);
+        }
+
+        // 숫자/리터럴 구간은 첫 바이트만 (직전 바이트가 같은 구간이면 제외)
+        uint64_t scalar = ~(block.structural | block.whitespace | quote | in_string);
+        uint64_t scalar_start = scalar & ~((scalar << 1) | scalar_carry_);
+        scalar_carry_ = scalar >> 63;
+
+        flatten((block.structural & ~in_string) | quote | scalar_start, static_cast<uint32_t>(base));
+    }
+
+    // 마지막 불완전 블록을 공백으로 채운 복사본 (공백은 색인에 들어가지 않음)
+    const char* padTail(const char* data, size_t length) {
+        std::memset(tail_, ' ', sizeof(tail_));
+        std::memcpy(tail_, data, length);
+        return tail_;
+    }
+
+private:
+    // 비트 위치를 오프셋으로 펼침: 블록당 항목 수가 들쭉날쭉해 분기 예측이 어려우므로
+    // 8개씩 무조건 기록하고 개수만 popcount로 더한다 (count 뒤의 칸은 다음 블록이 덮어씀)
+    JSON_SCANNER_INLINE void flatten(uint64_t bits, uint32_t base) {
+        std::vector<uint32_t>& positions = index_.positions;
+        if (positions.size() < index_.count + 64) {
+            positions.resize(std::max(index_.count + 64, positions.size() * 2));
+        }
+        uint32_t* out = positions.data() + index_.count;
+        index_.count += popCount64(bits);
+        for (unsigned i = 0; i < 8; i++) {
+            out[i] = base + lowestBit(bits);
+            bits &= bits - 1;
+        }
+        for (out += 8; bits != 0; out += 8) {
+            for (unsigned i = 0; i < 8; i++) {
+                out[i] = base + lowestBit(bits);
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    JSONScanner::StructuralIndex& index_;
+    uint64_t escape_carry_;       // 이전 블록이 이스케이프되지 않은 '\\'로 끝남
+    uint64_t in_string_carry_;    // 이전 블록이 문자열 안에서 끝남 (전부 1)
+    uint64_t scalar_carry_;       // 이전 블록이 숫자/리터럴 구간으로 끝남
+    char tail_[64];
+};
+
+// 스칼라 분류용 바이트 종류 표
+enum : uint8_t {
+    CLASS_STRUCTURAL = 1,
+    CLASS_WHITESPACE = 2,
+    CLASS_QUOTE = 4,
+    CLASS_BACKSLASH = 8,
+    CLASS_CONTROL = 16,
+};
+
+constexpr std::array<uint8_t, 256> makeByteClasses() {
+    std::array<uint8_t, 256> classes{};
+    for (unsigned c = 0; c < 0x20; c++) classes[c] = CLASS_CONTROL;
+    for (unsigned char c : {'{', '}', '[', ']', ':', ','}) classes[c] = CLASS_STRUCTURAL;
+    for (unsigned char c : {' ', '\t', '\n', '\r'}) classes[c] |= CLASS_WHITESPACE;
+    classes['"'] = CLASS_QUOTE;
+    classes['\\'] = CLASS_BACKSLASH;
+    return classes;
+}
+
+constexpr std::array<uint8_t, 256> BYTE_CLASSES = makeByteClasses();
+
+BlockMasks classifyScalar(const char* block) {
+    BlockMasks masks = {0, 0, 0, 0, 0};
+    for (unsigned i = 0; i < 64; i++) {
+        uint64_t cls = BYTE_CLASSES[static_cast<unsigned char>(block[i])];
+        masks.structural |= (cls & 1) << i;
+        masks.whitespace |= ((cls >> 1) & 1) << i;
+        masks.quote |= ((cls >> 2) & 1) << i;
+        masks.backslash |= ((cls >> 3) & 1) << i;
+        masks.control |= ((cls >> 4) & 1) << i;
+    }
+    return masks;
+}
+
+void buildStructuralIndexScalar(const char* data, size_t end, JSONScanner::StructuralIndex& index) {
+    IndexBuilder builder(index);
+    size_t base = index.scanned;
+    for (; base + 64 <= end; base += 64) builder.addBlock(classifyScalar(data + base), base);
+    if (base < end) builder.addBlock(classifyScalar(builder.padTail(data + base, end - base)), base);
+    builder.finish(end);
+}
+
+#ifdef JSON_SCANNER_AVX2
+
+// 니블 표 분류 (pshufb): 하위 니블 표와 상위 니블 표를 찾아 AND 한 값의
+// 0x01 ','  0x02 ':'  0x04 괄호 네 개  0x08 ' '  0x10 \t \n \r
+#define JSON_SCANNER_LOW_NIBBLE_CLASSES 0x08, 0, 0, 0, 0, 0, 0, 0, 0, 0x10, 0x12, 0x04, 0x01, 0x14, 0, 0
+#define JSON_SCANNER_HIGH_NIBBLE_CLASSES 0x10, 0, 0x09, 0x02, 0, 0x04, 0, 0x04, 0, 0, 0, 0, 0, 0, 0, 0
+
+// ===== SSE4.2 구조 문자 분류 (16바이트 x 4, 실행 시 CPU 지원 확인 후 사용) =====
+
+inline uint64_t bits(__m128i mask) {
+    return static_cast<unsigned>(_mm_movemask_epi8(mask));
+}
+
+__attribute__((target("sse4.2")))
+inline BlockMasks classifySSE42(const char* block) {
+    const __m128i low_table = _mm_setr_epi8(JSON_SCANNER_LOW_NIBBLE_CLASSES);
+    const __m128i high_table = _mm_setr_epi8(JSON_SCANNER_HIGH_NIBBLE_CLASSES);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i structural_bits = _mm_set1_epi8(0x07);
+    const __m128i whitespace_bits = _mm_set1_epi8(0x18);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control_max = _mm_set1_epi8(0x1F);
+
+    BlockMasks masks = {0, 0, 0, 0, 0};
+    for (unsigned i = 0; i < 4; i++) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+        __m128i cls = _mm_and_si128(_mm_shuffle_epi8(low_table, _mm_and_si128(chunk, nibble)),
+                                    _mm_shuffle_epi8(high_table, _mm_and_si128(_mm_srli_epi16(chunk, 4), nibble)));
+        unsigned shift = 16 * i;
+        masks.structural |= (~bits(_mm_cmpeq_epi8(_mm_and_si128(cls, structural_bits), zero)) & 0xFFFF) << shift;
+        masks.whitespace |= (~bits(_mm_cmpeq_epi8(_mm_and_si128(cls, whitespace_bits), zero)) & 0xFFFF) << shift;
+        masks.quote |= bits(_mm_cmpeq_epi8(chunk, quote)) << shift;
+        masks.backslash |= bits(_mm_cmpeq_epi8(chunk, backslash)) << shift;
+        masks.control |= bits(_mm_cmpeq_epi8(_mm_max_epu8(chunk, control_max), control_max)) << shift;
+    }
+    return masks;
+}
+
+__attribute__((target("sse4.2,popcnt")))
+void buildStructuralIndexSSE42(const char* data, size_t end, JSONScanner::StructuralIndex& index) {
+    IndexBuilder builder(index);
+    size_t base = index.scanned;
+    for (; base + 64 <= end; base += 64) builder.addBlock(classifySSE42(data + base), base);
+    if (base < end) builder.addBlock(classifySSE42(builder.padTail(data + base, end - base)), base);
+    builder.finish(end);
+}
+
+// ===== AVX2 구조 문자 분류 (32바이트 x 2) =====
+
+__attribute__((target("avx2")))
+inline uint64_t bits(__m256i mask) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(mask));
+}
+
+__attribute__((target("avx2")))
+inline BlockMasks classifyAVX2(const char* block) {
+    // vpshufb는 128비트 레인별로 찾으므로 표를 두 레인에 복사
+    const __m256i low_table = _mm256_setr_epi8(JSON_SCANNER_LOW_NIBBLE_CLASSES, JSON_SCANNER_LOW_NIBBLE_CLASSES);
+    const __m256i high_table = _mm256_setr_epi8(JSON_SCANNER_HIGH_NIBBLE_CLASSES, JSON_SCANNER_HIGH_NIBBLE_CLASSES);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i structural_bits = _mm256_set1_epi8(0x07);
+    const __m256i whitespace_bits = _mm256_set1_epi8(0x18);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i control_max = _mm256_set1_epi8(0x1F);
+
+    BlockMasks masks = {0, 0, 0, 0, 0};
+    for (unsigned i = 0; i < 2; i++) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32 * i));
+        __m256i cls = _mm256_and_si256(_mm256_shuffle_epi8(low_table, _mm256_and_si256(chunk, nibble)),
+                                       _mm256_shuffle_epi8(high_table, _mm256_and_si256(_mm256_srli_epi16(chunk, 4), nibble)));
+        unsigned shift = 32 * i;
+        masks.structural |= (~bits(_mm256_cmpeq_epi8(_mm256_and_si256(cls, structural_bits), zero)) & 0xFFFFFFFFu) << shift;
+        masks.whitespace |= (~bits(_mm256_cmpeq_epi8(_mm256_and_si256(cls, whitespace_bits), zero)) & 0xFFFFFFFFu) << shift;
+        masks.quote |= bits(_mm256_cmpeq_epi8(chunk, quote)) << shift;
+        masks.backslash |= bits(_mm256_cmpeq_epi8(chunk, backslash)) << shift;
+        masks.control |= bits(_mm256_cmpeq_epi8(_mm256_max_epu8(chunk, control_max), control_max)) << shift;
+    }
+    return masks;
+}
+
+__attribute__((target("avx2,popcnt,bmi")))
+void buildStructuralIndexAVX2(const char* data, size_t end, JSONScanner::StructuralIndex& index) {
+    IndexBuilder builder(index);
+    size_t base = index.scanned;
+    for (; base + 64 <= end; base += 64) builder.addBlock(classifyAVX2(data + base), base);
+    if (base < end) builder.addBlock(classifyAVX2(builder.padTail(data + base, end - base)), base);
+    builder.finish(end);
+}
+
+#endif
+
+struct Kernels {
+    size_t (*find_string_special)(const char*, size_t, size_t);
+    size_t (*skip_whitespace)(const char*, size_t, size_t);
+    void (*build_structural_index)(const char*, size_t, JSONScanner::StructuralIndex&);
+    const char* name;
+};
+
+// 이 CPU에서 쓸 수 있는 구현 (넓은 것부터)
+std::vector<Kernels> supportedKernels() {
+    std::vector<Kernels> supported;
+#ifdef JSON_SCANNER_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt") && __builtin_cpu_supports("bmi")) {
+        supported.push_back({findStringSpecialAVX2, skipWhitespaceAVX2, buildStructuralIndexAVX2, "avx2"});
+    }
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) {
+        supported.push_back({findStringSpecialSSE2, skipWhitespaceSSE2, buildStructuralIndexSSE42, "sse4.2"});
+    }
+#endif
+#ifdef JSON_SCANNER_SSE2
+    supported.push_back({findStringSpecialSSE2, skipWhitespaceSSE2, buildStructuralIndexScalar, "sse2"});
+#endif
+    supported.push_back({findStringSpecialScalar, skipWhitespaceScalar, buildStructuralIndexScalar, "scalar"});
+    return supported;
+}
+
+Kernels& kernels() {
+    static Kernels selected = supportedKernels().front();
+    return selected;
+}
+
+}  // namespace
+
+size_t JSONScanner::findStringSpecial(const char* data, size_t pos, size_t n) {
+    return kernels().find_string_special(data, pos, n);
+}
+
+size_t JSONScanner::skipWhitespace(const char* data, size_t pos, size_t n) {
+    return kernels().skip_whitespace(data, pos, n);
+}
+
+void JSONScanner::buildStructuralIndex(const char* data, size_t n, StructuralIndex& index, size_t max_bytes) {
+    // 중간 구간은 블록 경계에서 끝나야 함 (불완전 블록은 문서의 마지막에만)
+    size_t window = std::max<size_t>(max_bytes & ~size_t{63}, 64);
+    size_t end = n - std::min(index.scanned, n) > window ? index.scanned + window : n;
+    kernels().build_structural_index(data, end, index);
+}
+
+const char* JSONScanner::implementation() {
+    return kernels().name;
+}
+
+std::vector<const char*> JSONScanner::availableImplementations() {
+    std::vector<const char*> names;
+    for (const Kernels& candidate : supportedKernels()) {
+        names.push_back(candidate.name);
+    }
+    return names;
+}
+
+bool JSONScanner::useImplementation(std::string_view name) {
+    for (const Kernels& candidate : supportedKernels()) {
+        if (name == candidate.name) {
+            kernels() = candidate;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,172 @@
+#include "latency_monitor.h"
+#include "connection_pool.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+
+static int64_t nowMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const char* toString(LatencyStage stage) {
+    switch (stage) {
+        case LatencyStage::Sign: return "sign";
+        case LatencyStage::Dns: return "dns";
+        case LatencyStage::Connect: return "connect";
+        case LatencyStage::Tls: return "tls";
+        case LatencyStage::Server: return "server";
+        case LatencyStage::Transfer: return "transfer";
+        case LatencyStage::Total: return "total";
+        case LatencyStage::Parse: return "parse";
+        case LatencyStage::Count: break;
+    }
+    return "";
+}
+
+// === LatencyHistogram ===
+
+LatencyHistogram::LatencyHistogram() : count_(0), max_(0), sum_(0.0) {
+    counts_.fill(0);
+}
+
+// 128 미만은 1us 단위 그대로, 그 이상은 상위 7비트로 구간을 정함
+int LatencyHistogram::indexOf(int64_t micros) {
+    if (micros < 2 * SUB_BUCKET_HALF) {
+        return static_cast<int>(micros);
+    }
+    int magnitude = (63 - __builtin_clzll(static_cast<uint64_t>(micros))) - (SUB_BUCKET_BITS - 1);
+    int sub_bucket = static_cast<int>(micros >> magnitude);
+    return (magnitude + 1) * SUB_BUCKET_HALF + (sub_bucket - SUB_BUCKET_HALF);
+}
+
+int64_t LatencyHistogram::highestEquivalent(int index) {
+    if (index < 2 * SUB_BUCKET_HALF) {
+        return index;
+    }
+    int magnitude = index / SUB_BUCKET_HALF - 1;
+    int64_t sub_bucket = index % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+    return ((sub_bucket + 1) << magnitude) - 1;
+}
+
+void LatencyHistogram::record(int64_t micros) {
+    const int64_t limit = (int64_t(1) << (MAX_MAGNITUDE + SUB_BUCKET_BITS)) - 1;
+    micros = std::max<int64_t>(0, std::min(micros, limit));
+
+    counts_[indexOf(micros)]++;
+    count_++;
+    max_ = std::max(max_, micros);
+    sum_ += static_cast<double>(micros);
+}
+
+double LatencyHistogram::mean() const {
+    return count_ ? sum_ / static_cast<double>(count_) : 0.0;
+}
+
+int64_t LatencyHistogram::percentile(double percent) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    uint64_t target = static_cast<uint64_t>(static_cast<double>(count_) * percent / 100.0 + 0.5);
+    target = std::max<uint64_t>(1, std::min(target, count_));
+
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += counts_[i];
+        if (seen >= target) {
+            return std::min(highestEquivalent(i), max_);
+        }
+    }
+    return max_;
+}
+
+// === LatencyMonitor ===
+
+LatencyMonitor& LatencyMonitor::instance() {
+    static LatencyMonitor monitor;
+    return monitor;
+}
+
+LatencyMonitor::StageHistograms& LatencyMonitor::stagesOf(std::string_view endpoint) {
+    auto it = endpoints_.find(endpoint);
+    if (it == endpoints_.end()) {
+        it = endpoints_.emplace(std::string(endpoint), StageHistograms()).first;
+    }
+    return it->second;
+}
+
+void LatencyMonitor::record(std::string_view endpoint, LatencyStage stage, int64_t micros) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stagesOf(endpoint)[static_cast<size_t>(stage)].record(micros);
+}
+
+void LatencyMonitor::recordTransfer(std::string_view endpoint, const RequestTimings& timings, bool reused_connection) {
+    // 시각은 모두 요청 시작부터의 누적값이므로 앞 단계와의 차이가 해당 단계 시간
+    int64_t handshake_end = std::max(timings.connect, timings.appConnect);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    StageHistograms& stages = stagesOf(endpoint);
+
+    if (!reused_connection) {
+        stages[static_cast<size_t>(LatencyStage::Dns)].record(timings.nameLookup);
+        stages[static_cast<size_t>(LatencyStage::Connect)].record(timings.connect - timings.nameLookup);
+        if (timings.appConnect > 0) {
+            stages[static_cast<size_t>(LatencyStage::Tls)].record(timings.appConnect - timings.connect);
+        }
+    }
+    if (timings.startTransfer > 0) {
+        int64_t request_sent = std::max(timings.preTransfer, handshake_end);
+        stages[static_cast<size_t>(LatencyStage::Server)].record(timings.startTransfer - request_sent);
+        stages[static_cast<size_t>(LatencyStage::Transfer)].record(timings.total - timings.startTransfer);
+    }
+    stages[static_cast<size_t>(LatencyStage::Total)].record(timings.total);
+}
+
+void LatencyMonitor::dump(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (endpoints_.empty()) {
+        out << "기록된 요청이 없습니다." << std::endl;
+        return;
+    }
+
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(2);
+
+    for (const auto& entry : endpoints_) {
+        out << entry.first << std::endl;
+        out << "  stage       count      mean     p50     p90     p99      max  (ms)" << std::endl;
+        for (size_t i = 0; i < entry.second.size(); i++) {
+            const LatencyHistogram& histogram = entry.second[i];
+            if (histogram.count() == 0) {
+                continue;
+            }
+            out << "  " << std::left << std::setw(9) << toString(static_cast<LatencyStage>(i)) << std::right
+                << std::setw(8) << histogram.count()
+                << std::setw(10) << histogram.mean() / 1000.0
+                << std::setw(8) << histogram.percentile(50) / 1000.0
+                << std::setw(8) << histogram.percentile(90) / 1000.0
+                << std::setw(8) << histogram.percentile(99) / 1000.0
+                << std::setw(9) << histogram.max() / 1000.0 << std::endl;
+        }
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+void LatencyMonitor::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    endpoints_.clear();
+}
+
+// === LatencyTimer ===
+
+LatencyTimer::LatencyTimer(const char* endpoint, LatencyStage stage)
+    : endpoint_(endpoint), stage_(stage), start_(nowMicros()) {
+}
+
+LatencyTimer::~LatencyTimer() {
+    LatencyMonitor::instance().record(endpoint_, stage_, nowMicros() - start_);
+}
@@ -1,5 +1,7 @@
 #include "binance_api.h"
 #include "secure_storage.h"
+#include "latency_monitor.h"
+#include "position_store.h"
 #include <iostream>
 #include <iomanip>
 #include <string>
@@ -7,11 +9,14 @@
 #include <cmath>
 #include <algorithm>
 #include <vector>
+#include <future>
+#include <thread>
 
 #ifdef _WIN32
 #include <conio.h>
 #else
 #include <cstdlib>
+#include <csignal>
 #endif
 
 void printAccountInfo(const AccountInfo& info) {
@@ -88,6 +93,12 @@ void printFuturesPosition(const FuturesPosition& position) {
             std::cout << std::endl;
             std::cout << "수익률: " << std::fixed << std::setprecision(2) << position.percentage << "%" << std::endl;
             std::cout << "레버리지: " << position.leverage << "x" << std::endl;
+            // 스트림 포지션 저장소에서 온 값일 때만 계산되어 있음
+            if (position.liquidationDistance != 0) {
+                std::cout << "ROE: " << std::fixed << std::setprecision(2) << position.roe << "%" << std::endl;
+                std::cout << "청산 거리 (증거금 소진 기준): " << std::fixed << std::setprecision(2)
+                          << position.liquidationDistance << "%" << std::endl;
+            }
         }
     } else {
         std::cout << "포지션 조회 실패: " << position.error << std::endl;
@@ -167,8 +178,8 @@ void printFuturesSymbols(const FuturesSymbolsResponse& response) {
         const auto& symbol = sorted_symbols[i];
         std::cout << std::left << std::setw(12) << symbol.symbol
                   << std::setw(8) << symbol.baseAsset
-                  << std::setw(12) << std::fixed << std::setprecision(6) << symbol.minQty
-                  << std::setw(12) << std::fixed << std::setprecision(2) << symbol.minNotional
+                  << std::setw(12) << symbol.minQty.toString()
+                  << std::setw(12) << symbol.minNotional.toString()
                   << std::setw(8) << symbol.status << std::endl;
     }
     
@@ -205,6 +216,15 @@ std::string getHiddenInput(const std::string& prompt) {
     return input;
 }
 
+// 메뉴에서 선택할 수 있는 자산 심볼
+const std::vector<std::string>& supportedAssets() {
+    static const std::vector<std::string> symbols = {
+        "BTCUSDT", "ETHUSDT", "BNBUSDT", "ADAUSDT", "XRPUSDT", "SOLUSDT",
+        "DOTUSDT", "DOGEUSDT", "AVAXUSDT", "MATICUSDT", "LTCUSDT", "LINKUSDT"
+    };
+    return symbols;
+}
+
 std::string selectAsset() {
     std::cout << "\n=== 거래할 자산을 선택하세요 ===" << std::endl;
     std::cout << "1. BTC (Bitcoin)" << std::endl;
@@ -260,7 +280,73 @@ std::string getAssetName(const std::string& symbol) {
     return symbol;
 }
 
+// 환경 변수로 전송 방식 설정 (BINANCE_HTTP2=1 이면 HTTP/2 다중화 사용)
+// 수량/가격 입력을 문자열 그대로 고정소수점으로 변환 (형식 오류 시 false)
+bool readDecimal(Decimal& value) {
+    std::string input;
+    std::cin >> input;
+    std::cin.ignore();
+    return Decimal::parse(input, value);
+}
+
+void configureTransport(BinanceAPI& binance) {
+    const char* http2 = getenv("BINANCE_HTTP2");
+    if (http2 && std::string(http2) == "1") {
+        binance.setHttp2Enabled(true);
+    }
+    
+    // WebSocket API 주문 세션 (BINANCE_WS_ORDERS=1 이면 주문을 WebSocket 연결 하나로 전송)
+    const char* ws_orders = getenv("BINANCE_WS_ORDERS");
+    if (ws_orders && std::string(ws_orders) == "1") {
+        binance.setOrderSessionEnabled(true);
+    }
+    const char* spot_ws_api = getenv("BINANCE_SPOT_WS_API_URL");
+    const char* futures_ws_api = getenv("BINANCE_FUTURES_WS_API_URL");
+    if (spot_ws_api || futures_ws_api) {
+        binance.setOrderSessionEndpoints(spot_ws_api ? spot_ws_api : "wss://ws-api.binance.com:443/ws-api/v3",
+                                         futures_ws_api ? futures_ws_api : "wss://ws-fapi.binance.com/ws-fapi/v1");
+    }
+    
+    // REST 주소 (로컬 테스트 서버 사용 시 http://127.0.0.1:포트 형식으로 지정)
+    const char* spot_rest = getenv("BINANCE_SPOT_REST_URL");
+    const char* futures_rest = getenv("BINANCE_FUTURES_REST_URL");
+    if (spot_rest || futures_rest) {
+        binance.setRestEndpoints(spot_rest ? spot_rest : "https://api.binance.com",
+                                 futures_rest ? futures_rest : "https://fapi.binance.com");
+    }
+    
+    // 실시간 시세 스트림 주소 (로컬 테스트 서버 사용 시 ws://127.0.0.1:포트 형식으로 지정)
+    const char* spot_stream = getenv("BINANCE_SPOT_STREAM_URL");
+    const char* futures_stream = getenv("BINANCE_FUTURES_STREAM_URL");
+    if (spot_stream || futures_stream) {
+        binance.setStreamEndpoints(spot_stream ? spot_stream : "wss://stream.binance.com:9443",
+                                   futures_stream ? futures_stream : "wss://fstream.binance.com");
+    }
+}
+
+// SIGUSR1을 받으면 요청 지연 시간 통계를 stderr로 출력 (kill -USR1 <pid>)
+// 다른 스레드가 만들어지기 전에 시그널을 막아 두고 전용 스레드가 sigwait로 받으므로 핸들러 제약이 없다
+void installLatencyDumpSignal() {
+#ifndef _WIN32
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGUSR1);
+    if (pthread_sigmask(SIG_BLOCK, &signals, nullptr) != 0) {
+        return;
+    }
+    std::thread([signals]() {
+        int received = 0;
+        while (sigwait(&signals, &received) == 0) {
+            std::cerr << "\n=== 요청 지연 시간 (SIGUSR1) ===" << std::endl;
+            LatencyMonitor::instance().dump(std::cerr);
+        }
+    }).detach();
+#endif
+}
+
 int main() {
+    installLatencyDumpSignal();
+    
     std::cout << "=== 바이낸스 비트코인 최소수량 거래 프로그램 (보안 강화) ===" << std::endl;
     
     SecureStorage storage;
@@ -337,10 +423,14 @@ int main() {
     
     // BinanceAPI 객체 생성
     BinanceAPI binance(api_key, secret_key);
+    configureTransport(binance);
     
-    // API 권한 확인
+    // API 권한 확인과 최소 주문 수량 조회를 동시에 요청
     std::cout << "\nAPI 권한을 확인하는 중..." << std::endl;
-    if (!binance.checkApiPermissions()) {
+    std::future<bool> pendingPermissions = binance.checkApiPermissionsAsync();
+    std::future<Decimal> pendingMinQuantity = binance.getMinOrderQuantityAsync("BTCUSDT");
+    
+    if (!pendingPermissions.get()) {
         std::cout << "API 키 권한이 부족합니다. 다음을 확인하세요:" << std::endl;
         std::cout << "1. API 키가 올바른지 확인" << std::endl;
         std::cout << "2. Spot Trading 권한이 활성화되어 있는지 확인" << std::endl;
@@ -349,9 +439,11 @@ int main() {
     }
     
     // 최소 주문 수량 조회
-    double minQuantity = binance.getMinOrderQuantity("BTCUSDT");
-    std::cout << "\nBTCUSDT 최소 주문 수량: " << std::fixed << std::setprecision(8) 
-              << minQuantity << " BTC" << std::endl;
+    Decimal minQuantity = pendingMinQuantity.get();
+    std::cout << "\nBTCUSDT 최소 주문 수량: " << minQuantity << " BTC" << std::endl;
+    
+    // 계정/포지션 실시간 동기화 시작 (연결 전까지는 REST로 조회)
+    binance.startUserDataStream();
     
     while (true) {
         // 세션 유효성 검사
@@ -371,6 +463,8 @@ int main() {
             
             // API 객체 재생성
             binance = BinanceAPI(api_key, secret_key);
+            configureTransport(binance);
+            binance.startUserDataStream();
             std::cout << "세션이 갱신되었습니다." << std::endl;
         }
         
@@ -391,6 +485,11 @@ int main() {
         std::cout << "16. 포지션 종료" << std::endl;
         std::cout << "17. 선물거래 지정가 주문" << std::endl;
         std::cout << "18. 선물거래 가능한 심볼 목록 조회" << std::endl;
+        std::cout << "19. 실시간 시세 스트림 시작/중지" << std::endl;
+        std::cout << "20. 계정 실시간 동기화 시작/중지" << std::endl;
+        std::cout << "21. 요청 지연 시간 통계" << std::endl;
+        std::cout << "22. 선물 호가창 조회" << std::endl;
+        std::cout << "23. 전체 자산 시세 일괄 조회" << std::endl;
         std::cout << "\n=== 시스템 ===" << std::endl;
         std::cout << "7. 세션 상태 확인" << std::endl;
         std::cout << "8. 주문 권한 테스트" << std::endl;
@@ -431,42 +530,24 @@ int main() {
                 }
                 
                 // 최소 주문 금액 (NOTIONAL 필터) 고려
-                double minNotional = 5.0; // 바이낸스 최소 주문 금액 $5
-                double calculatedMinQuantity = minNotional / price.price;
+                Decimal minNotional = Decimal::fromInteger(5); // 바이낸스 최소 주문 금액 $5
+                Decimal currentPrice = Decimal::fromDouble(price.price);
+                Decimal calculatedMinQuantity = minNotional.divideCeil(currentPrice);
                 
                 // 심볼별 최소 수량 조회
-                double symbolMinQuantity = binance.getMinOrderQuantity(symbol);
+                Decimal symbolMinQuantity = binance.getMinOrderQuantity(symbol);
                 
                 // 기존 최소 수량과 비교하여 더 큰 값 사용
-                double actualMinQuantity = std::max(symbolMinQuantity, calculatedMinQuantity);
+                Decimal actualMinQuantity = std::max(symbolMinQuantity, calculatedMinQuantity);
                 
-                // LOT_SIZE 필터에 맞게 수량 조정
+                // LOT_SIZE 필터에 맞게 수량 조정 (stepSize 배수로 올림하므로 NOTIONAL 필터도 유지됨)
                 std::cout << "\nLOT_SIZE 필터 확인 중..." << std::endl;
                 actualMinQuantity = binance.adjustQuantityForLotSize(symbol, actualMinQuantity);
                 
-                // 조정된 수량이 NOTIONAL 필터를 만족하는지 재확인
-                double finalCost = actualMinQuantity * price.price;
-                if (finalCost < minNotional) {
-                    std::cout << "\n⚠️  LOT_SIZE 조정 후 NOTIONAL 필터 재확인 필요" << std::endl;
-                    std::cout << "현재 비용: $" << std::fixed << std::setprecision(2) << finalCost << std::endl;
-                    std::cout << "필요 비용: $" << std::fixed << std::setprecision(2) << minNotional << std::endl;
-                    
-                    // NOTIONAL을 만족하도록 수량 증가
-                    double requiredQuantity = minNotional / price.price;
-                    std::cout << "NOTIONAL을 위한 최소 수량: " << std::fixed << std::setprecision(8) << requiredQuantity << std::endl;
-                    
-                    // LOT_SIZE 필터에 맞게 다시 조정 (올림)
-                    actualMinQuantity = binance.adjustQuantityForLotSize(symbol, requiredQuantity + 0.00001);
-                    finalCost = actualMinQuantity * price.price;
-                    
-                    std::cout << "최종 조정된 수량: " << std::fixed << std::setprecision(8) << actualMinQuantity << std::endl;
-                    std::cout << "최종 비용: $" << std::fixed << std::setprecision(2) << finalCost << std::endl;
-                }
-                
                 std::cout << "\n=== " << getAssetName(symbol) << " 구매 정보 ===" << std::endl;
-                std::cout << "현재 " << getAssetName(symbol) << " 가격: $" << std::fixed << std::setprecision(6) << price.price << std::endl;
-                std::cout << "최소 주문 수량: " << std::fixed << std::setprecision(8) << actualMinQuantity << " " << assetSymbol << std::endl;
-                std::cout << "예상 비용: $" << std::fixed << std::setprecision(2) << (actualMinQuantity * price.price) << std::endl;
+                std::cout << "현재 " << getAssetName(symbol) << " 가격: $" << currentPrice << std::endl;
+                std::cout << "최소 주문 수량: " << actualMinQuantity << " " << assetSymbol << std::endl;
+                std::cout << "예상 비용: $" << std::fixed << std::setprecision(2) << (actualMinQuantity * currentPrice).toDouble() << std::endl;
                 
                 // 계정 정보 조회
                 AccountInfo account = binance.getAccountInfo();
@@ -474,7 +555,7 @@ int main() {
                     std::cout << "현재 USDT 잔고: $" << std::fixed << std::setprecision(2) << account.usdtBalance << std::endl;
                     
                     // 잔고 확인
-                    double requiredUsdt = actualMinQuantity * price.price;
+                    double requiredUsdt = (actualMinQuantity * currentPrice).toDouble();
                     if (account.usdtBalance < requiredUsdt) {
                         std::cout << "❌ 잔고 부족: $" << std::fixed << std::setprecision(2) << (requiredUsdt - account.usdtBalance) << " USDT 부족" << std::endl;
                         break;
@@ -486,29 +567,29 @@ int main() {
                 std::getline(std::cin, confirm);
                 
                 if (confirm == "y" || confirm == "Y") {
-                    // 먼저 테스트 주문으로 권한 확인
-                    std::cout << "주문 권한을 테스트하는 중..." << std::endl;
-                    OrderResponse testOrder = binance.testOrder("BUY", actualMinQuantity);
+                    // 테스트 주문은 왕복이 한 번 더 들기 때문에 원할 때만 실행
+                    std::cout << "실제 주문 전에 테스트 주문으로 권한을 확인하시겠습니까? (y/N): ";
+                    std::string testConfirm;
+                    std::getline(std::cin, testConfirm);
                     
-                    if (!testOrder.success) {
-                        std::cout << "❌ 테스트 주문 실패: " << testOrder.error << std::endl;
-                        std::cout << "\n가능한 해결 방법:" << std::endl;
-                        std::cout << "1. 바이낸스 API 키 설정에서 'Spot Trading' 권한 활성화" << std::endl;
-                        std::cout << "2. 'Enable Trading' 옵션 체크" << std::endl;
-                        std::cout << "3. IP 제한 설정 확인 (현재 IP 주소 허용)" << std::endl;
-                        std::cout << "4. API 키가 올바른지 확인" << std::endl;
-                        break;
+                    if (testConfirm == "y" || testConfirm == "Y") {
+                        std::cout << "주문 권한을 테스트하는 중..." << std::endl;
+                        OrderResponse testOrder = binance.testSpotOrder(symbol, "BUY", "MARKET", actualMinQuantity);
+                        
+                        if (!testOrder.success) {
+                            std::cout << "❌ 테스트 주문 실패: " << testOrder.error << std::endl;
+                            std::cout << "\n가능한 해결 방법:" << std::endl;
+                            std::cout << "1. 바이낸스 API 키 설정에서 'Spot Trading' 권한 활성화" << std::endl;
+                            std::cout << "2. 'Enable Trading' 옵션 체크" << std::endl;
+                            std::cout << "3. IP 제한 설정 확인 (현재 IP 주소 허용)" << std::endl;
+                            std::cout << "4. API 키가 올바른지 확인" << std::endl;
+                            break;
+                        }
+                        std::cout << "✅ 테스트 주문 성공! 실제 주문을 실행합니다..." << std::endl;
                     }
                     
-                    std::cout << "✅ 테스트 주문 성공! 실제 주문을 실행합니다..." << std::endl;
-                    // 현재 buyBitcoin은 BTCUSDT만 지원하므로 일반화된 구매 함수가 필요
-                    // 임시로 BTC만 지원하고 나중에 개선
-                    if (symbol == "BTCUSDT") {
-                        OrderResponse order = binance.buyBitcoin(actualMinQuantity);
-                        printOrderResult(order);
-                    } else {
-                        std::cout << "⚠️  현재 " << getAssetName(symbol) << " 현물거래는 개발 중입니다. BTC만 지원됩니다." << std::endl;
-                    }
+                    OrderResponse order = binance.placeSpotOrder(symbol, "BUY", "MARKET", actualMinQuantity);
+                    printOrderResult(order);
                 } else {
                     std::cout << "구매가 취소되었습니다." << std::endl;
                 }
@@ -519,22 +600,15 @@ int main() {
                 std::string symbol = selectAsset();
                 std::string assetSymbol = symbol.substr(0, symbol.find("USDT"));
                 
-                // 현재는 BTC만 지원하므로 BTC 외의 자산은 제한
-                if (symbol != "BTCUSDT") {
-                    std::cout << "⚠️  현재 " << getAssetName(symbol) << " 현물거래는 개발 중입니다. BTC만 지원됩니다." << std::endl;
-                    break;
-                }
-                
-                double symbolMinQuantity = binance.getMinOrderQuantity(symbol);
-                std::cout << "\n최소수량(" << std::fixed << std::setprecision(8) 
-                          << symbolMinQuantity << " " << assetSymbol << ")으로 " << getAssetName(symbol) << "을(를) 판매합니다..." << std::endl;
+                Decimal symbolMinQuantity = binance.getMinOrderQuantity(symbol);
+                std::cout << "\n최소수량(" << symbolMinQuantity << " " << assetSymbol << ")으로 " << getAssetName(symbol) << "을(를) 판매합니다..." << std::endl;
                 
                 std::cout << "정말 판매하시겠습니까? (y/N): ";
                 std::string confirm;
                 std::getline(std::cin, confirm);
                 
                 if (confirm == "y" || confirm == "Y") {
-                    OrderResponse order = binance.sellBitcoin(symbolMinQuantity);
+                    OrderResponse order = binance.placeSpotOrder(symbol, "SELL", "MARKET", symbolMinQuantity);
                     printOrderResult(order);
                 } else {
                     std::cout << "판매가 취소되었습니다." << std::endl;
@@ -546,19 +620,15 @@ int main() {
                 std::string symbol = selectAsset();
                 std::string assetSymbol = symbol.substr(0, symbol.find("USDT"));
                 
-                // 현재는 BTC만 지원하므로 BTC 외의 자산은 제한
-                if (symbol != "BTCUSDT") {
-                    std::cout << "⚠️  현재 " << getAssetName(symbol) << " 현물거래는 개발 중입니다. BTC만 지원됩니다." << std::endl;
+                Decimal symbolMinQuantity = binance.getMinOrderQuantity(symbol);
+                std::cout << "\n구매할 " << getAssetName(symbol) << " 수량을 입력하세요 (최소: " 
+                          << symbolMinQuantity << " " << assetSymbol << "): ";
+                Decimal quantity;
+                if (!readDecimal(quantity)) {
+                    std::cout << "올바른 수량을 입력하세요." << std::endl;
                     break;
                 }
                 
-                double symbolMinQuantity = binance.getMinOrderQuantity(symbol);
-                std::cout << "\n구매할 " << getAssetName(symbol) << " 수량을 입력하세요 (최소: " 
-                          << std::fixed << std::setprecision(8) << symbolMinQuantity << " " << assetSymbol << "): ";
-                double quantity;
-                std::cin >> quantity;
-                std::cin.ignore();
-                
                 if (quantity < symbolMinQuantity) {
                     std::cout << "최소 주문 수량보다 작습니다." << std::endl;
                     break;
@@ -569,7 +639,7 @@ int main() {
                 std::getline(std::cin, confirm);
                 
                 if (confirm == "y" || confirm == "Y") {
-                    OrderResponse order = binance.buyBitcoin(quantity);
+                    OrderResponse order = binance.placeSpotOrder(symbol, "BUY", "MARKET", quantity);
                     printOrderResult(order);
                 } else {
                     std::cout << "구매가 취소되었습니다." << std::endl;
@@ -581,19 +651,15 @@ int main() {
                 std::string symbol = selectAsset();
                 std::string assetSymbol = symbol.substr(0, symbol.find("USDT"));
                 
-                // 현재는 BTC만 지원하므로 BTC 외의 자산은 제한
-                if (symbol != "BTCUSDT") {
-                    std::cout << "⚠️  현재 " << getAssetName(symbol) << " 현물거래는 개발 중입니다. BTC만 지원됩니다." << std::endl;
+                Decimal symbolMinQuantity = binance.getMinOrderQuantity(symbol);
+                std::cout << "\n판매할 " << getAssetName(symbol) << " 수량을 입력하세요 (최소: " 
+                          << symbolMinQuantity << " " << assetSymbol << "): ";
+                Decimal quantity;
+                if (!readDecimal(quantity)) {
+                    std::cout << "올바른 수량을 입력하세요." << std::endl;
                     break;
                 }
                 
-                double symbolMinQuantity = binance.getMinOrderQuantity(symbol);
-                std::cout << "\n판매할 " << getAssetName(symbol) << " 수량을 입력하세요 (최소: " 
-                          << std::fixed << std::setprecision(8) << symbolMinQuantity << " " << assetSymbol << "): ";
-                double quantity;
-                std::cin >> quantity;
-                std::cin.ignore();
-                
                 if (quantity < symbolMinQuantity) {
                     std::cout << "최소 주문 수량보다 작습니다." << std::endl;
                     break;
@@ -604,7 +670,7 @@ int main() {
                 std::getline(std::cin, confirm);
                 
                 if (confirm == "y" || confirm == "Y") {
-                    OrderResponse order = binance.sellBitcoin(quantity);
+                    OrderResponse order = binance.placeSpotOrder(symbol, "SELL", "MARKET", quantity);
                     printOrderResult(order);
                 } else {
                     std::cout << "판매가 취소되었습니다." << std::endl;
@@ -623,6 +689,40 @@ int main() {
                 } else {
                     std::cout << "세션 상태: 만료됨" << std::endl;
                 }
+                
+                ConnectionPoolStats stats = binance.getConnectionStats();
+                std::cout << "\n=== 연결 상태 ===" << std::endl;
+                std::cout << "전체 요청: " << stats.requests << "회" << std::endl;
+                std::cout << "새 연결 (핸드셰이크): " << stats.handshakes << "회" << std::endl;
+                std::cout << "연결 재사용: " << stats.reusedConnections << "회" << std::endl;
+                std::cout << "HTTP/2 응답: " << stats.http2Responses << "회"
+                          << (binance.isHttp2Enabled() ? " (HTTP/2 모드)" : " (HTTP/1.1 모드)") << std::endl;
+                std::cout << "대기 중인 핸들: " << stats.idleHandles << "개" << std::endl;
+                
+                std::cout << "\n=== 요청 한도 상태 ===" << std::endl;
+                RateLimitStats spotLimits = binance.getSpotRateLimitStats();
+                RateLimitStats futuresLimits = binance.getFuturesRateLimitStats();
+                std::cout << "현물 남은 가중치: " << spotLimits.remainingWeight << "/" << spotLimits.weightLimit
+                          << " (대기열 " << spotLimits.queueDepth << "건, 누적 대기 "
+                          << std::fixed << std::setprecision(1) << spotLimits.totalWaitMs << "ms)" << std::endl;
+                std::cout << "선물 남은 가중치: " << futuresLimits.remainingWeight << "/" << futuresLimits.weightLimit
+                          << " (대기열 " << futuresLimits.queueDepth << "건, 누적 대기 "
+                          << std::fixed << std::setprecision(1) << futuresLimits.totalWaitMs << "ms)" << std::endl;
+                if (spotLimits.throttledResponses + futuresLimits.throttledResponses > 0) {
+                    std::cout << "⚠️  429/418 응답: " << (spotLimits.throttledResponses + futuresLimits.throttledResponses)
+                              << "회" << std::endl;
+                }
+                
+                std::cout << "\n=== 실시간 동기화 상태 ===" << std::endl;
+                std::cout << "현물 계정 스트림: " << (binance.isUserDataStreamLive(MarketType::Spot) ? "연결됨" : "미연결 (REST 조회)") << std::endl;
+                std::cout << "선물 계정 스트림: " << (binance.isUserDataStreamLive(MarketType::Futures) ? "연결됨" : "미연결 (REST 조회)") << std::endl;
+                std::cout << "시세 스트림: " << (binance.isMarketDataStreamLive() ? "연결됨" : "미연결 (REST 조회)") << std::endl;
+                std::cout << "주문 전송 방식: " << (binance.isOrderSessionEnabled() ? "WebSocket API 세션" : "REST") << std::endl;
+                if (binance.isOrderSessionEnabled()) {
+                    std::cout << "평균 주문 왕복 시간: 현물 " << std::fixed << std::setprecision(1)
+                              << binance.getOrderSessionLatencyMs(MarketType::Spot) << "ms, 선물 "
+                              << binance.getOrderSessionLatencyMs(MarketType::Futures) << "ms" << std::endl;
+                }
                 break;
             }
             
@@ -747,6 +847,18 @@ int main() {
                 std::cout << "\n선물거래 계정 정보를 조회중..." << std::endl;
                 FuturesAccountInfo info = binance.getFuturesAccountInfo();
                 printFuturesAccountInfo(info);
+                
+                // 계정 스트림이 연결되어 있으면 포지션 저장소의 합계 (REST 요청 없음)
+                PositionTotals totals;
+                if (binance.getPositionTotals(totals) && totals.positions > 0) {
+                    std::cout << "\n=== 포지션 합계 (" << totals.positions << "개, 마크 가격 틱 "
+                              << totals.markUpdates << "회) ===" << std::endl;
+                    std::cout << std::fixed << std::setprecision(2);
+                    std::cout << "미실현 손익: " << totals.unrealizedPnl << " USDT" << std::endl;
+                    std::cout << "포지션 금액: $" << totals.notional << std::endl;
+                    std::cout << "증거금: $" << totals.initialMargin << " (ROE " << totals.roe << "%)" << std::endl;
+                    std::cout << "가장 가까운 청산 거리: " << totals.minLiquidationDistance << "%" << std::endl;
+                }
                 break;
             }
             
@@ -803,15 +915,14 @@ int main() {
                     std::cout << "⚠️  레버리지 설정에 실패했지만 계속 진행합니다." << std::endl;
                 }
                 
-                // 현재 가격 조회
-                MarketPrice price = binance.getCurrentPrice(symbol);
+                // 선물 가격 요청을 먼저 보내 두고 계정 정보 조회와 동시에 진행
+                std::future<MarketPrice> pendingPrice = binance.getFuturesPriceAsync(symbol);
+                FuturesAccountInfo account = binance.getFuturesAccountInfo();
+                MarketPrice price = pendingPrice.get();
                 if (!price.success) {
                     std::cout << "가격 조회 실패: " << price.error << std::endl;
                     break;
                 }
-                
-                // 계정 정보 조회
-                FuturesAccountInfo account = binance.getFuturesAccountInfo();
                 if (!account.success) {
                     std::cout << "계정 정보 조회 실패: " << account.error << std::endl;
                     break;
@@ -823,16 +934,24 @@ int main() {
                 std::cout << "레버리지: 1x (안전 모드)" << std::endl;
                 
                 std::cout << "주문 수량을 입력하세요 (" << assetSymbol << "): ";
-                double quantity;
-                std::cin >> quantity;
-                std::cin.ignore();
-                
-                if (quantity <= 0) {
+                Decimal quantity;
+                if (!readDecimal(quantity) || !quantity.isPositive()) {
                     std::cout << "올바른 수량을 입력하세요." << std::endl;
                     break;
                 }
                 
-                double cost = quantity * price.price;
+                // 필터 검증과 수량 조정 여부를 주문 전에 확정 (주문 경로에서는 입력을 기다리지 않음)
+                BinanceAPI::FuturesOrderValidation validation = binance.validateFuturesOrderQuantity(symbol, quantity);
+                if (!validation.error.empty()) {
+                    std::cout << "❌ " << validation.error << std::endl;
+                    break;
+                }
+                if (!validation.warning.empty()) {
+                    std::cout << "\n" << validation.warning << std::endl;
+                }
+                quantity = validation.adjustedQuantity;
+                
+                double cost = quantity.toDouble() * validation.currentPrice.toDouble();
                 std::cout << "예상 비용: $" << std::fixed << std::setprecision(2) << cost << std::endl;
                 
                 std::cout << quantity << " " << assetSymbol << " 롱 포지션을 진입하시겠습니까? (레버리지 1x) (y/N): ";
@@ -840,7 +959,8 @@ int main() {
                 std::getline(std::cin, confirm);
                 
                 if (confirm == "y" || confirm == "Y") {
-                    FuturesOrderResponse order = binance.openLongPosition(symbol, quantity);
+                    // 확인한 수량과 다르게 주문되지 않도록 가격 변동으로 미달하면 주문하지 않음
+                    FuturesOrderResponse order = binance.openLongPosition(symbol, quantity, QuantityAdjustPolicy::Reject);
                     printFuturesOrderResult(order);
                 } else {
                     std::cout << "롱 포지션 진입이 취소되었습니다." << std::endl;
@@ -858,15 +978,14 @@ int main() {
                     std::cout << "⚠️  레버리지 설정에 실패했지만 계속 진행합니다." << std::endl;
                 }
                 
-                // 현재 가격 조회
-                MarketPrice price = binance.getCurrentPrice(symbol);
+                // 선물 가격 요청을 먼저 보내 두고 계정 정보 조회와 동시에 진행
+                std::future<MarketPrice> pendingPrice = binance.getFuturesPriceAsync(symbol);
+                FuturesAccountInfo account = binance.getFuturesAccountInfo();
+                MarketPrice price = pendingPrice.get();
                 if (!price.success) {
                     std::cout << "가격 조회 실패: " << price.error << std::endl;
                     break;
                 }
-                
-                // 계정 정보 조회
-                FuturesAccountInfo account = binance.getFuturesAccountInfo();
                 if (!account.success) {
                     std::cout << "계정 정보 조회 실패: " << account.error << std::endl;
                     break;
@@ -878,16 +997,24 @@ int main() {
                 std::cout << "레버리지: 1x (안전 모드)" << std::endl;
                 
                 std::cout << "주문 수량을 입력하세요 (" << assetSymbol << "): ";
-                double quantity;
-                std::cin >> quantity;
-                std::cin.ignore();
-                
-                if (quantity <= 0) {
+                Decimal quantity;
+                if (!readDecimal(quantity) || !quantity.isPositive()) {
                     std::cout << "올바른 수량을 입력하세요." << std::endl;
                     break;
                 }
                 
-                double cost = quantity * price.price;
+                // 필터 검증과 수량 조정 여부를 주문 전에 확정 (주문 경로에서는 입력을 기다리지 않음)
+                BinanceAPI::FuturesOrderValidation validation = binance.validateFuturesOrderQuantity(symbol, quantity);
+                if (!validation.error.empty()) {
+                    std::cout << "❌ " << validation.error << std::endl;
+                    break;
+                }
+                if (!validation.warning.empty()) {
+                    std::cout << "\n" << validation.warning << std::endl;
+                }
+                quantity = validation.adjustedQuantity;
+                
+                double cost = quantity.toDouble() * validation.currentPrice.toDouble();
                 std::cout << "예상 비용: $" << std::fixed << std::setprecision(2) << cost << std::endl;
                 
                 std::cout << quantity << " " << assetSymbol << " 숏 포지션을 진입하시겠습니까? (레버리지 1x) (y/N): ";
@@ -895,7 +1022,8 @@ int main() {
                 std::getline(std::cin, confirm);
                 
                 if (confirm == "y" || confirm == "Y") {
-                    FuturesOrderResponse order = binance.openShortPosition(symbol, quantity);
+                    // 확인한 수량과 다르게 주문되지 않도록 가격 변동으로 미달하면 주문하지 않음
+                    FuturesOrderResponse order = binance.openShortPosition(symbol, quantity, QuantityAdjustPolicy::Reject);
                     printFuturesOrderResult(order);
                 } else {
                     std::cout << "숏 포지션 진입이 취소되었습니다." << std::endl;
@@ -962,21 +1090,46 @@ int main() {
                 std::string directionStr = (direction == 1) ? "롱(매수)" : "숏(매도)";
                 
                 std::cout << "주문 수량을 입력하세요 (" << assetSymbol << "): ";
-                double quantity;
-                std::cin >> quantity;
-                std::cin.ignore();
-                
-                if (quantity <= 0) {
+                Decimal quantity;
+                if (!readDecimal(quantity) || !quantity.isPositive()) {
                     std::cout << "올바른 수량을 입력하세요." << std::endl;
                     break;
                 }
                 
-                std::cout << "지정가를 입력하세요 ($): ";
-                double orderPrice;
-                std::cin >> orderPrice;
-                std::cin.ignore();
+                // 필터 검증과 수량 조정 여부를 주문 전에 확정 (주문 경로에서는 입력을 기다리지 않음)
+                BinanceAPI::FuturesOrderValidation validation = binance.validateFuturesOrderQuantity(symbol, quantity);
+                if (!validation.error.empty()) {
+                    std::cout << "❌ " << validation.error << std::endl;
+                    break;
+                }
+                if (!validation.warning.empty()) {
+                    std::cout << "\n" << validation.warning << std::endl;
+                    
+                    if (!validation.isValid) {
+                        std::cout << "\n❌ 주문을 실행할 수 없습니다. 수량을 " << validation.adjustedQuantity << "로 조정하시겠습니까? (y/N): ";
+                        std::string adjust;
+                        std::getline(std::cin, adjust);
+                        if (adjust != "y" && adjust != "Y") {
+                            std::cout << "지정가 주문이 취소되었습니다." << std::endl;
+                            break;
+                        }
+                    } else {
+                        std::cout << "\n🔧 수량이 자동으로 조정되었습니다: " << validation.adjustedQuantity << std::endl;
+                    }
+                }
+                quantity = validation.adjustedQuantity;
+                
+                // 로컬 호가창이 동기화되어 있으면 최우선 호가를 참고 가격으로 표시 (메뉴 22)
+                std::shared_ptr<const OrderBook> book = binance.getOrderBook(MarketType::Futures, symbol);
+                if (book && book->isSynced()) {
+                    BookTop top = book->top();
+                    std::cout << "현재 호가: 매수 $" << top.bid.price << " (" << top.bid.quantity << ") / 매도 $"
+                              << top.ask.price << " (" << top.ask.quantity << ")" << std::endl;
+                }
                 
-                if (orderPrice <= 0) {
+                std::cout << "지정가를 입력하세요 ($): ";
+                Decimal orderPrice;
+                if (!readDecimal(orderPrice) || !orderPrice.isPositive()) {
                     std::cout << "올바른 가격을 입력하세요." << std::endl;
                     break;
                 }
@@ -984,16 +1137,18 @@ int main() {
                 std::cout << "\n=== 주문 정보 ===" << std::endl;
                 std::cout << "자산: " << getAssetName(symbol) << std::endl;
                 std::cout << "방향: " << directionStr << std::endl;
-                std::cout << "수량: " << std::fixed << std::setprecision(6) << quantity << " " << assetSymbol << std::endl;
-                std::cout << "지정가: $" << std::fixed << std::setprecision(6) << orderPrice << std::endl;
-                std::cout << "총 금액: $" << std::fixed << std::setprecision(2) << (quantity * orderPrice) << std::endl;
+                std::cout << "수량: " << quantity << " " << assetSymbol << std::endl;
+                std::cout << "지정가: $" << orderPrice << std::endl;
+                std::cout << "총 금액: $" << std::fixed << std::setprecision(2) << (quantity * orderPrice).toDouble() << std::endl;
                 
                 std::cout << "\n지정가 주문을 실행하시겠습니까? (y/N): ";
                 std::string confirm;
                 std::getline(std::cin, confirm);
                 
                 if (confirm == "y" || confirm == "Y") {
-                    FuturesOrderResponse order = binance.futuresLimitOrder(symbol, side, quantity, orderPrice);
+                    // 확인한 수량과 다르게 주문되지 않도록 가격 변동으로 미달하면 주문하지 않음
+                    FuturesOrderResponse order = binance.futuresLimitOrder(symbol, side, quantity, orderPrice, "BOTH",
+                                                                           QuantityAdjustPolicy::Reject);
                     printFuturesOrderResult(order);
                 } else {
                     std::cout << "지정가 주문이 취소되었습니다." << std::endl;
@@ -1008,6 +1163,167 @@ int main() {
                 break;
             }
             
+            case 19: {
+                if (binance.isMarketDataStreamLive()) {
+                    binance.stopMarketDataStream();
+                    std::cout << "\n실시간 시세 스트림을 중지했습니다. 가격은 REST API로 조회합니다." << std::endl;
+                    break;
+                }
+                
+                std::cout << "\n실시간 시세 스트림에 연결중..." << std::endl;
+                binance.startMarketDataStream(supportedAssets());
+                
+                // 첫 시세가 들어올 때까지 잠시 대기
+                for (int i = 0; i < 30 && !binance.getStreamPrice("BTCUSDT").valid; i++) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                }
+                
+                if (!binance.isMarketDataStreamLive()) {
+                    std::cout << "⚠️  스트림 연결 대기 중입니다. 연결되면 자동으로 실시간 시세를 사용합니다." << std::endl;
+                    break;
+                }
+                
+                std::cout << "✅ 실시간 시세 스트림 연결됨" << std::endl;
+                std::cout << std::left << std::setw(12) << "심볼" << std::right
+                          << std::setw(16) << "현물 체결가" << std::setw(16) << "선물 마크가격" << std::endl;
+                for (const auto& symbol : supportedAssets()) {
+                    PriceSnapshot spot = binance.getStreamPrice(symbol, MarketType::Spot);
+                    PriceSnapshot futures = binance.getStreamPrice(symbol, MarketType::Futures);
+                    std::cout << std::left << std::setw(12) << symbol << std::right << std::fixed << std::setprecision(4)
+                              << std::setw(16) << spot.lastPrice << std::setw(16) << futures.markPrice << std::endl;
+                }
+                break;
+            }
+            
+            case 20: {
+                if (binance.isUserDataStreamLive(MarketType::Spot) || binance.isUserDataStreamLive(MarketType::Futures)) {
+                    binance.stopUserDataStream();
+                    std::cout << "\n계정 실시간 동기화를 중지했습니다. 계정/포지션은 REST API로 조회합니다." << std::endl;
+                    break;
+                }
+                
+                std::cout << "\n계정 실시간 동기화를 시작합니다..." << std::endl;
+                binance.startUserDataStream();
+                for (int i = 0; i < 50 && !binance.isUserDataStreamLive(MarketType::Futures); i++) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                }
+                std::cout << "현물 계정: " << (binance.isUserDataStreamLive(MarketType::Spot) ? "✅ 연결됨" : "⏳ 연결 대기 중") << std::endl;
+                std::cout << "선물 계정: " << (binance.isUserDataStreamLive(MarketType::Futures) ? "✅ 연결됨" : "⏳ 연결 대기 중") << std::endl;
+                break;
+            }
+            
+            case 21: {
+                std::cout << "\n=== 요청 지연 시간 (엔드포인트별) ===" << std::endl;
+                std::cout << "dns/connect/tls는 새 연결에서만 기록됩니다. server는 요청 전송 후 첫 응답 바이트까지입니다." << std::endl;
+                LatencyMonitor::instance().dump(std::cout);
+                
+                std::cout << "\n통계를 초기화하시겠습니까? (y/N): ";
+                std::string confirm;
+                std::getline(std::cin, confirm);
+                if (confirm == "y" || confirm == "Y") {
+                    LatencyMonitor::instance().reset();
+                    std::cout << "초기화했습니다." << std::endl;
+                }
+                break;
+            }
+            
+            case 22: {
+                std::string symbol = selectAsset();
+                
+                std::shared_ptr<const OrderBook> book = binance.getOrderBook(MarketType::Futures, symbol);
+                if (!book) {
+                    std::vector<std::string> symbols = supportedAssets();
+                    if (std::find(symbols.begin(), symbols.end(), symbol) == symbols.end()) {
+                        symbols.push_back(symbol);
+                    }
+                    std::cout << "\n선물 호가 스트림에 연결중..." << std::endl;
+                    binance.startOrderBookStream(MarketType::Futures, symbols);
+                    book = binance.getOrderBook(MarketType::Futures, symbol);
+                }
+                
+                // 스냅샷과 차분 이벤트가 맞춰질 때까지 잠시 대기
+                for (int i = 0; i < 50 && book && !book->isSynced(); i++) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                }
+                if (!book || !book->isSynced()) {
+                    std::cout << "⚠️  호가창 동기화 대기 중입니다. 잠시 후 다시 조회하세요." << std::endl;
+                    break;
+                }
+                
+                const size_t LEVELS = 10;
+                std::vector<PriceLevel> asks = book->depth(BookSide::Ask, LEVELS);
+                std::vector<PriceLevel> bids = book->depth(BookSide::Bid, LEVELS);
+                
+                std::cout << "\n=== " << getAssetName(symbol) << " 선물 호가창 ===" << std::endl;
+                std::cout << std::left << std::setw(8) << "구분" << std::right << std::setw(18) << "가격"
+                          << std::setw(18) << "잔량" << std::endl;
+                for (auto it = asks.rbegin(); it != asks.rend(); ++it) {
+                    std::cout << std::left << std::setw(8) << "매도" << std::right << std::setw(18) << it->price.toString()
+                              << std::setw(18) << it->quantity.toString() << std::endl;
+                }
+                std::cout << "----------------------------------------------" << std::endl;
+                for (const auto& level : bids) {
+                    std::cout << std::left << std::setw(8) << "매수" << std::right << std::setw(18) << level.price.toString()
+                              << std::setw(18) << level.quantity.toString() << std::endl;
+                }
+                
+                BookTop top = book->top();
+                if (top.bid.price.isPositive() && top.ask.price.isPositive()) {
+                    std::cout << "\n스프레드: $" << (top.ask.price - top.bid.price) << std::endl;
+                }
+                std::cout << "매수 " << LEVELS << "단계 잔량 합: " << book->cumulativeQuantity(BookSide::Bid, LEVELS)
+                          << ", 매도 " << LEVELS << "단계 잔량 합: " << book->cumulativeQuantity(BookSide::Ask, LEVELS) << std::endl;
+                std::cout << "호가 단계 수: 매수 " << book->levelCount(BookSide::Bid) << ", 매도 "
+                          << book->levelCount(BookSide::Ask) << " (update id " << top.updateId << ")" << std::endl;
+                break;
+            }
+            
+            case 23: {
+                std::cout << "\n현물/선물 시세를 조회중..." << std::endl;
+                
+                // 시장별 요청 한 번으로 모든 자산 시세를 받아 심볼 ID로 찾음
+                std::future<MarketPriceTable> pendingFutures = std::async(std::launch::async, [api = binance]() mutable {
+                    return api.getPrices(supportedAssets(), MarketType::Futures);
+                });
+                MarketPriceTable spot = binance.getPrices(supportedAssets(), MarketType::Spot);
+                MarketPriceTable futures = pendingFutures.get();
+                
+                if (!spot.success) {
+                    std::cout << "현물 시세 조회 실패: " << spot.error << std::endl;
+                }
+                if (!futures.success) {
+                    std::cout << "선물 시세 조회 실패: " << futures.error << std::endl;
+                }
+                if (!spot.success && !futures.success) {
+                    break;
+                }
+                
+                std::cout << "\n=== 전체 자산 시세 ===" << std::endl;
+                std::cout << std::left << std::setw(20) << "자산" << std::right << std::setw(18) << "현물"
+                          << std::setw(18) << "선물" << std::setw(12) << "괴리(%)" << std::endl;
+                for (const auto& symbol : supportedAssets()) {
+                    double spotPrice = spot.price(symbol);
+                    double futuresPrice = futures.price(symbol);
+                    
+                    std::cout << std::left << std::setw(20) << getAssetName(symbol) << std::right << std::fixed;
+                    if (spotPrice > 0) {
+                        std::cout << std::setw(18) << std::setprecision(6) << spotPrice;
+                    } else {
+                        std::cout << std::setw(18) << "-";
+                    }
+                    if (futuresPrice > 0) {
+                        std::cout << std::setw(18) << std::setprecision(6) << futuresPrice;
+                    } else {
+                        std::cout << std::setw(18) << "-";
+                    }
+                    if (spotPrice > 0 && futuresPrice > 0) {
+                        std::cout << std::setw(12) << std::setprecision(3) << (futuresPrice - spotPrice) / spotPrice * 100.0;
+                    }
+                    std::cout << std::endl;
+                }
+                break;
+            }
+            
             case 0:
                 std::cout << "프로그램을 종료합니다." << std::endl;
                 storage.clearSession();
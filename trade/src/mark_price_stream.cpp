@@ -0,0 +1,101 @@
+#include "mark_price_stream.h"
+#include <algorithm>
+#include <chrono>
+
+MarkPriceStream::MarkPriceStream(const std::string& ws_base_url, std::shared_ptr<PositionStore> store)
+    : store_(std::move(store)), running_(false), live_(false), messages_(0) {
+    url_ = ws_base_url;
+    if (!url_.empty() && url_.back() == '/') {
+        url_.pop_back();
+    }
+    url_ += "/ws/!markPrice@arr@1s";
+}
+
+MarkPriceStream::~MarkPriceStream() {
+    stop();
+}
+
+void MarkPriceStream::start() {
+    if (running_.exchange(true)) return;
+    worker_ = std::thread(&MarkPriceStream::run, this);
+}
+
+void MarkPriceStream::stop() {
+    running_ = false;
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    live_ = false;
+}
+
+bool MarkPriceStream::isLive() const {
+    return live_;
+}
+
+void MarkPriceStream::setError(const std::string& error) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    error_ = error;
+}
+
+std::string MarkPriceStream::lastError() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return error_;
+}
+
+void MarkPriceStream::waitBackoff(int& backoff_ms) {
+    // stop 요청에 빠르게 반응하도록 잘게 나누어 대기
+    for (int waited = 0; waited < backoff_ms && running_; waited += 100) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    backoff_ms = std::min(backoff_ms * 2, 30000);
+}
+
+void MarkPriceStream::run() {
+    int backoff_ms = 500;
+
+    while (running_) {
+        if (!client_.connect(url_, 10000)) {
+            setError("마크 가격 스트림 연결 실패: " + client_.lastError());
+            waitBackoff(backoff_ms);
+            continue;
+        }
+        backoff_ms = 500;
+        live_ = true;
+
+        std::string message;
+        while (running_) {
+            WebSocketClient::ReadResult result = client_.readMessage(message, 200);
+            if (result == WebSocketClient::ReadResult::Closed) {
+                setError("마크 가격 스트림 연결 끊김: " + client_.lastError());
+                break;
+            }
+            if (result == WebSocketClient::ReadResult::Message) {
+                handleMessage(message);
+            }
+        }
+
+        live_ = false;
+        client_.close();
+    }
+}
+
+void MarkPriceStream::handleMessage(const std::string& message) {
+    // [{"e":"markPriceUpdate","E":..,"s":"BTCUSDT","p":"11794.15",...},...]
+    if (!doc_.parse(message)) return;
+    JSONValue root = doc_.root();
+    if (!root.isArray()) return;
+
+    symbols_.clear();
+    marks_.clear();
+    const SymbolTable& table = SymbolTable::instance();
+    for (JSONValue update : root) {
+        // 처음 보는 심볼은 포지션도 없으므로 등록하지 않음
+        SymbolId symbol = table.find(update["s"].raw());
+        if (symbol == INVALID_SYMBOL_ID) continue;
+        symbols_.push_back(symbol);
+        marks_.push_back(update["p"].asDouble());
+    }
+
+    store_->applyMarks(symbols_.data(), marks_.data(), symbols_.size());
+    messages_++;
+}
@@ -0,0 +1,235 @@
+#include "market_data_stream.h"
+#include "json_parser.h"
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <cstring>
+
+static long long nowMs() {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+}
+
+static std::string toLower(const std::string& value) {
+    std::string lower = value;
+    for (char& c : lower) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return lower;
+}
+
+static std::string toUpper(const std::string& value) {
+    std::string upper = value;
+    for (char& c : upper) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return upper;
+}
+
+// === PriceTable ===
+
+PriceTable::PriceTable(const std::vector<std::string>& symbols)
+    : slots_(new Slot[CAPACITY]) {
+    for (const auto& raw : symbols) {
+        std::string symbol = toUpper(raw);
+        if (symbol.empty() || symbol.length() >= sizeof(Slot::symbol)) continue;
+        if (find(symbol) || symbols_.size() >= CAPACITY / 2) continue;
+
+        // 선형 탐사 오픈 어드레싱 (삽입은 스트림 시작 전에만 수행)
+        size_t index = hashOf(symbol) & (CAPACITY - 1);
+        while (slots_[index].symbol[0] != '\0') {
+            index = (index + 1) & (CAPACITY - 1);
+        }
+        std::memcpy(slots_[index].symbol, symbol.c_str(), symbol.length() + 1);
+        symbols_.push_back(symbol);
+    }
+}
+
+size_t PriceTable::hashOf(const std::string& symbol) {
+    // FNV-1a
+    size_t hash = 14695981039346656037ULL;
+    for (char c : symbol) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+const PriceTable::Slot* PriceTable::find(const std::string& symbol) const {
+    size_t index = hashOf(symbol) & (CAPACITY - 1);
+    for (size_t probe = 0; probe < CAPACITY; probe++) {
+        const Slot& slot = slots_[index];
+        if (slot.symbol[0] == '\0') return nullptr;
+        if (symbol == slot.symbol) return &slot;
+        index = (index + 1) & (CAPACITY - 1);
+    }
+    return nullptr;
+}
+
+void PriceTable::update(const std::string& symbol, double bid, double ask, double last, double mark) {
+    Slot* slot = const_cast<Slot*>(find(symbol));
+    if (!slot) return;
+
+    uint64_t sequence = slot->sequence.load(std::memory_order_relaxed);
+    slot->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (bid > 0) slot->bid.store(bid, std::memory_order_relaxed);
+    if (ask > 0) slot->ask.store(ask, std::memory_order_relaxed);
+    if (last > 0) slot->last.store(last, std::memory_order_relaxed);
+    if (mark > 0) slot->mark.store(mark, std::memory_order_relaxed);
+    slot->eventTimeMs.store(nowMs(), std::memory_order_relaxed);
+
+    slot->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+PriceSnapshot PriceTable::read(const std::string& symbol) const {
+    PriceSnapshot snapshot;
+    snapshot.symbol = symbol;
+    snapshot.bidPrice = 0.0;
+    snapshot.askPrice = 0.0;
+    snapshot.lastPrice = 0.0;
+    snapshot.markPrice = 0.0;
+    snapshot.eventTimeMs = 0;
+    snapshot.valid = false;
+
+    const Slot* slot = find(toUpper(symbol));
+    if (!slot) return snapshot;
+
+    uint64_t before, after = 0;
+    do {
+        before = slot->sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;  // 기록 중이면 다시 시도
+        }
+        snapshot.bidPrice = slot->bid.load(std::memory_order_relaxed);
+        snapshot.askPrice = slot->ask.load(std::memory_order_relaxed);
+        snapshot.lastPrice = slot->last.load(std::memory_order_relaxed);
+        snapshot.markPrice = slot->mark.load(std::memory_order_relaxed);
+        snapshot.eventTimeMs = slot->eventTimeMs.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = slot->sequence.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+
+    snapshot.valid = before > 0;
+    return snapshot;
+}
+
+// === MarketDataStream ===
+
+MarketDataStream::MarketDataStream(MarketType type, const std::string& base_url, const std::vector<std::string>& symbols)
+    : type_(type), url_(buildStreamUrl(type, base_url, symbols)), table_(symbols),
+      running_(false), live_(false), reconnects_(0), messages_(0) {
+}
+
+MarketDataStream::~MarketDataStream() {
+    stop();
+}
+
+std::string MarketDataStream::buildStreamUrl(MarketType type, const std::string& base_url,
+                                             const std::vector<std::string>& symbols) {
+    std::string url = base_url;
+    if (!url.empty() && url.back() == '/') {
+        url.pop_back();
+    }
+    url += "/stream?streams=";
+
+    bool first = true;
+    for (const auto& symbol : symbols) {
+        std::string lower = toLower(symbol);
+        std::vector<std::string> streams = {lower + "@bookTicker", lower + "@aggTrade"};
+        if (type == MarketType::Futures) {
+            streams.push_back(lower + "@markPrice@1s");
+        }
+        for (const auto& stream : streams) {
+            if (!first) url += "/";
+            url += stream;
+            first = false;
+        }
+    }
+    return url;
+}
+
+void MarketDataStream::start() {
+    if (running_.exchange(true)) return;
+    worker_ = std::thread(&MarketDataStream::run, this);
+}
+
+void MarketDataStream::stop() {
+    running_ = false;
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    live_ = false;
+}
+
+bool MarketDataStream::isLive() const {
+    return live_;
+}
+
+PriceSnapshot MarketDataStream::getPrice(const std::string& symbol) const {
+    return table_.read(symbol);
+}
+
+void MarketDataStream::run() {
+    int backoff_ms = 500;
+    bool connected_once = false;
+
+    while (running_) {
+        if (!client_.connect(url_, 10000)) {
+            // 재연결 대기 (stop 요청에 빠르게 반응하도록 잘게 나누어 대기)
+            for (int waited = 0; waited < backoff_ms && running_; waited += 100) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            backoff_ms = std::min(backoff_ms * 2, 30000);
+            continue;
+        }
+
+        if (connected_once) {
+            reconnects_++;
+        }
+        connected_once = true;
+        backoff_ms = 500;
+        live_ = true;
+
+        std::string message;
+        while (running_) {
+            WebSocketClient::ReadResult result = client_.readMessage(message, 200);
+            if (result == WebSocketClient::ReadResult::Closed) break;
+            if (result == WebSocketClient::ReadResult::Message) {
+                handleMessage(message);
+            }
+        }
+
+        live_ = false;
+        client_.close();
+    }
+}
+
+void MarketDataStream::handleMessage(const std::string& message) {
+    // {"stream":"btcusdt@bookTicker","data":{...}}
+    if (!doc_.parse(message)) return;
+    JSONValue root = doc_.root();
+
+    std::string_view stream = root["stream"].raw();
+    size_t at = stream.find('@');
+    if (at == std::string_view::npos) return;
+
+    JSONValue data = root["data"];
+    if (!data.isObject()) return;
+
+    std::string symbol = toUpper(std::string(stream.substr(0, at)));
+    std::string_view kind = stream.substr(at + 1);
+
+    if (kind == "bookTicker") {
+        table_.update(symbol, data["b"].asDouble(), data["a"].asDouble(), 0.0, 0.0);
+    } else if (kind == "aggTrade") {
+        table_.update(symbol, 0.0, 0.0, data["p"].asDouble(), 0.0);
+    } else if (kind.compare(0, 9, "markPrice") == 0) {
+        table_.update(symbol, 0.0, 0.0, 0.0, data["p"].asDouble());
+    } else {
+        return;
+    }
+
+    messages_++;
+}
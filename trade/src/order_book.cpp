@@ -0,0 +1,200 @@
+#include "order_book.h"
+#include "market_data_stream.h"
+#include <algorithm>
+
+void DepthUpdate::clear() {
+    firstUpdateId = 0;
+    finalUpdateId = 0;
+    previousUpdateId = -1;
+    bids.clear();
+    asks.clear();
+}
+
+// === OrderBook ===
+
+OrderBook::OrderBook(MarketType type, const std::string& symbol)
+    : type_(type), symbol_(symbol), last_update_id_(0), awaiting_first_(false),
+      top_sequence_(0), bid_price_(0), bid_quantity_(0), ask_price_(0), ask_quantity_(0),
+      top_update_id_(0), synced_(false) {
+}
+
+void OrderBook::load(const DepthSnapshot& snapshot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // 스냅샷은 최우선 호가가 앞에 오므로 뒤집어 최우선 호가를 배열 끝에 둔다
+    bids_.assign(snapshot.bids.rbegin(), snapshot.bids.rend());
+    asks_.assign(snapshot.asks.rbegin(), snapshot.asks.rend());
+    bids_.erase(std::remove_if(bids_.begin(), bids_.end(),
+                               [](const PriceLevel& level) { return !level.quantity.isPositive(); }), bids_.end());
+    asks_.erase(std::remove_if(asks_.begin(), asks_.end(),
+                               [](const PriceLevel& level) { return !level.quantity.isPositive(); }), asks_.end());
+
+    last_update_id_ = snapshot.lastUpdateId;
+    awaiting_first_ = true;
+    publishTop();
+    synced_.store(true, std::memory_order_release);
+}
+
+void OrderBook::invalidate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    synced_.store(false, std::memory_order_release);
+    awaiting_first_ = false;
+}
+
+OrderBook::ApplyResult OrderBook::apply(const DepthUpdate& update) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!synced_.load(std::memory_order_relaxed)) {
+        return ApplyResult::NotSynced;
+    }
+
+    bool spot = (type_ == MarketType::Spot);
+    if (spot ? update.finalUpdateId <= last_update_id_ : update.finalUpdateId < last_update_id_) {
+        return ApplyResult::Stale;
+    }
+
+    bool continuous;
+    if (awaiting_first_) {
+        long long boundary = spot ? last_update_id_ + 1 : last_update_id_;
+        continuous = update.firstUpdateId <= boundary && boundary <= update.finalUpdateId;
+    } else if (spot) {
+        continuous = update.firstUpdateId == last_update_id_ + 1;
+    } else {
+        continuous = update.previousUpdateId == last_update_id_;
+    }
+    if (!continuous) {
+        synced_.store(false, std::memory_order_release);
+        return ApplyResult::Gap;
+    }
+
+    for (const auto& level : update.bids) applyLevel(bids_, BookSide::Bid, level);
+    for (const auto& level : update.asks) applyLevel(asks_, BookSide::Ask, level);
+
+    last_update_id_ = update.finalUpdateId;
+    awaiting_first_ = false;
+    publishTop();
+    return ApplyResult::Applied;
+}
+
+// 배열 안에서 price가 들어갈 위치 (매수는 오름차순, 매도는 내림차순)
+static std::vector<PriceLevel>::const_iterator lowerBound(const std::vector<PriceLevel>& levels, BookSide side,
+                                                          Decimal price) {
+    if (side == BookSide::Bid) {
+        return std::lower_bound(levels.begin(), levels.end(), price,
+                                [](const PriceLevel& level, Decimal value) { return level.price < value; });
+    }
+    return std::lower_bound(levels.begin(), levels.end(), price,
+                            [](const PriceLevel& level, Decimal value) { return level.price > value; });
+}
+
+void OrderBook::applyLevel(std::vector<PriceLevel>& levels, BookSide side, const PriceLevel& level) {
+    auto it = levels.begin() + (lowerBound(levels, side, level.price) - levels.cbegin());
+    bool exists = (it != levels.end() && it->price == level.price);
+
+    if (!level.quantity.isPositive()) {
+        if (exists) levels.erase(it);
+    } else if (exists) {
+        it->quantity = level.quantity;
+    } else {
+        levels.insert(it, level);
+    }
+}
+
+const PriceLevel* OrderBook::findLevel(const std::vector<PriceLevel>& levels, BookSide side, Decimal price) {
+    auto it = lowerBound(levels, side, price);
+    return (it != levels.end() && it->price == price) ? &*it : nullptr;
+}
+
+void OrderBook::publishTop() {
+    uint64_t sequence = top_sequence_.load(std::memory_order_relaxed);
+    top_sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    bid_price_.store(bids_.empty() ? 0 : bids_.back().price.raw(), std::memory_order_relaxed);
+    bid_quantity_.store(bids_.empty() ? 0 : bids_.back().quantity.raw(), std::memory_order_relaxed);
+    ask_price_.store(asks_.empty() ? 0 : asks_.back().price.raw(), std::memory_order_relaxed);
+    ask_quantity_.store(asks_.empty() ? 0 : asks_.back().quantity.raw(), std::memory_order_relaxed);
+    top_update_id_.store(last_update_id_, std::memory_order_relaxed);
+
+    top_sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+BookTop OrderBook::top() const {
+    BookTop result;
+    uint64_t before, after = 0;
+    do {
+        before = top_sequence_.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;  // 기록 중이면 다시 시도
+        }
+        result.bid.price = Decimal::fromRaw(bid_price_.load(std::memory_order_relaxed));
+        result.bid.quantity = Decimal::fromRaw(bid_quantity_.load(std::memory_order_relaxed));
+        result.ask.price = Decimal::fromRaw(ask_price_.load(std::memory_order_relaxed));
+        result.ask.quantity = Decimal::fromRaw(ask_quantity_.load(std::memory_order_relaxed));
+        result.updateId = top_update_id_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = top_sequence_.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+
+    result.synced = synced_.load(std::memory_order_acquire);
+    return result;
+}
+
+Decimal OrderBook::quantityAt(BookSide side, Decimal price) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const PriceLevel* level = findLevel(side == BookSide::Bid ? bids_ : asks_, side, price);
+    return level ? level->quantity : Decimal();
+}
+
+std::vector<PriceLevel> OrderBook::depth(BookSide side, size_t levels) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::vector<PriceLevel>& book = (side == BookSide::Bid) ? bids_ : asks_;
+    size_t count = std::min(levels, book.size());
+    return std::vector<PriceLevel>(book.rbegin(), book.rbegin() + count);
+}
+
+Decimal OrderBook::cumulativeQuantity(BookSide side, size_t levels) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::vector<PriceLevel>& book = (side == BookSide::Bid) ? bids_ : asks_;
+    size_t count = std::min(levels, book.size());
+    Decimal total;
+    for (auto it = book.rbegin(); it != book.rbegin() + count; ++it) {
+        total = total + it->quantity;
+    }
+    return total;
+}
+
+size_t OrderBook::levelCount(BookSide side) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (side == BookSide::Bid) ? bids_.size() : asks_.size();
+}
+
+// === 스냅샷 파싱 ===
+
+bool parseDepthLevels(JSONValue array, std::vector<PriceLevel>& levels) {
+    for (JSONValue entry : array) {
+        PriceLevel level;
+        if (!Decimal::parse(entry.at(0).raw(), level.price) || !Decimal::parse(entry.at(1).raw(), level.quantity)) {
+            return false;
+        }
+        levels.push_back(level);
+    }
+    return true;
+}
+
+bool parseDepthSnapshot(const std::string& response, DepthSnapshot& snapshot) {
+    JSONDocument doc(response);
+    JSONValue root = doc.root();
+    if (!root.isObject() || !root["lastUpdateId"].getInt(snapshot.lastUpdateId)) {
+        snapshot.error = "호가 스냅샷 응답 형식 오류";
+        return false;
+    }
+    snapshot.bids.clear();
+    snapshot.asks.clear();
+    snapshot.bids.reserve(root["bids"].size());
+    snapshot.asks.reserve(root["asks"].size());
+    if (!parseDepthLevels(root["bids"], snapshot.bids) || !parseDepthLevels(root["asks"], snapshot.asks)) {
+        snapshot.error = "호가 가격/수량 해석 실패";
+        return false;
+    }
+    return true;
+}
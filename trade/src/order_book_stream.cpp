@@ -0,0 +1,263 @@
+#include "order_book_stream.h"
+#include <algorithm>
+#include <cctype>
+
+static std::string toLower(const std::string& value) {
+    std::string lower = value;
+    for (char& c : lower) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return lower;
+}
+
+static std::string toUpper(const std::string& value) {
+    std::string upper = value;
+    for (char& c : upper) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return upper;
+}
+
+OrderBookStream::OrderBookStream(MarketType type, const BinanceAPI& rest, const std::string& ws_base_url,
+                                 const std::vector<std::string>& symbols)
+    : type_(type), rest_(rest), running_(false), live_(false), resyncs_(0), messages_(0), snapshot_ready_(false) {
+    url_ = ws_base_url;
+    if (!url_.empty() && url_.back() == '/') {
+        url_.pop_back();
+    }
+    url_ += "/stream?streams=";
+
+    for (const auto& raw : symbols) {
+        std::string lower = toLower(raw);
+        if (lower.empty() || index_.count(lower)) continue;
+
+        if (!symbols_.empty()) url_ += "/";
+        url_ += lower + "@depth@100ms";
+
+        index_[lower] = entries_.size();
+        symbols_.push_back(toUpper(raw));
+        entries_.emplace_back();
+        entries_.back().book = std::make_shared<OrderBook>(type, symbols_.back());
+    }
+}
+
+OrderBookStream::~OrderBookStream() {
+    stop();
+}
+
+void OrderBookStream::start() {
+    if (running_.exchange(true)) return;
+    snapshot_worker_ = std::thread(&OrderBookStream::runSnapshots, this);
+    worker_ = std::thread(&OrderBookStream::run, this);
+}
+
+void OrderBookStream::stop() {
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        running_ = false;
+    }
+    snapshot_cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    if (snapshot_worker_.joinable()) {
+        snapshot_worker_.join();
+    }
+    live_ = false;
+
+    // 다시 start할 때 이전 연결의 요청/결과가 남지 않도록 정리
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    snapshot_requests_.clear();
+    snapshot_results_.clear();
+    snapshot_ready_ = false;
+    for (auto& entry : entries_) {
+        entry.snapshot_requested = false;
+    }
+}
+
+bool OrderBookStream::isLive() const {
+    return live_;
+}
+
+std::shared_ptr<const OrderBook> OrderBookStream::book(const std::string& symbol) const {
+    auto it = index_.find(toLower(symbol));
+    return (it != index_.end()) ? entries_[it->second].book : nullptr;
+}
+
+void OrderBookStream::setError(const std::string& error) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    error_ = error;
+}
+
+std::string OrderBookStream::lastError() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return error_;
+}
+
+void OrderBookStream::waitBackoff(int& backoff_ms) {
+    // stop 요청에 빠르게 반응하도록 잘게 나누어 대기
+    for (int waited = 0; waited < backoff_ms && running_; waited += 100) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    backoff_ms = std::min(backoff_ms * 2, 30000);
+}
+
+void OrderBookStream::run() {
+    int backoff_ms = 500;
+
+    while (running_) {
+        if (!client_.connect(url_, 10000)) {
+            setError("호가 스트림 연결 실패: " + client_.lastError());
+            waitBackoff(backoff_ms);
+            continue;
+        }
+        backoff_ms = 500;
+        live_ = true;
+
+        // 연결이 바뀌면 이전 id와 이어지지 않으므로 모든 심볼을 스냅샷부터 다시 동기화
+        for (auto& entry : entries_) {
+            entry.book->invalidate();
+            entry.pending_count = 0;
+            entry.last_snapshot = std::chrono::steady_clock::time_point();
+        }
+
+        std::string message;
+        while (running_) {
+            WebSocketClient::ReadResult result = client_.readMessage(message, 200);
+            if (result == WebSocketClient::ReadResult::Closed) {
+                setError("호가 스트림 연결 끊김: " + client_.lastError());
+                break;
+            }
+            if (result == WebSocketClient::ReadResult::Message) {
+                handleMessage(message);
+            }
+            if (snapshot_ready_.load(std::memory_order_acquire)) {
+                applySnapshots();
+            }
+        }
+
+        live_ = false;
+        client_.close();
+    }
+}
+
+void OrderBookStream::handleMessage(const std::string& message) {
+    // {"stream":"btcusdt@depth@100ms","data":{"e":"depthUpdate","U":..,"u":..,"pu":..,"b":[..],"a":[..]}}
+    if (!doc_.parse(message)) return;
+    JSONValue root = doc_.root();
+
+    std::string_view stream = root["stream"].raw();
+    auto it = index_.find(stream.substr(0, stream.find('@')));
+    if (it == index_.end()) return;
+
+    JSONValue data = root["data"];
+    update_.clear();
+    if (!data.isObject() || !data["U"].getInt(update_.firstUpdateId) || !data["u"].getInt(update_.finalUpdateId)) {
+        return;
+    }
+    if (type_ == MarketType::Futures) {
+        data["pu"].getInt(update_.previousUpdateId);
+    }
+    if (!parseDepthLevels(data["b"], update_.bids) || !parseDepthLevels(data["a"], update_.asks)) {
+        return;
+    }
+    messages_++;
+
+    Entry& entry = entries_[it->second];
+    OrderBook::ApplyResult result = entry.book->apply(update_);
+    if (result == OrderBook::ApplyResult::Applied || result == OrderBook::ApplyResult::Stale) {
+        return;
+    }
+
+    if (result == OrderBook::ApplyResult::Gap) {
+        resyncs_++;
+        entry.pending_count = 0;
+    }
+    buffer(entry);
+    requestSnapshot(it->second);
+}
+
+void OrderBookStream::buffer(Entry& entry) {
+    // 스냅샷을 오래 받지 못하면 가장 오래된 절반을 버림 (다음 스냅샷이 그 구간을 덮음)
+    if (entry.pending_count >= MAX_PENDING) {
+        size_t drop = MAX_PENDING / 2;
+        std::rotate(entry.pending.begin(), entry.pending.begin() + drop, entry.pending.begin() + entry.pending_count);
+        entry.pending_count -= drop;
+    }
+    if (entry.pending_count == entry.pending.size()) {
+        entry.pending.emplace_back();
+    }
+    entry.pending[entry.pending_count++] = update_;
+}
+
+void OrderBookStream::requestSnapshot(size_t entry_index) {
+    // 이미 요청한 스냅샷이 오는 중이면 그 결과로 버퍼를 반영
+    Entry& entry = entries_[entry_index];
+    auto now = std::chrono::steady_clock::now();
+    if (entry.snapshot_requested || now - entry.last_snapshot < std::chrono::milliseconds(SNAPSHOT_RETRY_MS)) {
+        return;
+    }
+    entry.last_snapshot = now;
+    entry.snapshot_requested = true;
+
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        snapshot_requests_.push_back(entry_index);
+    }
+    snapshot_cv_.notify_one();
+}
+
+void OrderBookStream::runSnapshots() {
+    while (true) {
+        size_t entry_index;
+        {
+            std::unique_lock<std::mutex> lock(snapshot_mutex_);
+            snapshot_cv_.wait(lock, [this]() { return !running_ || !snapshot_requests_.empty(); });
+            if (!running_) return;
+            entry_index = snapshot_requests_.front();
+            snapshot_requests_.pop_front();
+        }
+
+        // 요청 중에는 잠금 없이 대기 (수신 스레드는 계속 이벤트를 읽고 버퍼링)
+        DepthSnapshot snapshot = rest_.getDepthSnapshot(type_, entries_[entry_index].book->symbol(), SNAPSHOT_LIMIT);
+
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        snapshot_results_.emplace_back(entry_index, std::move(snapshot));
+        snapshot_ready_.store(true, std::memory_order_release);
+    }
+}
+
+void OrderBookStream::applySnapshots() {
+    std::vector<std::pair<size_t, DepthSnapshot>> results;
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        results.swap(snapshot_results_);
+        snapshot_ready_.store(false, std::memory_order_relaxed);
+    }
+
+    for (auto& result : results) {
+        Entry& entry = entries_[result.first];
+        entry.snapshot_requested = false;
+        if (!result.second.success) {
+            setError(entry.book->symbol() + " 호가 스냅샷 실패: " + result.second.error);
+            continue;
+        }
+        synchronize(entry, result.second);
+    }
+}
+
+void OrderBookStream::synchronize(Entry& entry, const DepthSnapshot& snapshot) {
+    entry.book->load(snapshot);
+
+    // 버퍼의 이벤트 중 스냅샷 이후 것만 순서대로 반영
+    for (size_t i = 0; i < entry.pending_count; i++) {
+        OrderBook::ApplyResult result = entry.book->apply(entry.pending[i]);
+        if (result == OrderBook::ApplyResult::Gap) {
+            // 스냅샷이 버퍼보다 오래되었거나 버퍼 안에서 id가 끊김: 이 이벤트부터 남기고 다음 스냅샷을 기다림
+            std::rotate(entry.pending.begin(), entry.pending.begin() + i, entry.pending.begin() + entry.pending_count);
+            entry.pending_count -= i;
+            return;
+        }
+    }
+    entry.pending_count = 0;
+}
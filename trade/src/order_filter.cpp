@@ -0,0 +1,102 @@
+#include "order_filter.h"
+#include <algorithm>
+
+const char* filterErrorMessage(FilterError error) {
+    switch (error) {
+        case FilterError::None: return "";
+        case FilterError::SymbolNotTrading: return "거래 중인 심볼이 아닙니다";
+        case FilterError::InvalidPrice: return "주문 가격이 올바르지 않습니다";
+        case FilterError::PriceTooLow: return "주문 가격이 최소 가격보다 낮습니다 (PRICE_FILTER)";
+        case FilterError::PriceTooHigh: return "주문 가격이 최대 가격보다 높습니다 (PRICE_FILTER)";
+        case FilterError::PriceBelowBand: return "주문 가격이 허용 범위보다 낮습니다 (PERCENT_PRICE)";
+        case FilterError::PriceAboveBand: return "주문 가격이 허용 범위보다 높습니다 (PERCENT_PRICE)";
+        case FilterError::QuantityTooLow: return "주문 수량이 최소 수량보다 적습니다 (LOT_SIZE)";
+        case FilterError::QuantityTooHigh: return "주문 수량이 최대 수량보다 많습니다 (LOT_SIZE)";
+        case FilterError::NotionalTooLow: return "주문 금액이 최소 주문 금액보다 작습니다 (MIN_NOTIONAL)";
+        case FilterError::NotionalTooHigh: return "주문 금액이 최대 주문 금액보다 큽니다 (NOTIONAL)";
+        case FilterError::TooManyOrders: return "미체결 주문 수가 한도에 도달했습니다 (MAX_NUM_ORDERS)";
+    }
+    return "";
+}
+
+bool orderTypeHasPrice(OrderType type) {
+    switch (type) {
+        case OrderType::Limit:
+        case OrderType::Stop:
+        case OrderType::TakeProfit:
+        case OrderType::LimitMaker:
+        case OrderType::StopLossLimit:
+        case OrderType::TakeProfitLimit:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 단위 필터가 없을 때 정밀도(소수 자릿수)를 단위로 사용 (정밀도도 없으면 0 = 맞추지 않음)
+static Decimal unitOrPrecision(Decimal unit, int precision) {
+    if (unit.isPositive() || precision <= 0 || precision > Decimal::DIGITS) return unit;
+    int64_t raw = 1;
+    for (int i = precision; i < Decimal::DIGITS; i++) raw *= 10;
+    return Decimal::fromRaw(raw);
+}
+
+OrderFilterResult applyOrderFilters(const SymbolInfo& info, const OrderFilterRequest& order) {
+    OrderFilterResult result;
+    result.error = FilterError::None;
+    result.price = order.price;
+
+    bool priced = orderTypeHasPrice(order.type);
+
+    // LOT_SIZE (시장가는 MARKET_LOT_SIZE가 있으면 그쪽을 사용)
+    bool market_lot = !priced && info.marketStepSize.isPositive();
+    Decimal min_qty = market_lot ? info.marketMinQty : info.minQty;
+    Decimal max_qty = market_lot ? info.marketMaxQty : info.maxQty;
+    Decimal step = unitOrPrecision(market_lot ? info.marketStepSize : info.stepSize, info.quantityPrecision);
+    result.quantity = order.quantity.floorToStep(step);
+
+    // PRICE_FILTER: 지정 가격보다 불리해지지 않는 방향으로 맞춤
+    if (priced) {
+        Decimal tick = unitOrPrecision(info.tickSize, info.pricePrecision);
+        result.price = (order.side == OrderSide::Sell) ? order.price.ceilToStep(tick) : order.price.floorToStep(tick);
+    }
+
+    // 주문 금액 기준 가격 (지정가는 주문 가격, 시장가는 현재 시세)
+    Decimal notional_price = priced ? result.price : order.referencePrice;
+    result.minQuantity = min_qty;
+    if (notional_price.isPositive() && info.minNotional.isPositive()) {
+        result.minQuantity = std::max(result.minQuantity, info.minNotional.divideCeil(notional_price));
+    }
+    result.minQuantity = result.minQuantity.ceilToStep(step);
+
+    if (info.status != "TRADING") {
+        result.error = FilterError::SymbolNotTrading;
+    } else if (info.maxNumOrders > 0 && order.openOrders >= info.maxNumOrders) {
+        result.error = FilterError::TooManyOrders;
+    } else if (priced && !result.price.isPositive()) {
+        result.error = FilterError::InvalidPrice;
+    } else if (priced && info.minPrice.isPositive() && result.price < info.minPrice) {
+        result.error = FilterError::PriceTooLow;
+    } else if (priced && info.maxPrice.isPositive() && result.price > info.maxPrice) {
+        result.error = FilterError::PriceTooHigh;
+    } else if (priced && order.referencePrice.isPositive() && info.multiplierDown.isPositive() &&
+               result.price < order.referencePrice * info.multiplierDown) {
+        result.error = FilterError::PriceBelowBand;
+    } else if (priced && order.referencePrice.isPositive() && info.multiplierUp.isPositive() &&
+               result.price > order.referencePrice * info.multiplierUp) {
+        result.error = FilterError::PriceAboveBand;
+    } else if (!result.quantity.isPositive() || result.quantity < min_qty) {
+        result.error = FilterError::QuantityTooLow;
+    } else if (max_qty.isPositive() && result.quantity > max_qty) {
+        result.error = FilterError::QuantityTooHigh;
+    } else if (notional_price.isPositive()) {
+        Decimal notional = result.quantity * notional_price;
+        if (notional < info.minNotional) {
+            result.error = FilterError::NotionalTooLow;
+        } else if (info.maxNotional.isPositive() && notional > info.maxNotional) {
+            result.error = FilterError::NotionalTooHigh;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,196 @@
+#include "order_gateway.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+static int64_t nowMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// NUL 종료를 보장하며 복사 (넘치면 잘림)
+static void copyText(char* dest, size_t size, const std::string& text) {
+    size_t length = std::min(text.size(), size - 1);
+    std::memcpy(dest, text.data(), length);
+    dest[length] = '\0';
+}
+
+OrderIntent makeOrderIntent(MarketType market, std::string_view symbol, OrderSide side, OrderType type,
+                            Decimal quantity, Decimal price) {
+    OrderIntent intent = {};
+    intent.action = OrderIntent::Action::Place;
+    intent.market = market;
+    intent.symbol = SymbolTable::instance().intern(symbol);
+    intent.side = side;
+    intent.type = type;
+    intent.timeInForce = TimeInForce::None;
+    intent.positionSide = PositionSide::Both;
+    intent.quantity = quantity;
+    intent.price = price;
+    return intent;
+}
+
+OrderGateway::OrderGateway(const BinanceAPI& api, size_t capacity)
+    : api_(api), intents_(capacity), shared_intents_(capacity), replies_(capacity),
+      running_(false), submitted_(0), rejected_(0), completed_(0) {
+}
+
+OrderGateway::~OrderGateway() {
+    stop();
+}
+
+void OrderGateway::start() {
+    if (running_.exchange(true)) return;
+    worker_ = std::thread(&OrderGateway::run, this);
+}
+
+void OrderGateway::stop() {
+    running_ = false;
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+bool OrderGateway::submit(const OrderIntent& intent) {
+    OrderIntent stamped = intent;
+    stamped.submittedUs = nowMicros();
+    if (!intents_.tryPush(stamped)) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    submitted_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool OrderGateway::submitShared(const OrderIntent& intent) {
+    OrderIntent stamped = intent;
+    stamped.submittedUs = nowMicros();
+    if (!shared_intents_.tryPush(stamped)) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    submitted_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool OrderGateway::poll(OrderReply& reply) {
+    return replies_.tryPop(reply);
+}
+
+OrderGatewayStats OrderGateway::stats() const {
+    OrderGatewayStats stats;
+    stats.submitted = submitted_.load(std::memory_order_relaxed);
+    stats.rejected = rejected_.load(std::memory_order_relaxed);
+    stats.completed = completed_.load(std::memory_order_relaxed);
+    stats.pendingIntents = intents_.size() + shared_intents_.size();
+    stats.pendingReplies = replies_.size();
+    return stats;
+}
+
+void OrderGateway::run() {
+    OrderIntent intent;
+    OrderReply reply;
+    int idle = 0;
+
+    // 종료 요청 후에도 이미 받은 의도는 모두 처리
+    while (running_ || intents_.size() > 0 || shared_intents_.size() > 0) {
+        flushOverflow();
+
+        if (intents_.tryPop(intent) || shared_intents_.tryPop(intent)) {
+            idle = 0;
+            execute(intent, reply);
+            deliver(reply);
+            completed_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        // 잠깐은 바쁜 대기로 지연을 줄이고, 계속 비어 있으면 잠들어 코어를 양보
+        if (++idle < SPIN_ITERATIONS) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(IDLE_SLEEP_US));
+        }
+    }
+}
+
+void OrderGateway::execute(const OrderIntent& intent, OrderReply& reply) {
+    reply = OrderReply();
+    reply.requestId = intent.requestId;
+    reply.action = intent.action;
+    reply.status = OrderStatus::Unknown;
+    reply.queueUs = nowMicros() - intent.submittedUs;
+    std::memcpy(reply.clientOrderId, intent.clientOrderId, sizeof(reply.clientOrderId));
+    reply.clientOrderId[sizeof(reply.clientOrderId) - 1] = '\0';
+
+    const std::string& symbol = SymbolTable::instance().name(intent.symbol);
+    if (symbol.empty()) {
+        copyText(reply.error, sizeof(reply.error), "알 수 없는 심볼 ID");
+        reply.totalUs = nowMicros() - intent.submittedUs;
+        return;
+    }
+
+    bool success;
+    std::string orderId, status, error;
+    if (intent.market == MarketType::Spot) {
+        OrderResponse order;
+        if (intent.action == OrderIntent::Action::Cancel) {
+            order = api_.cancelSpotOrder(symbol, std::to_string(intent.orderId));
+        } else {
+            const char* tif = (intent.timeInForce == TimeInForce::None) ? "GTC" : toString(intent.timeInForce);
+            order = api_.placeSpotOrder(symbol, toString(intent.side), toString(intent.type), intent.quantity,
+                                        intent.price, tif, reply.clientOrderId);
+        }
+        success = order.success;
+        orderId = order.orderId;
+        status = order.status;
+        error = order.error;
+        reply.price = order.price;
+        reply.quantity = order.quantity;
+    } else {
+        FuturesOrderResponse order;
+        if (intent.action == OrderIntent::Action::Cancel) {
+            order = api_.cancelFuturesOrder(symbol, std::to_string(intent.orderId));
+        } else {
+            FuturesOrderRequest request;
+            request.symbol = symbol;
+            request.side = toString(intent.side);
+            request.type = toString(intent.type);
+            request.quantity = intent.quantity;
+            request.price = intent.price;
+            request.positionSide = toString(intent.positionSide);
+            request.timeInForce = (intent.timeInForce == TimeInForce::None) ? "GTC" : toString(intent.timeInForce);
+            request.reduceOnly = intent.reduceOnly;
+            request.newClientOrderId = reply.clientOrderId;
+            order = api_.placeFuturesOrder(request);
+        }
+        success = order.success;
+        orderId = order.orderId;
+        status = order.status;
+        error = order.error;
+        reply.price = order.price;
+        reply.quantity = order.quantity;
+        if (!order.clientOrderId.empty()) {
+            copyText(reply.clientOrderId, sizeof(reply.clientOrderId), order.clientOrderId);
+        }
+    }
+
+    reply.success = success;
+    reply.orderId = std::strtoll(orderId.c_str(), nullptr, 10);
+    fromString(status, reply.status);
+    copyText(reply.error, sizeof(reply.error), error);
+    reply.totalUs = nowMicros() - intent.submittedUs;
+}
+
+void OrderGateway::deliver(const OrderReply& reply) {
+    // 앞선 응답이 남아 있으면 순서를 지키기 위해 뒤에 붙임
+    if (!overflow_.empty() || !replies_.tryPush(reply)) {
+        overflow_.push_back(reply);
+    }
+}
+
+void OrderGateway::flushOverflow() {
+    while (!overflow_.empty() && replies_.tryPush(overflow_.front())) {
+        overflow_.pop_front();
+    }
+}
@@ -0,0 +1,201 @@
+#include "order_session.h"
+#include "json_parser.h"
+#include "request_signer.h"
+#include <chrono>
+#include <cctype>
+
+OrderSession::OrderSession(const std::string& url, const std::string& api_key, Signer signer)
+    : url_(url), api_key_(api_key), signer_(signer), stopping_(false), next_id_(1),
+      requests_(0), last_rtt_ms_(0.0), total_rtt_ms_(0.0) {
+}
+
+OrderSession::~OrderSession() {
+    close();
+}
+
+long long OrderSession::timestampMs() {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+}
+
+bool OrderSession::connect() {
+    std::lock_guard<std::mutex> lock(connect_mutex_);
+    if (client_.isConnected()) {
+        return true;
+    }
+
+    // 이전 연결의 수신 스레드 정리 후 재연결
+    if (reader_.joinable()) {
+        reader_.join();
+    }
+    if (!client_.connect(url_, 10000)) {
+        return false;
+    }
+    reader_ = std::thread(&OrderSession::run, this);
+    return true;
+}
+
+void OrderSession::close() {
+    std::lock_guard<std::mutex> lock(connect_mutex_);
+
+    // 수신 스레드가 직접 연결을 닫도록 요청 (소켓 읽기는 수신 스레드에서만 수행)
+    stopping_ = true;
+    if (reader_.joinable()) {
+        reader_.join();
+    }
+    stopping_ = false;
+    failPending("주문 세션이 종료되었습니다");
+}
+
+bool OrderSession::isConnected() const {
+    return client_.isConnected();
+}
+
+void OrderSession::run() {
+    std::string message;
+    JSONDocument doc;
+    while (!stopping_ && client_.isConnected()) {
+        WebSocketClient::ReadResult result = client_.readMessage(message, 200);
+        if (result == WebSocketClient::ReadResult::Closed) break;
+        if (result != WebSocketClient::ReadResult::Message) continue;
+
+        // {"id":"1","status":200,"result":{...},"rateLimits":[...]}
+        doc.parse(message);
+        JSONValue root = doc.root();
+        std::string id = root["id"].asString();
+        std::string body;
+        if (root["status"].asInt() == 200) {
+            body = std::string(root["result"].raw());
+        } else {
+            body = std::string(root["error"].raw());
+            if (body.empty()) {
+                body = "{\"error\":\"알 수 없는 응답: " + escapeJson(message.substr(0, 200)) + "\"}";
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        auto it = pending_.find(id);
+        if (it != pending_.end()) {
+            it->second.set_value(body);
+            pending_.erase(it);
+        }
+    }
+
+    client_.close();
+    failPending("주문 세션 연결 끊김: " + client_.lastError());
+}
+
+void OrderSession::failPending(const std::string& error) {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    for (auto& entry : pending_) {
+        entry.second.set_value("{\"error\":\"" + escapeJson(error) + "\"}");
+    }
+    pending_.clear();
+}
+
+std::string OrderSession::escapeJson(const std::string& value) {
+    std::string escaped;
+    escaped.reserve(value.length());
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += ' ';
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+bool OrderSession::isIntegerParam(const std::string& key) {
+    return key == "orderId" || key == "recvWindow" || key == "timestamp";
+}
+
+std::string OrderSession::buildRequest(const std::string& id, const std::string& method,
+                                       std::map<std::string, std::string> params, bool is_signed) {
+    if (is_signed) {
+        params["apiKey"] = api_key_;
+        params["timestamp"] = std::to_string(timestampMs());
+
+        // 서명 대상: 키 이름순으로 정렬한 key=value&... 문자열
+        QueryBuilder payload;
+        for (const auto& param : params) {
+            payload.append(param.first, param.second);
+        }
+        params["signature"] = signer_(payload.str());
+    }
+
+    std::string request = "{\"id\":\"" + id + "\",\"method\":\"" + method + "\",\"params\":{";
+    bool first = true;
+    for (const auto& param : params) {
+        if (!first) request += ",";
+        first = false;
+
+        // API가 정수로 정의한 키만 숫자로, 나머지는 모두 문자열로 전송
+        // (값 모양으로 추측하면 숫자로만 된 newClientOrderId나 정수 수량/가격까지 숫자가 됨)
+        bool is_integer = isIntegerParam(param.first) && !param.second.empty() && param.second.length() < 19;
+        for (char c : param.second) {
+            if (!std::isdigit(static_cast<unsigned char>(c))) {
+                is_integer = false;
+                break;
+            }
+        }
+        request += "\"" + param.first + "\":";
+        request += is_integer ? param.second : "\"" + escapeJson(param.second) + "\"";
+    }
+    request += "}}";
+    return request;
+}
+
+std::string OrderSession::call(const std::string& method, const std::map<std::string, std::string>& params,
+                               bool is_signed, int timeout_ms) {
+    if (!connect()) {
+        return "{\"error\":\"주문 세션 연결 실패: " + escapeJson(client_.lastError()) + "\"}";
+    }
+
+    std::string id = std::to_string(next_id_++);
+    std::future<std::string> response;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        response = pending_[id].get_future();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (!client_.sendText(buildRequest(id, method, params, is_signed))) {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        pending_.erase(id);
+        return "{\"error\":\"주문 요청 전송 실패\"}";
+    }
+
+    if (response.wait_for(std::chrono::milliseconds(timeout_ms)) != std::future_status::ready) {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        pending_.erase(id);
+        return "{\"error\":\"주문 응답 타임아웃 (" + std::to_string(timeout_ms / 1000) + "초 초과)\"}";
+    }
+
+    double rtt_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        requests_++;
+        last_rtt_ms_ = rtt_ms;
+        total_rtt_ms_ += rtt_ms;
+    }
+    return response.get();
+}
+
+double OrderSession::lastRoundTripMs() const {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return last_rtt_ms_;
+}
+
+double OrderSession::averageRoundTripMs() const {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return requests_ > 0 ? total_rtt_ms_ / requests_ : 0.0;
+}
+
+long OrderSession::requestCount() const {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return requests_;
+}
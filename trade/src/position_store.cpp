@@ -0,0 +1,396 @@
+#include "position_store.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define POSITION_KERNEL_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__)
+#define POSITION_KERNEL_AVX 1
+#include <immintrin.h>
+#endif
+#endif
+
+namespace {
+
+// 커널 입력/출력 열과 합계
+struct MarkColumns {
+    const double* quantity;
+    const double* entry;
+    const double* mark;
+    const double* leverage;
+    double* pnl;
+    double* percentage;
+    double* roe;
+    double* distance;
+    size_t count;
+};
+
+struct MarkSums {
+    double pnl;
+    double notional;
+    double margin;
+    double min_distance;
+};
+
+// 포지션 하나 계산 (모든 커널의 나머지 처리에도 사용)
+// 진입가/마크 가격 > 0, 레버리지 >= 1, 수량 != 0 은 저장소가 보장한다
+inline void markOne(const MarkColumns& c, size_t i, MarkSums& sums) {
+    double size = std::abs(c.quantity[i]);
+    double pnl = c.quantity[i] * (c.mark[i] - c.entry[i]);
+    double cost = size * c.entry[i];
+    double margin = cost / c.leverage[i];
+    double notional = size * c.mark[i];
+    double distance = (margin + pnl) / notional * 100.0;
+
+    c.pnl[i] = pnl;
+    c.percentage[i] = pnl / cost * 100.0;
+    c.roe[i] = pnl / margin * 100.0;
+    c.distance[i] = distance;
+
+    sums.pnl += pnl;
+    sums.notional += notional;
+    sums.margin += margin;
+    sums.min_distance = std::min(sums.min_distance, distance);
+}
+
+#ifndef POSITION_KERNEL_SSE2
+
+// ===== 스칼라 구현 (SIMD를 쓸 수 없는 환경) =====
+
+MarkSums markToMarketScalar(const MarkColumns& c) {
+    MarkSums sums{0.0, 0.0, 0.0, std::numeric_limits<double>::infinity()};
+    for (size_t i = 0; i < c.count; i++) {
+        markOne(c, i, sums);
+    }
+    return sums;
+}
+
+#endif
+
+#ifdef POSITION_KERNEL_SSE2
+
+// ===== SSE2 구현 (2개씩) =====
+
+MarkSums markToMarketSSE2(const MarkColumns& c) {
+    const __m128d sign_mask = _mm_set1_pd(-0.0);
+    const __m128d hundred = _mm_set1_pd(100.0);
+    __m128d sum_pnl = _mm_setzero_pd();
+    __m128d sum_notional = _mm_setzero_pd();
+    __m128d sum_margin = _mm_setzero_pd();
+    __m128d min_distance = _mm_set1_pd(std::numeric_limits<double>::infinity());
+
+    size_t i = 0;
+    for (; i + 2 <= c.count; i += 2) {
+        __m128d quantity = _mm_loadu_pd(c.quantity + i);
+        __m128d entry = _mm_loadu_pd(c.entry + i);
+        __m128d mark = _mm_loadu_pd(c.mark + i);
+        __m128d leverage = _mm_loadu_pd(c.leverage + i);
+
+        __m128d size = _mm_andnot_pd(sign_mask, quantity);
+        __m128d pnl = _mm_mul_pd(quantity, _mm_sub_pd(mark, entry));
+        __m128d cost = _mm_mul_pd(size, entry);
+        __m128d margin = _mm_div_pd(cost, leverage);
+        __m128d notional = _mm_mul_pd(size, mark);
+        __m128d distance = _mm_mul_pd(_mm_div_pd(_mm_add_pd(margin, pnl), notional), hundred);
+
+        _mm_storeu_pd(c.pnl + i, pnl);
+        _mm_storeu_pd(c.percentage + i, _mm_mul_pd(_mm_div_pd(pnl, cost), hundred));
+        _mm_storeu_pd(c.roe + i, _mm_mul_pd(_mm_div_pd(pnl, margin), hundred));
+        _mm_storeu_pd(c.distance + i, distance);
+
+        sum_pnl = _mm_add_pd(sum_pnl, pnl);
+        sum_notional = _mm_add_pd(sum_notional, notional);
+        sum_margin = _mm_add_pd(sum_margin, margin);
+        min_distance = _mm_min_pd(min_distance, distance);
+    }
+
+    double lanes[4][2];
+    _mm_storeu_pd(lanes[0], sum_pnl);
+    _mm_storeu_pd(lanes[1], sum_notional);
+    _mm_storeu_pd(lanes[2], sum_margin);
+    _mm_storeu_pd(lanes[3], min_distance);
+    MarkSums sums{lanes[0][0] + lanes[0][1], lanes[1][0] + lanes[1][1], lanes[2][0] + lanes[2][1],
+                  std::min(lanes[3][0], lanes[3][1])};
+
+    for (; i < c.count; i++) {
+        markOne(c, i, sums);
+    }
+    return sums;
+}
+
+#endif
+
+#ifdef POSITION_KERNEL_AVX
+
+// ===== AVX 구현 (4개씩, 실행 시 CPU 지원 확인 후 사용) =====
+
+__attribute__((target("avx")))
+MarkSums markToMarketAVX(const MarkColumns& c) {
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+    const __m256d hundred = _mm256_set1_pd(100.0);
+    __m256d sum_pnl = _mm256_setzero_pd();
+    __m256d sum_notional = _mm256_setzero_pd();
+    __m256d sum_margin = _mm256_setzero_pd();
+    __m256d min_distance = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+
+    size_t i = 0;
+    for (; i + 4 <= c.count; i += 4) {
+        __m256d quantity = _mm256_loadu_pd(c.quantity + i);
+        __m256d entry = _mm256_loadu_pd(c.entry + i);
+        __m256d mark = _mm256_loadu_pd(c.mark + i);
+        __m256d leverage = _mm256_loadu_pd(c.leverage + i);
+
+        __m256d size = _mm256_andnot_pd(sign_mask, quantity);
+        __m256d pnl = _mm256_mul_pd(quantity, _mm256_sub_pd(mark, entry));
+        __m256d cost = _mm256_mul_pd(size, entry);
+        __m256d margin = _mm256_div_pd(cost, leverage);
+        __m256d notional = _mm256_mul_pd(size, mark);
+        __m256d distance = _mm256_mul_pd(_mm256_div_pd(_mm256_add_pd(margin, pnl), notional), hundred);
+
+        _mm256_storeu_pd(c.pnl + i, pnl);
+        _mm256_storeu_pd(c.percentage + i, _mm256_mul_pd(_mm256_div_pd(pnl, cost), hundred));
+        _mm256_storeu_pd(c.roe + i, _mm256_mul_pd(_mm256_div_pd(pnl, margin), hundred));
+        _mm256_storeu_pd(c.distance + i, distance);
+
+        sum_pnl = _mm256_add_pd(sum_pnl, pnl);
+        sum_notional = _mm256_add_pd(sum_notional, notional);
+        sum_margin = _mm256_add_pd(sum_margin, margin);
+        min_distance = _mm256_min_pd(min_distance, distance);
+    }
+
+    double lanes[4][4];
+    _mm256_storeu_pd(lanes[0], sum_pnl);
+    _mm256_storeu_pd(lanes[1], sum_notional);
+    _mm256_storeu_pd(lanes[2], sum_margin);
+    _mm256_storeu_pd(lanes[3], min_distance);
+    MarkSums sums{lanes[0][0] + lanes[0][1] + lanes[0][2] + lanes[0][3],
+                  lanes[1][0] + lanes[1][1] + lanes[1][2] + lanes[1][3],
+                  lanes[2][0] + lanes[2][1] + lanes[2][2] + lanes[2][3],
+                  std::min(std::min(lanes[3][0], lanes[3][1]), std::min(lanes[3][2], lanes[3][3]))};
+
+    for (; i < c.count; i++) {
+        markOne(c, i, sums);
+    }
+    return sums;
+}
+
+#endif
+
+struct Kernel {
+    MarkSums (*mark_to_market)(const MarkColumns&);
+    const char* name;
+};
+
+Kernel selectKernel() {
+#ifdef POSITION_KERNEL_AVX
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx")) {
+        return {markToMarketAVX, "avx"};
+    }
+#endif
+#ifdef POSITION_KERNEL_SSE2
+    return {markToMarketSSE2, "sse2"};
+#else
+    return {markToMarketScalar, "scalar"};
+#endif
+}
+
+const Kernel& kernel() {
+    static const Kernel selected = selectKernel();
+    return selected;
+}
+
+}  // namespace
+
+PositionStore::PositionStore() {
+    totals_ = PositionTotals();
+}
+
+const char* PositionStore::kernelName() {
+    return kernel().name;
+}
+
+size_t PositionStore::slotOf(SymbolId symbol, PositionSide side) const {
+    for (size_t i = 0; i < symbol_.size(); i++) {
+        if (symbol_[i] == symbol && side_[i] == side) {
+            return i;
+        }
+    }
+    return symbol_.size();
+}
+
+void PositionStore::removeSlot(size_t slot) {
+    // 마지막 포지션을 빈자리로 옮겨 열을 연속으로 유지
+    size_t last = symbol_.size() - 1;
+    symbol_[slot] = symbol_[last];
+    side_[slot] = side_[last];
+    quantity_[slot] = quantity_[last];
+    entry_[slot] = entry_[last];
+    mark_[slot] = mark_[last];
+    leverage_[slot] = leverage_[last];
+
+    symbol_.pop_back();
+    side_.pop_back();
+    quantity_.pop_back();
+    entry_.pop_back();
+    mark_.pop_back();
+    leverage_.pop_back();
+}
+
+void PositionStore::load(const std::vector<PositionRecord>& positions) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    symbol_.clear();
+    side_.clear();
+    quantity_.clear();
+    entry_.clear();
+    mark_.clear();
+    leverage_.clear();
+
+    for (const auto& position : positions) {
+        if (position.positionAmt == 0 || position.entryPrice <= 0) continue;
+        symbol_.push_back(position.symbol);
+        side_.push_back(position.positionSide);
+        quantity_.push_back(position.positionAmt);
+        entry_.push_back(position.entryPrice);
+        mark_.push_back(position.markPrice > 0 ? position.markPrice : position.entryPrice);
+        leverage_.push_back(std::max(1, position.leverage));
+    }
+    recompute();
+}
+
+void PositionStore::apply(const PositionRecord& position) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t slot = slotOf(position.symbol, position.positionSide);
+    bool exists = slot < symbol_.size();
+
+    if (position.positionAmt == 0 || position.entryPrice <= 0) {
+        if (exists) removeSlot(slot);
+        recompute();
+        return;
+    }
+
+    // 이벤트에는 마크 가격이 없으므로 최근 마크 가격, 없으면 미실현 손익에서 역산 (up = 수량 * (마크 - 진입))
+    double mark = position.markPrice;
+    if (mark <= 0 && position.symbol < latest_mark_.size()) {
+        mark = latest_mark_[position.symbol];
+    }
+    if (mark <= 0) {
+        mark = position.entryPrice + position.unRealizedProfit / position.positionAmt;
+    }
+    if (mark <= 0) {
+        mark = position.entryPrice;
+    }
+
+    if (!exists) {
+        symbol_.push_back(position.symbol);
+        side_.push_back(position.positionSide);
+        quantity_.push_back(0.0);
+        entry_.push_back(0.0);
+        mark_.push_back(0.0);
+        leverage_.push_back(1.0);
+    }
+    quantity_[slot] = position.positionAmt;
+    entry_[slot] = position.entryPrice;
+    mark_[slot] = mark;
+    leverage_[slot] = std::max(1, position.leverage);
+    recompute();
+}
+
+void PositionStore::applyLeverage(SymbolId symbol, int leverage) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < symbol_.size(); i++) {
+        if (symbol_[i] == symbol) {
+            leverage_[i] = std::max(1, leverage);
+        }
+    }
+    recompute();
+}
+
+void PositionStore::applyMarks(const SymbolId* symbols, const double* marks, size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < count; i++) {
+        SymbolId symbol = symbols[i];
+        if (symbol == INVALID_SYMBOL_ID || marks[i] <= 0) continue;
+        if (symbol >= latest_mark_.size()) {
+            latest_mark_.resize(symbol + 1, 0.0);
+        }
+        latest_mark_[symbol] = marks[i];
+    }
+
+    // 포지션 수는 전체 심볼보다 훨씬 적으므로 포지션 쪽에서 최근 마크 가격을 모음
+    for (size_t i = 0; i < symbol_.size(); i++) {
+        if (symbol_[i] < latest_mark_.size() && latest_mark_[symbol_[i]] > 0) {
+            mark_[i] = latest_mark_[symbol_[i]];
+        }
+    }
+    recompute();
+    totals_.markUpdates++;
+}
+
+void PositionStore::recompute() {
+    size_t count = symbol_.size();
+    pnl_.resize(count);
+    percentage_.resize(count);
+    roe_.resize(count);
+    distance_.resize(count);
+
+    MarkColumns columns{quantity_.data(), entry_.data(), mark_.data(), leverage_.data(),
+                        pnl_.data(), percentage_.data(), roe_.data(), distance_.data(), count};
+    MarkSums sums = kernel().mark_to_market(columns);
+
+    totals_.unrealizedPnl = sums.pnl;
+    totals_.notional = sums.notional;
+    totals_.initialMargin = sums.margin;
+    totals_.roe = (sums.margin > 0) ? sums.pnl / sums.margin * 100.0 : 0.0;
+    totals_.minLiquidationDistance = (count > 0) ? sums.min_distance : 0.0;
+    totals_.positions = count;
+}
+
+FuturesPosition PositionStore::toFuturesPosition(size_t slot) const {
+    FuturesPosition position;
+    position.symbol = SymbolTable::instance().name(symbol_[slot]);
+    position.positionAmt = quantity_[slot];
+    position.entryPrice = entry_[slot];
+    position.markPrice = mark_[slot];
+    position.unRealizedProfit = pnl_[slot];
+    position.percentage = percentage_[slot];
+    position.roe = roe_[slot];
+    position.liquidationDistance = distance_[slot];
+    position.positionSide = toString(side_[slot]);
+    position.leverage = static_cast<int>(leverage_[slot]);
+    position.success = true;
+    return position;
+}
+
+std::vector<FuturesPosition> PositionStore::positions() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<FuturesPosition> positions;
+    positions.reserve(symbol_.size());
+    for (size_t i = 0; i < symbol_.size(); i++) {
+        positions.push_back(toFuturesPosition(i));
+    }
+    return positions;
+}
+
+bool PositionStore::find(SymbolId symbol, FuturesPosition& position) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < symbol_.size(); i++) {
+        if (symbol_[i] == symbol) {
+            position = toFuturesPosition(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<SymbolId> PositionStore::symbols() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return symbol_;
+}
+
+PositionTotals PositionStore::totals() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return totals_;
+}
@@ -0,0 +1,198 @@
+#include "request_scheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+static const long long WEIGHT_WINDOW_MS = 60000;
+static const long long ORDER_WINDOW_MS = 10000;
+
+RequestScheduler::RequestScheduler(long weight_limit_per_minute, long order_limit_per_10s)
+    : next_ticket_(0), weight_limit_(weight_limit_per_minute), used_weight_(0), weight_window_(0),
+      order_limit_(order_limit_per_10s), order_count_(0), order_window_(0), blocked_until_ms_(0),
+      waited_requests_(0), last_wait_ms_(0.0), total_wait_ms_(0.0), throttled_responses_(0) {
+}
+
+long long RequestScheduler::nowMs() {
+    // 바이낸스의 가중치 구간은 벽시계 기준 분/10초 단위로 초기화됨
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+}
+
+void RequestScheduler::rollWindows(long long now_ms) {
+    long long weight_window = now_ms / WEIGHT_WINDOW_MS;
+    if (weight_window != weight_window_) {
+        weight_window_ = weight_window;
+        used_weight_ = 0;
+    }
+
+    long long order_window = now_ms / ORDER_WINDOW_MS;
+    if (order_window != order_window_) {
+        order_window_ = order_window;
+        order_count_ = 0;
+    }
+}
+
+void RequestScheduler::acquire(int weight, RequestPriority priority, int orders) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    weight = std::min<long>(std::max(weight, 1), weight_limit_);
+    orders = std::min<long>(std::max(orders, 0), order_limit_);
+    std::pair<int, long> ticket(static_cast<int>(priority), next_ticket_++);
+    waiters_.insert(ticket);
+
+    auto wait_start = std::chrono::steady_clock::now();
+    bool waited = false;
+
+    while (true) {
+        long long now_ms = nowMs();
+        rollWindows(now_ms);
+
+        bool is_head = (*waiters_.begin() == ticket);
+        bool blocked = now_ms < blocked_until_ms_;
+        bool weight_ok = used_weight_ + weight <= weight_limit_;
+        bool order_ok = order_count_ + orders <= order_limit_;
+
+        if (is_head && !blocked && weight_ok && order_ok) {
+            break;
+        }
+
+        waited = true;
+        if (!is_head) {
+            // 앞선 요청이 처리될 때까지 대기
+            cv_.wait(lock);
+            continue;
+        }
+
+        // 차단 해제 또는 다음 구간 시작 시각까지 대기
+        long long wake_ms;
+        if (blocked) {
+            wake_ms = blocked_until_ms_;
+        } else if (!weight_ok) {
+            wake_ms = (weight_window_ + 1) * WEIGHT_WINDOW_MS;
+        } else {
+            wake_ms = (order_window_ + 1) * ORDER_WINDOW_MS;
+        }
+        cv_.wait_for(lock, std::chrono::milliseconds(std::max(1LL, wake_ms - now_ms)));
+    }
+
+    waiters_.erase(ticket);
+    used_weight_ += weight;
+    order_count_ += orders;
+
+    if (waited) {
+        double wait_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - wait_start).count();
+        waited_requests_++;
+        last_wait_ms_ = wait_ms;
+        total_wait_ms_ += wait_ms;
+    }
+
+    // 다음 대기자가 자신의 차례인지 확인하도록 깨움
+    cv_.notify_all();
+}
+
+void RequestScheduler::update(const HttpResponse& response) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    long long now_ms = nowMs();
+    rollWindows(now_ms);
+
+    // 서버가 집계한 값이 로컬 추정보다 크면 서버 값을 따름
+    auto weight_it = response.headers.find("x-mbx-used-weight-1m");
+    if (weight_it != response.headers.end()) {
+        long server_weight = std::atol(weight_it->second.c_str());
+        used_weight_ = std::max(used_weight_, server_weight);
+    }
+
+    auto order_it = response.headers.find("x-mbx-order-count-10s");
+    if (order_it != response.headers.end()) {
+        long server_orders = std::atol(order_it->second.c_str());
+        order_count_ = std::max(order_count_, server_orders);
+    }
+
+    // 429 (한도 초과) / 418 (IP 차단): Retry-After 동안 모든 요청 중지
+    if (response.statusCode == 429 || response.statusCode == 418) {
+        throttled_responses_++;
+
+        long long retry_after_sec = 60;
+        auto retry_it = response.headers.find("retry-after");
+        if (retry_it != response.headers.end()) {
+            retry_after_sec = std::max(1L, std::atol(retry_it->second.c_str()));
+        }
+        blocked_until_ms_ = std::max(blocked_until_ms_, now_ms + retry_after_sec * 1000);
+    }
+
+    cv_.notify_all();
+}
+
+RateLimitStats RequestScheduler::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    long long now_ms = nowMs();
+    bool weight_current = (now_ms / WEIGHT_WINDOW_MS) == weight_window_;
+    bool order_current = (now_ms / ORDER_WINDOW_MS) == order_window_;
+
+    RateLimitStats stats;
+    stats.weightLimit = weight_limit_;
+    stats.usedWeight = weight_current ? used_weight_ : 0;
+    stats.remainingWeight = std::max(0L, weight_limit_ - stats.usedWeight);
+    stats.orderLimit = order_limit_;
+    stats.orderCount = order_current ? order_count_ : 0;
+    stats.queueDepth = static_cast<long>(waiters_.size());
+    stats.waitedRequests = waited_requests_;
+    stats.lastWaitMs = last_wait_ms_;
+    stats.totalWaitMs = total_wait_ms_;
+    stats.throttledResponses = throttled_responses_;
+    stats.blockedUntilMs = (blocked_until_ms_ > now_ms) ? blocked_until_ms_ : 0;
+    return stats;
+}
+
+int RequestScheduler::endpointWeight(const std::string& endpoint, const std::map<std::string, std::string>& params) {
+    bool has_symbol = params.count("symbol") > 0;
+
+    // 현물 API
+    if (endpoint == "/api/v3/exchangeInfo") return 20;
+    if (endpoint == "/api/v3/account") return 20;
+    if (endpoint == "/api/v3/ticker/price") return has_symbol ? 2 : 4;   // symbols 목록 조회도 4
+    if (endpoint == "/api/v3/depth") {
+        auto it = params.find("limit");
+        int limit = (it != params.end()) ? std::atoi(it->second.c_str()) : 100;
+        if (limit <= 100) return 5;
+        if (limit <= 500) return 25;
+        if (limit <= 1000) return 50;
+        return 250;
+    }
+
+    // 선물 API
+    if (endpoint == "/fapi/v2/account") return 5;
+    if (endpoint == "/fapi/v2/positionRisk") return 5;
+    if (endpoint == "/fapi/v1/batchOrders") return 5;
+    if (endpoint == "/fapi/v1/ticker/price") return has_symbol ? 1 : 2;
+    if (endpoint == "/fapi/v1/depth") {
+        auto it = params.find("limit");
+        int limit = (it != params.end()) ? std::atoi(it->second.c_str()) : 500;
+        if (limit <= 50) return 2;
+        if (limit <= 100) return 5;
+        if (limit <= 500) return 10;
+        return 20;
+    }
+
+    return 1;
+}
+
+static bool isOrderEndpoint(const std::string& endpoint) {
+    return endpoint == "/api/v3/order" || endpoint == "/fapi/v1/order" || endpoint == "/fapi/v1/batchOrders";
+}
+
+RequestPriority RequestScheduler::priorityOf(const std::string& endpoint, const std::string& method, bool is_signed) {
+    // 취소도 주문보다 뒤로 밀리면 안 되므로 같은 우선순위
+    if (isOrderEndpoint(endpoint) && method != "GET") {
+        return RequestPriority::Order;
+    }
+    return is_signed ? RequestPriority::Account : RequestPriority::Market;
+}
+
+int RequestScheduler::orderCountOf(const std::string& endpoint, const std::string& method) {
+    // X-MBX-ORDER-COUNT는 신규 주문만 집계 (DELETE 취소는 가중치만 사용)
+    return (isOrderEndpoint(endpoint) && method == "POST") ? 1 : 0;
+}
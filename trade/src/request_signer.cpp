@@ -0,0 +1,90 @@
+// SHA256_Init/Update/Final은 OpenSSL 3에서 사용 중단 표시만 되어 있고 동작은 동일하다.
+// 해시 상태를 구조체 복사만으로 재사용하려면 EVP 대신 이 저수준 API가 필요하다
+#define OPENSSL_SUPPRESS_DEPRECATED
+#include "request_signer.h"
+#include <charconv>
+#include <cstring>
+
+static const size_t SHA256_BLOCK = 64;
+
+// 바이트 → 두 자리 소문자 hex 변환표
+struct HexTable {
+    char pairs[256][2];
+
+    HexTable() {
+        const char* digits = "0123456789abcdef";
+        for (int i = 0; i < 256; i++) {
+            pairs[i][0] = digits[i >> 4];
+            pairs[i][1] = digits[i & 0x0F];
+        }
+    }
+};
+
+static const HexTable HEX;
+
+RequestSigner::RequestSigner(const std::string& secret_key) {
+    unsigned char key[SHA256_BLOCK] = {};
+
+    // 블록보다 긴 키는 해시값을 키로 사용 (RFC 2104)
+    if (secret_key.size() > SHA256_BLOCK) {
+        SHA256(reinterpret_cast<const unsigned char*>(secret_key.data()), secret_key.size(), key);
+    } else {
+        std::memcpy(key, secret_key.data(), secret_key.size());
+    }
+
+    unsigned char pad[SHA256_BLOCK];
+    for (size_t i = 0; i < SHA256_BLOCK; i++) pad[i] = key[i] ^ 0x36;
+    SHA256_Init(&inner_);
+    SHA256_Update(&inner_, pad, SHA256_BLOCK);
+
+    for (size_t i = 0; i < SHA256_BLOCK; i++) pad[i] = key[i] ^ 0x5c;
+    SHA256_Init(&outer_);
+    SHA256_Update(&outer_, pad, SHA256_BLOCK);
+}
+
+void RequestSigner::sign(const char* data, size_t length, char* out) const {
+    unsigned char digest[SHA256_DIGEST_LENGTH];
+
+    SHA256_CTX ctx = inner_;
+    SHA256_Update(&ctx, data, length);
+    SHA256_Final(digest, &ctx);
+
+    ctx = outer_;
+    SHA256_Update(&ctx, digest, sizeof(digest));
+    SHA256_Final(digest, &ctx);
+
+    for (size_t i = 0; i < sizeof(digest); i++) {
+        std::memcpy(out + i * 2, HEX.pairs[digest[i]], 2);
+    }
+}
+
+std::string RequestSigner::sign(std::string_view data) const {
+    std::string signature(SIGNATURE_LENGTH, '\0');
+    sign(data.data(), data.size(), &signature[0]);
+    return signature;
+}
+
+// === QueryBuilder ===
+
+QueryBuilder::QueryBuilder(size_t capacity) {
+    query_.reserve(capacity);
+}
+
+void QueryBuilder::append(std::string_view key, std::string_view value) {
+    if (!query_.empty()) query_ += '&';
+    query_.append(key.data(), key.size());
+    query_ += '=';
+    query_.append(value.data(), value.size());
+}
+
+void QueryBuilder::append(std::string_view key, long long value) {
+    char buffer[24];
+    std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    append(key, std::string_view(buffer, result.ptr - buffer));
+}
+
+void QueryBuilder::appendSignature(const RequestSigner& signer) {
+    char signature[RequestSigner::SIGNATURE_LENGTH];
+    signer.sign(query_.data(), query_.size(), signature);
+    append("signature", std::string_view(signature, sizeof(signature)));
+}
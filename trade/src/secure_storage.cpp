@@ -264,7 +264,7 @@ void SecureStorage::secureMemoryClear(std::string& str) {
     }
 }
 
-std::string SecureStorage::getConfigFilePath() {
+std::string SecureStorage::getConfigDirectory() {
     std::string config_dir;
     
     // Docker 환경에서 데이터 경로 환경 변수 확인
@@ -297,6 +297,15 @@ std::string SecureStorage::getConfigFilePath() {
         std::filesystem::create_directories(config_dir);
     } catch (const std::exception& e) {
         std::cout << "설정 디렉토리 생성 실패: " << e.what() << std::endl;
+        return "";
+    }
+    
+    return config_dir;
+}
+
+std::string SecureStorage::getConfigFilePath() {
+    std::string config_dir = getConfigDirectory();
+    if (config_dir.empty()) {
         return "./binance_keys.enc";
     }
     
@@ -0,0 +1,166 @@
+#include "symbol_registry.h"
+#include "symbol_snapshot.h"
+#include <algorithm>
+
+SymbolRegistry::SymbolRegistry(Loader loader, std::chrono::seconds ttl, const std::string& snapshot_path)
+    : loader_(std::move(loader)), ttl_(ttl), snapshot_path_(snapshot_path), from_snapshot_(false),
+      stop_(false), refresh_requested_(false), refreshes_(0) {
+    // 저장된 목록으로 바로 시작하고 거래소 확인은 백그라운드에서 즉시 수행
+    if (loadSnapshot()) {
+        refresh_requested_ = true;
+        startWorker();
+    }
+}
+
+SymbolRegistry::~SymbolRegistry() {
+    {
+        std::lock_guard<std::mutex> lock(worker_mutex_);
+        stop_ = true;
+    }
+    worker_cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+std::shared_ptr<const SymbolRegistry::Table> SymbolRegistry::table() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return table_;
+}
+
+bool SymbolRegistry::find(const std::string& symbol, SymbolInfo& info) {
+    if (!ensureLoaded()) return false;
+
+    std::shared_ptr<const Table> current = table();
+    auto it = current->index.find(symbol);
+    if (it == current->index.end()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_ = "심볼 " + symbol + "을(를) 찾을 수 없습니다";
+        return false;
+    }
+    info = current->symbols[it->second];
+    return true;
+}
+
+std::shared_ptr<const std::vector<SymbolInfo>> SymbolRegistry::symbols() {
+    if (!ensureLoaded()) return nullptr;
+
+    // 목록은 스냅샷과 수명을 같이 하도록 별칭 포인터로 반환
+    std::shared_ptr<const Table> current = table();
+    return std::shared_ptr<const std::vector<SymbolInfo>>(current, &current->symbols);
+}
+
+void SymbolRegistry::invalidate() {
+    {
+        std::lock_guard<std::mutex> lock(worker_mutex_);
+        refresh_requested_ = true;
+    }
+    worker_cv_.notify_all();
+}
+
+bool SymbolRegistry::isLoaded() const {
+    return table() != nullptr;
+}
+
+std::string SymbolRegistry::lastError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return error_;
+}
+
+void SymbolRegistry::setTable(std::vector<SymbolInfo> symbols) {
+    auto next = std::make_shared<Table>();
+    next->symbols = std::move(symbols);
+    next->index.reserve(next->symbols.size());
+    for (size_t i = 0; i < next->symbols.size(); i++) {
+        next->index.emplace(next->symbols[i].symbol, i);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    table_ = std::move(next);
+    error_.clear();
+}
+
+bool SymbolRegistry::loadSnapshot() {
+    if (snapshot_path_.empty()) return false;
+
+    SymbolSnapshot snapshot;
+    std::string error;
+    if (!snapshot.open(snapshot_path_, error) || snapshot.size() == 0) {
+        return false;
+    }
+
+    std::vector<SymbolInfo> symbols;
+    symbols.reserve(snapshot.size());
+    for (size_t i = 0; i < snapshot.size(); i++) {
+        symbols.push_back(snapshot.at(i));
+    }
+    setTable(std::move(symbols));
+    from_snapshot_ = true;
+    return true;
+}
+
+bool SymbolRegistry::ensureLoaded() {
+    if (table()) return true;
+
+    // 여러 스레드가 동시에 첫 조회를 해도 요청은 한 번만 보냄
+    std::lock_guard<std::mutex> load_lock(load_mutex_);
+    if (table()) return true;
+    if (!reload()) return false;
+    startWorker();
+    return true;
+}
+
+bool SymbolRegistry::reload() {
+    std::vector<SymbolInfo> symbols;
+    std::string error;
+    if (!loader_(symbols, error)) {
+        // 기존 스냅샷은 유지하고 오류만 기록
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_ = error.empty() ? "심볼 정보를 불러오지 못했습니다" : error;
+        return false;
+    }
+
+    // 다음 시작 때 바로 쓸 수 있도록 저장 (실패해도 메모리 캐시는 그대로 사용)
+    if (!snapshot_path_.empty()) {
+        std::string save_error;
+        SymbolSnapshot::save(snapshot_path_, symbols, save_error);
+    }
+
+    setTable(std::move(symbols));
+    if (!error.empty()) {
+        // 일부 심볼을 제외하고 성공한 경우 (setTable이 지운 오류 대신 제외 이유를 남김)
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_ = error;
+    }
+    from_snapshot_ = false;
+    refreshes_++;
+    return true;
+}
+
+void SymbolRegistry::startWorker() {
+    std::lock_guard<std::mutex> lock(worker_mutex_);
+    if (!worker_.joinable() && !stop_) {
+        worker_ = std::thread(&SymbolRegistry::run, this);
+    }
+}
+
+void SymbolRegistry::run() {
+    std::chrono::seconds wait = ttl_;
+    std::unique_lock<std::mutex> lock(worker_mutex_);
+    while (!stop_) {
+        worker_cv_.wait_for(lock, wait, [this]() { return stop_ || refresh_requested_; });
+        if (stop_) break;
+        refresh_requested_ = false;
+
+        lock.unlock();
+        bool loaded;
+        {
+            std::lock_guard<std::mutex> load_lock(load_mutex_);
+            loaded = reload();
+        }
+        lock.lock();
+
+        // 실패하면 TTL보다 짧은 간격으로 재시도
+        wait = loaded ? ttl_ : std::min(ttl_, std::chrono::seconds(RETRY_INTERVAL_SECONDS));
+    }
+}
@@ -0,0 +1,211 @@
+#include "symbol_snapshot.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char SNAPSHOT_MAGIC[8] = {'B', 'T', 'S', 'Y', 'M', 'B', 'L', '\0'};
+
+static uint64_t fnv1a(const char* data, size_t length) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// 고정 길이 필드 → 문자열 (NUL 전까지)
+template <size_t N>
+static std::string readField(const char (&field)[N]) {
+    return std::string(field, strnlen(field, N));
+}
+
+// 문자열 → 고정 길이 필드 (NUL 종료 공간이 없으면 false)
+template <size_t N>
+static bool writeField(char (&field)[N], const std::string& value) {
+    if (value.size() >= N) return false;
+    std::memset(field, 0, N);
+    std::memcpy(field, value.data(), value.size());
+    return true;
+}
+
+SymbolSnapshot::SymbolSnapshot() : header_(nullptr), records_(nullptr), mapping_(nullptr), mapped_size_(0) {
+}
+
+SymbolSnapshot::~SymbolSnapshot() {
+    close();
+}
+
+void SymbolSnapshot::close() {
+#ifndef _WIN32
+    if (mapping_) {
+        munmap(mapping_, mapped_size_);
+    }
+#endif
+    mapping_ = nullptr;
+    mapped_size_ = 0;
+    buffer_.clear();
+    header_ = nullptr;
+    records_ = nullptr;
+}
+
+bool SymbolSnapshot::open(const std::string& path, std::string& error) {
+    close();
+
+    const char* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "심볼 캐시 파일 없음";
+        return false;
+    }
+    buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data = buffer_.data();
+    size = buffer_.size();
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "심볼 캐시 파일 없음";
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        error = "심볼 캐시 파일이 비어 있습니다";
+        return false;
+    }
+    size = static_cast<size_t>(st.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // 매핑은 파일 디스크립터를 닫아도 유지됨
+    if (mapping == MAP_FAILED) {
+        error = "심볼 캐시 파일 매핑 실패";
+        return false;
+    }
+    mapping_ = mapping;
+    mapped_size_ = size;
+    data = static_cast<const char*>(mapping);
+#endif
+
+    const auto* header = reinterpret_cast<const SymbolSnapshotHeader*>(data);
+    if (size < sizeof(SymbolSnapshotHeader) || std::memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+        error = "심볼 캐시 파일 형식이 아닙니다";
+    } else if (header->version != VERSION || header->recordSize != sizeof(SymbolRecord)) {
+        error = "심볼 캐시 파일 버전이 다릅니다";
+    } else if (size != sizeof(SymbolSnapshotHeader) + static_cast<size_t>(header->count) * sizeof(SymbolRecord)) {
+        error = "심볼 캐시 파일 크기가 맞지 않습니다";
+    } else if (fnv1a(data + sizeof(SymbolSnapshotHeader), size - sizeof(SymbolSnapshotHeader)) != header->checksum) {
+        error = "심볼 캐시 파일이 손상되었습니다";
+    } else {
+        header_ = header;
+        records_ = reinterpret_cast<const SymbolRecord*>(data + sizeof(SymbolSnapshotHeader));
+        return true;
+    }
+
+    close();
+    return false;
+}
+
+SymbolInfo SymbolSnapshot::at(size_t index) const {
+    const SymbolRecord& record = records_[index];
+    SymbolInfo info;
+    info.symbol = readField(record.symbol);
+    info.baseAsset = readField(record.baseAsset);
+    info.quoteAsset = readField(record.quoteAsset);
+    info.status = readField(record.status);
+    info.minQty = Decimal::fromRaw(record.minQty);
+    info.maxQty = Decimal::fromRaw(record.maxQty);
+    info.stepSize = Decimal::fromRaw(record.stepSize);
+    info.tickSize = Decimal::fromRaw(record.tickSize);
+    info.minNotional = Decimal::fromRaw(record.minNotional);
+    info.marketMinQty = Decimal::fromRaw(record.marketMinQty);
+    info.marketMaxQty = Decimal::fromRaw(record.marketMaxQty);
+    info.marketStepSize = Decimal::fromRaw(record.marketStepSize);
+    info.minPrice = Decimal::fromRaw(record.minPrice);
+    info.maxPrice = Decimal::fromRaw(record.maxPrice);
+    info.maxNotional = Decimal::fromRaw(record.maxNotional);
+    info.multiplierUp = Decimal::fromRaw(record.multiplierUp);
+    info.multiplierDown = Decimal::fromRaw(record.multiplierDown);
+    info.maxNumOrders = record.maxNumOrders;
+    info.pricePrecision = record.pricePrecision;
+    info.quantityPrecision = record.quantityPrecision;
+    return info;
+}
+
+bool SymbolSnapshot::save(const std::string& path, const std::vector<SymbolInfo>& symbols, std::string& error) {
+    std::vector<SymbolRecord> records;
+    records.reserve(symbols.size());
+    for (const auto& info : symbols) {
+        SymbolRecord record;
+        std::memset(&record, 0, sizeof(record));
+        if (!writeField(record.symbol, info.symbol) || !writeField(record.baseAsset, info.baseAsset) ||
+            !writeField(record.quoteAsset, info.quoteAsset) || !writeField(record.status, info.status)) {
+            continue;
+        }
+        record.minQty = info.minQty.raw();
+        record.maxQty = info.maxQty.raw();
+        record.stepSize = info.stepSize.raw();
+        record.tickSize = info.tickSize.raw();
+        record.minNotional = info.minNotional.raw();
+        record.marketMinQty = info.marketMinQty.raw();
+        record.marketMaxQty = info.marketMaxQty.raw();
+        record.marketStepSize = info.marketStepSize.raw();
+        record.minPrice = info.minPrice.raw();
+        record.maxPrice = info.maxPrice.raw();
+        record.maxNotional = info.maxNotional.raw();
+        record.multiplierUp = info.multiplierUp.raw();
+        record.multiplierDown = info.multiplierDown.raw();
+        record.maxNumOrders = info.maxNumOrders;
+        record.pricePrecision = info.pricePrecision;
+        record.quantityPrecision = info.quantityPrecision;
+        records.push_back(record);
+    }
+
+    const char* record_bytes = reinterpret_cast<const char*>(records.data());
+    size_t record_length = records.size() * sizeof(SymbolRecord);
+
+    SymbolSnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = VERSION;
+    header.recordSize = sizeof(SymbolRecord);
+    header.count = static_cast<uint32_t>(records.size());
+    header.savedAtMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    header.checksum = fnv1a(record_bytes, record_length);
+
+    std::string temp_path = path + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            error = "심볼 캐시 파일 생성 실패: " + temp_path;
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(record_bytes, static_cast<std::streamsize>(record_length));
+        if (!file) {
+            error = "심볼 캐시 파일 기록 실패: " + temp_path;
+            std::remove(temp_path.c_str());
+            return false;
+        }
+    }
+
+#ifdef _WIN32
+    std::remove(path.c_str());  // Windows의 rename은 기존 파일을 덮어쓰지 않음
+#endif
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        error = "심볼 캐시 파일 교체 실패: " + path;
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
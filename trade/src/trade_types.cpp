@@ -0,0 +1,131 @@
+#include "trade_types.h"
+#include <mutex>
+
+// ===== SymbolTable =====
+
+SymbolTable& SymbolTable::instance() {
+    static SymbolTable table;
+    return table;
+}
+
+SymbolId SymbolTable::intern(std::string_view name) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = ids_.find(name);
+        if (it != ids_.end()) return it->second;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    if (it != ids_.end()) return it->second;
+
+    SymbolId id = static_cast<SymbolId>(names_.size());
+    names_.emplace_back(name);
+    ids_.emplace(std::string_view(names_.back()), id);
+    return id;
+}
+
+SymbolId SymbolTable::find(std::string_view name) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    return (it != ids_.end()) ? it->second : INVALID_SYMBOL_ID;
+}
+
+const std::string& SymbolTable::name(SymbolId id) const {
+    static const std::string empty;
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return (id < names_.size()) ? names_[id] : empty;
+}
+
+size_t SymbolTable::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return names_.size();
+}
+
+// ===== 열거형 ↔ 문자열 =====
+
+namespace {
+
+template <typename E>
+struct EnumName {
+    E value;
+    const char* text;
+};
+
+const EnumName<OrderSide> ORDER_SIDE_NAMES[] = {
+    {OrderSide::Buy, "BUY"},
+    {OrderSide::Sell, "SELL"},
+};
+
+const EnumName<PositionSide> POSITION_SIDE_NAMES[] = {
+    {PositionSide::Both, "BOTH"},
+    {PositionSide::Long, "LONG"},
+    {PositionSide::Short, "SHORT"},
+};
+
+const EnumName<OrderType> ORDER_TYPE_NAMES[] = {
+    {OrderType::Market, "MARKET"},
+    {OrderType::Limit, "LIMIT"},
+    {OrderType::Stop, "STOP"},
+    {OrderType::StopMarket, "STOP_MARKET"},
+    {OrderType::TakeProfit, "TAKE_PROFIT"},
+    {OrderType::TakeProfitMarket, "TAKE_PROFIT_MARKET"},
+    {OrderType::TrailingStopMarket, "TRAILING_STOP_MARKET"},
+    {OrderType::LimitMaker, "LIMIT_MAKER"},
+    {OrderType::StopLoss, "STOP_LOSS"},
+    {OrderType::StopLossLimit, "STOP_LOSS_LIMIT"},
+    {OrderType::TakeProfitLimit, "TAKE_PROFIT_LIMIT"},
+};
+
+const EnumName<TimeInForce> TIME_IN_FORCE_NAMES[] = {
+    {TimeInForce::GTC, "GTC"},
+    {TimeInForce::IOC, "IOC"},
+    {TimeInForce::FOK, "FOK"},
+    {TimeInForce::GTX, "GTX"},
+    {TimeInForce::GTD, "GTD"},
+};
+
+const EnumName<OrderStatus> ORDER_STATUS_NAMES[] = {
+    {OrderStatus::New, "NEW"},
+    {OrderStatus::PartiallyFilled, "PARTIALLY_FILLED"},
+    {OrderStatus::Filled, "FILLED"},
+    {OrderStatus::Canceled, "CANCELED"},
+    {OrderStatus::PendingCancel, "PENDING_CANCEL"},
+    {OrderStatus::Rejected, "REJECTED"},
+    {OrderStatus::Expired, "EXPIRED"},
+    {OrderStatus::ExpiredInMatch, "EXPIRED_IN_MATCH"},
+    {OrderStatus::TestSuccess, "TEST_SUCCESS"},
+};
+
+template <typename E, size_t N>
+const char* nameOf(const EnumName<E> (&names)[N], E value) {
+    for (const auto& entry : names) {
+        if (entry.value == value) return entry.text;
+    }
+    return "";
+}
+
+template <typename E, size_t N>
+bool valueOf(const EnumName<E> (&names)[N], std::string_view text, E& value) {
+    for (const auto& entry : names) {
+        if (text == entry.text) {
+            value = entry.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+const char* toString(OrderSide value) { return nameOf(ORDER_SIDE_NAMES, value); }
+const char* toString(PositionSide value) { return nameOf(POSITION_SIDE_NAMES, value); }
+const char* toString(OrderType value) { return nameOf(ORDER_TYPE_NAMES, value); }
+const char* toString(TimeInForce value) { return nameOf(TIME_IN_FORCE_NAMES, value); }
+const char* toString(OrderStatus value) { return nameOf(ORDER_STATUS_NAMES, value); }
+
+bool fromString(std::string_view text, OrderSide& value) { return valueOf(ORDER_SIDE_NAMES, text, value); }
+bool fromString(std::string_view text, PositionSide& value) { return valueOf(POSITION_SIDE_NAMES, text, value); }
+bool fromString(std::string_view text, OrderType& value) { return valueOf(ORDER_TYPE_NAMES, text, value); }
+bool fromString(std::string_view text, TimeInForce& value) { return valueOf(TIME_IN_FORCE_NAMES, text, value); }
+bool fromString(std::string_view text, OrderStatus& value) { return valueOf(ORDER_STATUS_NAMES, text, value); }
@@ -0,0 +1,507 @@
+#include "user_data_stream.h"
+#include "json_parser.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+
+static int64_t parseOrderId(std::string_view text) {
+    int64_t value = 0;
+    std::from_chars(text.data(), text.data() + text.size(), value);
+    return value;
+}
+
+// 고정 길이 필드에 들어가지 않는 부분은 잘라냄
+static void copyClientOrderId(OrderRecord& order, std::string_view id) {
+    size_t length = std::min(id.size(), sizeof(order.clientOrderId) - 1);
+    std::memcpy(order.clientOrderId, id.data(), length);
+    order.clientOrderId[length] = '\0';
+}
+
+static PositionRecord toPositionRecord(const FuturesPosition& position) {
+    PositionRecord record{};
+    record.symbol = SymbolTable::instance().intern(position.symbol);
+    record.leverage = position.leverage;
+    fromString(position.positionSide, record.positionSide);
+    record.positionAmt = position.positionAmt;
+    record.entryPrice = position.entryPrice;
+    record.markPrice = position.markPrice;
+    record.unRealizedProfit = position.unRealizedProfit;
+    return record;
+}
+
+static FuturesOrderResponse toFuturesOrderResponse(const OrderRecord& record) {
+    FuturesOrderResponse order;
+    order.symbol = SymbolTable::instance().name(record.symbol);
+    order.orderId = std::to_string(record.orderId);
+    order.clientOrderId = record.clientOrderId;
+    order.status = toString(record.status);
+    order.price = record.price;
+    order.quantity = record.quantity;
+    order.side = toString(record.side);
+    order.positionSide = toString(record.positionSide);
+    order.type = toString(record.type);
+    order.timeInForce = toString(record.timeInForce);
+    order.reduceOnly = record.reduceOnly;
+    order.success = true;
+    return order;
+}
+
+static OrderResponse toOrderResponse(const OrderRecord& record) {
+    OrderResponse order;
+    order.symbol = SymbolTable::instance().name(record.symbol);
+    order.orderId = std::to_string(record.orderId);
+    order.status = toString(record.status);
+    order.price = record.price;
+    order.quantity = record.quantity;
+    order.side = toString(record.side);
+    order.success = true;
+    return order;
+}
+
+// === AccountStore::OrderLog ===
+
+void AccountStore::OrderLog::put(const OrderRecord& order) {
+    auto it = index.find(order.orderId);
+    if (it != index.end()) {
+        records[it->second] = order;
+        return;
+    }
+
+    size_t slot;
+    if (records.size() < MAX_TRACKED_ORDERS) {
+        slot = records.size();
+        records.push_back(order);
+    } else {
+        slot = next;
+        next = (next + 1) % MAX_TRACKED_ORDERS;
+        index.erase(records[slot].orderId);
+        records[slot] = order;
+    }
+    index[order.orderId] = slot;
+}
+
+const OrderRecord* AccountStore::OrderLog::find(int64_t orderId) const {
+    auto it = index.find(orderId);
+    return (it != index.end()) ? &records[it->second] : nullptr;
+}
+
+int AccountStore::OrderLog::countOpen(SymbolId symbol) const {
+    int count = 0;
+    for (const auto& order : records) {
+        if (order.symbol == symbol && (order.status == OrderStatus::New || order.status == OrderStatus::PartiallyFilled)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// === AccountStore ===
+
+AccountStore::AccountStore()
+    : spot_live_(false), futures_live_(false), events_(0), futures_wallet_(0.0), futures_cross_wallet_(0.0),
+      futures_cross_wallet_known_(false), positions_(std::make_shared<PositionStore>()) {
+    futures_account_ = FuturesAccountInfo();
+}
+
+int AccountStore::leverageOf(SymbolId symbol) const {
+    return (symbol < leverage_.size()) ? leverage_[symbol] : 0;
+}
+
+void AccountStore::loadSpotSnapshot(const AccountInfo& info) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    spot_free_["BTC"] = info.btcBalance;
+    spot_free_["USDT"] = info.usdtBalance;
+}
+
+void AccountStore::loadFuturesSnapshot(const FuturesAccountInfo& info, const std::vector<FuturesPosition>& positions) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    futures_account_ = info;
+    futures_wallet_ = info.totalWalletBalance;
+    // availableBalance 보정 기준은 이벤트와 같은 USDT crossWalletBalance (totalWalletBalance는 격리 증거금 포함)
+    futures_cross_wallet_ = info.usdtCrossWalletBalance;
+    futures_cross_wallet_known_ = info.hasUsdtCrossWallet;
+
+    std::vector<PositionRecord> records;
+    for (const auto& position : positions) {
+        PositionRecord record = toPositionRecord(position);
+        if (record.symbol >= leverage_.size()) {
+            leverage_.resize(record.symbol + 1, 0);
+        }
+        leverage_[record.symbol] = record.leverage;
+        if (record.positionAmt != 0) {
+            records.push_back(record);
+        }
+    }
+    positions_->load(records);
+}
+
+void AccountStore::applySpotBalance(const std::string& asset, double free_amount) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    spot_free_[asset] = free_amount;
+    events_++;
+}
+
+void AccountStore::applySpotOrder(const OrderRecord& order) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    spot_orders_.put(order);
+    events_++;
+}
+
+void AccountStore::applyFuturesBalance(const std::string& asset, double wallet_balance, double cross_wallet_balance) {
+    if (asset != "USDT") return;  // 계정 합계는 USDT 기준
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // 사용 가능 잔고는 이벤트에 없으므로 교차 지갑 잔고 변화량만큼 보정
+    // 스냅샷에 기준값이 없었으면 이번 이벤트를 기준으로 삼고 보정은 다음 이벤트부터
+    if (futures_cross_wallet_known_) {
+        double cross_delta = cross_wallet_balance - futures_cross_wallet_;
+        futures_account_.availableBalance += cross_delta;
+        futures_account_.maxWithdrawAmount = std::max(0.0, futures_account_.maxWithdrawAmount + cross_delta);
+    }
+
+    futures_wallet_ = wallet_balance;
+    futures_cross_wallet_ = cross_wallet_balance;
+    futures_cross_wallet_known_ = true;
+    futures_account_.totalWalletBalance = wallet_balance;
+    futures_account_.usdtCrossWalletBalance = cross_wallet_balance;
+    futures_account_.hasUsdtCrossWallet = true;
+    events_++;
+}
+
+void AccountStore::applyFuturesPosition(const PositionRecord& position) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PositionRecord updated = position;
+    updated.leverage = leverageOf(position.symbol);
+    positions_->apply(updated);
+    events_++;
+}
+
+void AccountStore::applyLeverage(SymbolId symbol, int leverage) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (symbol >= leverage_.size()) {
+        leverage_.resize(symbol + 1, 0);
+    }
+    leverage_[symbol] = leverage;
+    positions_->applyLeverage(symbol, leverage);
+    events_++;
+}
+
+void AccountStore::applyFuturesOrder(const OrderRecord& order) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    futures_orders_.put(order);
+    events_++;
+}
+
+void AccountStore::setLive(MarketType type, bool live) {
+    if (type == MarketType::Spot) {
+        spot_live_ = live;
+    } else {
+        futures_live_ = live;
+    }
+}
+
+bool AccountStore::isLive(MarketType type) const {
+    return type == MarketType::Spot ? spot_live_.load() : futures_live_.load();
+}
+
+AccountInfo AccountStore::getAccountInfo() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    AccountInfo info;
+    auto btc = spot_free_.find("BTC");
+    auto usdt = spot_free_.find("USDT");
+    info.btcBalance = (btc != spot_free_.end()) ? btc->second : 0.0;
+    info.usdtBalance = (usdt != spot_free_.end()) ? usdt->second : 0.0;
+    info.success = true;
+    return info;
+}
+
+FuturesAccountInfo AccountStore::getFuturesAccountInfo() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    FuturesAccountInfo info = futures_account_;
+
+    // 미실현 손익은 포지션 저장소의 최신 마크 가격 기준 합계
+    info.totalUnrealizedPnl = positions_->totals().unrealizedPnl;
+    info.totalMarginBalance = info.totalWalletBalance + info.totalUnrealizedPnl;
+    info.success = true;
+    info.error.clear();
+    return info;
+}
+
+std::vector<FuturesPosition> AccountStore::getFuturesPositions() const {
+    return positions_->positions();
+}
+
+FuturesPosition AccountStore::getFuturesPosition(const std::string& symbol) const {
+    SymbolId id = SymbolTable::instance().find(symbol);
+
+    FuturesPosition position;
+    if (positions_->find(id, position)) {
+        return position;
+    }
+
+    // 포지션 없음
+    std::lock_guard<std::mutex> lock(mutex_);
+    position.symbol = symbol;
+    position.positionAmt = 0.0;
+    position.entryPrice = 0.0;
+    position.markPrice = 0.0;
+    position.unRealizedProfit = 0.0;
+    position.percentage = 0.0;
+    position.positionSide = "BOTH";
+    position.leverage = leverageOf(id);
+    position.success = true;
+    return position;
+}
+
+bool AccountStore::getFuturesOrder(const std::string& orderId, FuturesOrderResponse& order) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const OrderRecord* record = futures_orders_.find(parseOrderId(orderId));
+    if (!record) return false;
+    order = toFuturesOrderResponse(*record);
+    return true;
+}
+
+bool AccountStore::getSpotOrder(const std::string& orderId, OrderResponse& order) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const OrderRecord* record = spot_orders_.find(parseOrderId(orderId));
+    if (!record) return false;
+    order = toOrderResponse(*record);
+    return true;
+}
+
+int AccountStore::openOrderCount(MarketType type, SymbolId symbol) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (type == MarketType::Spot ? spot_orders_ : futures_orders_).countOpen(symbol);
+}
+
+long AccountStore::eventCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_;
+}
+
+// === UserDataStream ===
+
+UserDataStream::UserDataStream(MarketType type, const BinanceAPI& rest, const std::string& ws_base_url,
+                               std::shared_ptr<AccountStore> store)
+    : type_(type), rest_(rest), ws_base_url_(ws_base_url), store_(store), running_(false), reconnects_(0) {
+    if (!ws_base_url_.empty() && ws_base_url_.back() == '/') {
+        ws_base_url_.pop_back();
+    }
+}
+
+UserDataStream::~UserDataStream() {
+    stop();
+}
+
+void UserDataStream::start() {
+    if (running_.exchange(true)) return;
+    worker_ = std::thread(&UserDataStream::run, this);
+}
+
+void UserDataStream::stop() {
+    running_ = false;
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    store_->setLive(type_, false);
+}
+
+bool UserDataStream::isLive() const {
+    return store_->isLive(type_);
+}
+
+void UserDataStream::setError(const std::string& error) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    error_ = error;
+}
+
+std::string UserDataStream::lastError() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return error_;
+}
+
+void UserDataStream::waitBackoff(int& backoff_ms) {
+    // stop 요청에 빠르게 반응하도록 잘게 나누어 대기
+    for (int waited = 0; waited < backoff_ms && running_; waited += 100) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    backoff_ms = std::min(backoff_ms * 2, 30000);
+}
+
+bool UserDataStream::loadSnapshot() {
+    if (type_ == MarketType::Spot) {
+        AccountInfo info = rest_.getAccountInfo();
+        if (!info.success) {
+            setError("현물 계정 스냅샷 조회 실패: " + info.error);
+            return false;
+        }
+        store_->loadSpotSnapshot(info);
+        return true;
+    }
+
+    // 계정과 포지션 스냅샷을 동시에 요청
+    BinanceAPI positions_api = rest_;
+    std::future<std::vector<FuturesPosition>> pending_positions = std::async(std::launch::async, [positions_api]() mutable {
+        return positions_api.getFuturesPositions(true);
+    });
+    FuturesAccountInfo info = rest_.getFuturesAccountInfo();
+    std::vector<FuturesPosition> positions = pending_positions.get();
+
+    if (!info.success) {
+        setError("선물 계정 스냅샷 조회 실패: " + info.error);
+        return false;
+    }
+    if (!positions.empty() && !positions.front().success) {
+        setError("선물 포지션 스냅샷 조회 실패: " + positions.front().error);
+        return false;
+    }
+    store_->loadFuturesSnapshot(info, positions);
+    return true;
+}
+
+void UserDataStream::run() {
+    int backoff_ms = 1000;
+    bool connected_once = false;
+
+    while (running_) {
+        std::string listen_key = rest_.createListenKey(type_);
+        if (listen_key.empty()) {
+            setError("listenKey 발급 실패");
+            waitBackoff(backoff_ms);
+            continue;
+        }
+
+        // 스냅샷보다 먼저 연결해야 그 사이의 이벤트를 놓치지 않음
+        if (!client_.connect(ws_base_url_ + "/ws/" + listen_key, 10000)) {
+            setError("사용자 데이터 스트림 연결 실패: " + client_.lastError());
+            rest_.closeListenKey(type_, listen_key);
+            waitBackoff(backoff_ms);
+            continue;
+        }
+
+        if (!loadSnapshot()) {
+            client_.close();
+            rest_.closeListenKey(type_, listen_key);
+            waitBackoff(backoff_ms);
+            continue;
+        }
+
+        if (connected_once) {
+            reconnects_++;
+        }
+        connected_once = true;
+        backoff_ms = 1000;
+        store_->setLive(type_, true);
+
+        auto last_keepalive = std::chrono::steady_clock::now();
+        std::string message;
+        while (running_) {
+            WebSocketClient::ReadResult result = client_.readMessage(message, 200);
+            if (result == WebSocketClient::ReadResult::Closed) {
+                setError("사용자 데이터 스트림 연결 끊김: " + client_.lastError());
+                break;
+            }
+            if (result == WebSocketClient::ReadResult::Message && !handleMessage(message)) {
+                setError("listenKey 만료");
+                break;
+            }
+
+            // listenKey 유효 기간(60분) 연장
+            auto now = std::chrono::steady_clock::now();
+            if (std::chrono::duration_cast<std::chrono::milliseconds>(now - last_keepalive).count() >= KEEPALIVE_INTERVAL_MS) {
+                last_keepalive = now;
+                if (!rest_.keepAliveListenKey(type_, listen_key)) {
+                    setError("listenKey 연장 실패");
+                    break;
+                }
+            }
+        }
+
+        // 끊긴 동안에는 REST로 조회하도록 전환하고, 재연결 시 스냅샷부터 다시 받음
+        store_->setLive(type_, false);
+        client_.close();
+        rest_.closeListenKey(type_, listen_key);
+    }
+}
+
+bool UserDataStream::handleMessage(const std::string& message) {
+    if (!doc_.parse(message)) {
+        return true;
+    }
+    JSONValue event = doc_.root();
+    std::string_view type = event["e"].raw();
+    if (type == "listenKeyExpired") {
+        return false;
+    }
+    return type_ == MarketType::Spot ? handleSpotEvent(type, event) : handleFuturesEvent(type, event);
+}
+
+bool UserDataStream::handleSpotEvent(std::string_view type, JSONValue event) {
+    if (type == "outboundAccountPosition") {
+        // {"e":"outboundAccountPosition","B":[{"a":"BTC","f":"0.1","l":"0"}]}
+        for (JSONValue balance : event["B"]) {
+            store_->applySpotBalance(balance["a"].asString(), balance["f"].asDouble());
+        }
+    } else if (type == "executionReport") {
+        OrderRecord order{};
+        order.orderId = parseOrderId(event["i"].raw());
+        order.symbol = SymbolTable::instance().intern(event["s"].raw());
+        fromString(event["S"].raw(), order.side);
+        fromString(event["o"].raw(), order.type);
+        fromString(event["f"].raw(), order.timeInForce);
+        fromString(event["X"].raw(), order.status);
+        order.quantity = event["z"].asDouble();
+        double quote = event["Z"].asDouble();
+        order.price = order.quantity > 0 ? quote / order.quantity : event["p"].asDouble();
+        copyClientOrderId(order, event["c"].raw());
+        store_->applySpotOrder(order);
+    }
+    return true;
+}
+
+bool UserDataStream::handleFuturesEvent(std::string_view type, JSONValue event) {
+    if (type == "ACCOUNT_UPDATE") {
+        // {"e":"ACCOUNT_UPDATE","a":{"B":[{"a":"USDT","wb":"..","cw":".."}],"P":[{"s":"BTCUSDT","pa":"..",..}]}}
+        JSONValue update = event["a"];
+
+        for (JSONValue balance : update["B"]) {
+            store_->applyFuturesBalance(balance["a"].asString(), balance["wb"].asDouble(), balance["cw"].asDouble());
+        }
+
+        for (JSONValue data : update["P"]) {
+            PositionRecord position{};
+            position.symbol = SymbolTable::instance().intern(data["s"].raw());
+            fromString(data["ps"].raw(), position.positionSide);
+            position.positionAmt = data["pa"].asDouble();
+            position.entryPrice = data["ep"].asDouble();
+            position.unRealizedProfit = data["up"].asDouble();
+            store_->applyFuturesPosition(position);
+        }
+    } else if (type == "ORDER_TRADE_UPDATE") {
+        JSONValue data = event["o"];
+
+        OrderRecord order{};
+        order.orderId = parseOrderId(data["i"].raw());
+        order.symbol = SymbolTable::instance().intern(data["s"].raw());
+        fromString(data["S"].raw(), order.side);
+        fromString(data["ps"].raw(), order.positionSide);
+        fromString(data["o"].raw(), order.type);
+        fromString(data["f"].raw(), order.timeInForce);
+        fromString(data["X"].raw(), order.status);
+        order.reduceOnly = data["R"].asBool();
+        order.quantity = data["z"].asDouble();
+        double average = data["ap"].asDouble();
+        order.price = average > 0 ? average : data["p"].asDouble();
+        copyClientOrderId(order, data["c"].raw());
+        store_->applyFuturesOrder(order);
+    } else if (type == "ACCOUNT_CONFIG_UPDATE") {
+        // {"e":"ACCOUNT_CONFIG_UPDATE","ac":{"s":"BTCUSDT","l":25}}
+        JSONValue config = event["ac"];
+        if (config.isObject()) {
+            store_->applyLeverage(SymbolTable::instance().intern(config["s"].raw()), static_cast<int>(config["l"].asInt()));
+        }
+    }
+    return true;
+}
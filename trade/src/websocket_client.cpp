@@ -0,0 +1,594 @@
+#include "websocket_client.h"
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/sha.h>
+#include <openssl/x509v3.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+#include <ws2tcpip.h>
+#define poll WSAPoll
+static const socket_handle_t INVALID_SOCKET_HANDLE = INVALID_SOCKET;
+static const int SHUTDOWN_BOTH = SD_BOTH;
+#else
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+static const socket_handle_t INVALID_SOCKET_HANDLE = -1;
+static const int SHUTDOWN_BOTH = SHUT_RDWR;
+#endif
+
+static const char* WEBSOCKET_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+static const size_t MAX_MESSAGE_SIZE = 64 * 1024 * 1024;
+
+static std::string base64Encode(const unsigned char* data, size_t length) {
+    std::string encoded(4 * ((length + 2) / 3), '\0');
+    int written = EVP_EncodeBlock(reinterpret_cast<unsigned char*>(&encoded[0]), data, static_cast<int>(length));
+    encoded.resize(written);
+    return encoded;
+}
+
+static bool setNonBlocking(socket_handle_t sock) {
+#ifdef _WIN32
+    u_long mode = 1;
+    return ioctlsocket(sock, FIONBIO, &mode) == 0;
+#else
+    int flags = fcntl(sock, F_GETFL, 0);
+    return flags >= 0 && fcntl(sock, F_SETFL, flags | O_NONBLOCK) == 0;
+#endif
+}
+
+static int socketError() {
+#ifdef _WIN32
+    return WSAGetLastError();
+#else
+    return errno;
+#endif
+}
+
+static void closeHandle(socket_handle_t sock) {
+#ifdef _WIN32
+    closesocket(sock);
+#else
+    ::close(sock);
+#endif
+}
+
+static bool isWouldBlock(int error) {
+#ifdef _WIN32
+    return error == WSAEWOULDBLOCK || error == WSAEINPROGRESS;
+#else
+    return error == EWOULDBLOCK || error == EAGAIN || error == EINPROGRESS;
+#endif
+}
+
+WebSocketClient::WebSocketClient()
+    : socket_(INVALID_SOCKET_HANDLE), ssl_ctx_(nullptr), ssl_(nullptr), connected_(false), mask_state_(0) {
+#ifdef _WIN32
+    WSADATA wsa_data;
+    WSAStartup(MAKEWORD(2, 2), &wsa_data);
+#endif
+    RAND_bytes(reinterpret_cast<unsigned char*>(&mask_state_), sizeof(mask_state_));
+    if (mask_state_ == 0) {
+        mask_state_ = 0x9E3779B9u;
+    }
+}
+
+WebSocketClient::~WebSocketClient() {
+    close();
+    if (ssl_ctx_) {
+        SSL_CTX_free(ssl_ctx_);
+    }
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+void WebSocketClient::setError(const std::string& error) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    error_ = error;
+}
+
+std::string WebSocketClient::lastError() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return error_;
+}
+
+bool WebSocketClient::isConnected() const {
+    return connected_;
+}
+
+bool WebSocketClient::connect(const std::string& url, int timeout_ms) {
+    close();
+    buffer_.clear();
+    fragments_.clear();
+
+    // URL 파싱: ws[s]://host[:port][/path]
+    bool secure;
+    size_t host_start;
+    if (url.compare(0, 6, "wss://") == 0) {
+        secure = true;
+        host_start = 6;
+    } else if (url.compare(0, 5, "ws://") == 0) {
+        secure = false;
+        host_start = 5;
+    } else {
+        setError("지원하지 않는 WebSocket URL: " + url);
+        return false;
+    }
+
+    size_t path_start = url.find('/', host_start);
+    std::string host_port = url.substr(host_start, path_start == std::string::npos ? std::string::npos : path_start - host_start);
+    std::string path = (path_start == std::string::npos) ? "/" : url.substr(path_start);
+
+    std::string host = host_port;
+    int port = secure ? 443 : 80;
+    size_t colon = host_port.rfind(':');
+    if (colon != std::string::npos) {
+        host = host_port.substr(0, colon);
+        port = std::atoi(host_port.c_str() + colon + 1);
+    }
+
+    if (!openSocket(host, port, timeout_ms)) {
+        closeSocket();
+        return false;
+    }
+
+    if (secure && !startTls(host)) {
+        closeSocket();
+        return false;
+    }
+
+    if (!handshake(host, port, path, timeout_ms)) {
+        closeSocket();
+        return false;
+    }
+
+    connected_ = true;
+    return true;
+}
+
+bool WebSocketClient::openSocket(const std::string& host, int port, int timeout_ms) {
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* result = nullptr;
+    std::string port_str = std::to_string(port);
+    if (getaddrinfo(host.c_str(), port_str.c_str(), &hints, &result) != 0 || !result) {
+        setError("DNS 해석 실패: " + host);
+        return false;
+    }
+
+    // 연결이 끝난 소켓만 잠금 아래에서 socket_에 게시 (그 전에는 close()가 건드리지 않음)
+    for (addrinfo* addr = result; addr; addr = addr->ai_next) {
+        socket_handle_t sock = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+        if (sock == INVALID_SOCKET_HANDLE) continue;
+
+        setNonBlocking(sock);
+        int rc = ::connect(sock, addr->ai_addr, static_cast<int>(addr->ai_addrlen));
+        if (rc != 0 && isWouldBlock(socketError())) {
+            // 비동기 연결 완료 대기
+            pollfd pfd;
+            pfd.fd = sock;
+            pfd.events = POLLOUT;
+            pfd.revents = 0;
+            if (poll(&pfd, 1, timeout_ms) == 1) {
+                int so_error = 0;
+                socklen_t len = sizeof(so_error);
+                getsockopt(sock, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&so_error), &len);
+                rc = (so_error == 0) ? 0 : -1;
+            } else {
+                rc = -1;
+            }
+        }
+
+        if (rc == 0) {
+            int flag = 1;
+            setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&flag), sizeof(flag));
+            freeaddrinfo(result);
+            std::lock_guard<std::mutex> lock(io_mutex_);
+            socket_ = sock;
+            return true;
+        }
+
+        closeHandle(sock);
+    }
+
+    freeaddrinfo(result);
+    setError("연결 실패: " + host + ":" + port_str);
+    return false;
+}
+
+bool WebSocketClient::startTls(const std::string& host) {
+    if (!ssl_ctx_) {
+        ssl_ctx_ = SSL_CTX_new(TLS_client_method());
+        if (!ssl_ctx_) {
+            setError("SSL 컨텍스트 생성 실패");
+            return false;
+        }
+        SSL_CTX_set_default_verify_paths(ssl_ctx_);
+        SSL_CTX_set_verify(ssl_ctx_, SSL_VERIFY_PEER, nullptr);
+    }
+
+    socket_handle_t sock;
+    {
+        std::lock_guard<std::mutex> lock(io_mutex_);
+        sock = socket_;
+    }
+    if (sock == INVALID_SOCKET_HANDLE) {
+        setError("SSL 연결 전에 소켓이 닫혔습니다");
+        return false;
+    }
+
+    // 핸드셰이크는 지역 SSL 객체로 진행하고 끝난 뒤에 ssl_로 게시
+    // (도중에 다른 스레드가 close()하면 소켓 오류로 실패하고 여기서 해제)
+    SSL* ssl = SSL_new(ssl_ctx_);
+    SSL_set_fd(ssl, static_cast<int>(sock));
+    SSL_set_tlsext_host_name(ssl, host.c_str());
+    SSL_set1_host(ssl, host.c_str());
+
+    // 논블로킹 소켓이므로 핸드셰이크가 끝날 때까지 반복
+    while (true) {
+        int rc = SSL_connect(ssl);
+        if (rc == 1) break;
+
+        int err = SSL_get_error(ssl, rc);
+        pollfd pfd;
+        pfd.fd = sock;
+        pfd.revents = 0;
+        if (err == SSL_ERROR_WANT_READ) {
+            pfd.events = POLLIN;
+        } else if (err == SSL_ERROR_WANT_WRITE) {
+            pfd.events = POLLOUT;
+        } else {
+            SSL_free(ssl);
+            setError("SSL 연결 실패");
+            return false;
+        }
+        if (poll(&pfd, 1, 10000) != 1) {
+            SSL_free(ssl);
+            setError("SSL 연결 타임아웃");
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(io_mutex_);
+    if (socket_ != sock) {
+        SSL_free(ssl);
+        setError("SSL 연결 중 소켓이 닫혔습니다");
+        return false;
+    }
+    ssl_ = ssl;
+    return true;
+}
+
+bool WebSocketClient::handshake(const std::string& host, int port, const std::string& path, int timeout_ms) {
+    unsigned char key_bytes[16];
+    RAND_bytes(key_bytes, sizeof(key_bytes));
+    std::string key = base64Encode(key_bytes, sizeof(key_bytes));
+
+    std::string request = "GET " + path + " HTTP/1.1\r\n"
+                          "Host: " + host + ":" + std::to_string(port) + "\r\n"
+                          "Upgrade: websocket\r\n"
+                          "Connection: Upgrade\r\n"
+                          "Sec-WebSocket-Key: " + key + "\r\n"
+                          "Sec-WebSocket-Version: 13\r\n"
+                          "User-Agent: Binance-Trader/1.0\r\n\r\n";
+    bool sent;
+    {
+        std::lock_guard<std::mutex> lock(io_mutex_);
+        sent = writeRaw(request.data(), request.length());
+    }
+    if (!sent) {
+        setError("핸드셰이크 요청 전송 실패");
+        return false;
+    }
+
+    // 응답 헤더 끝까지 수신
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    size_t header_end;
+    while ((header_end = buffer_.find("\r\n\r\n")) == std::string::npos) {
+        int remaining = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count());
+        if (remaining <= 0) {
+            setError("핸드셰이크 응답 타임아웃");
+            return false;
+        }
+        char chunk[4096];
+        int n = readRaw(chunk, sizeof(chunk), remaining);
+        if (n < 0) {
+            setError("핸드셰이크 응답 수신 실패");
+            return false;
+        }
+        buffer_.append(chunk, n);
+    }
+
+    std::string headers = buffer_.substr(0, header_end);
+    buffer_.erase(0, header_end + 4);
+
+    if (headers.compare(0, 12, "HTTP/1.1 101") != 0) {
+        setError("핸드셰이크 거부: " + headers.substr(0, headers.find("\r\n")));
+        return false;
+    }
+
+    // Sec-WebSocket-Accept 검증
+    std::string accept_source = key + WEBSOCKET_GUID;
+    unsigned char digest[SHA_DIGEST_LENGTH];
+    SHA1(reinterpret_cast<const unsigned char*>(accept_source.data()), accept_source.length(), digest);
+    std::string expected = base64Encode(digest, sizeof(digest));
+
+    std::string lower_headers = headers;
+    for (char& c : lower_headers) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    size_t accept_pos = lower_headers.find("sec-websocket-accept:");
+    if (accept_pos == std::string::npos ||
+        headers.find(expected, accept_pos) == std::string::npos) {
+        setError("Sec-WebSocket-Accept 검증 실패");
+        return false;
+    }
+
+    return true;
+}
+
+bool WebSocketClient::waitReadable(int timeout_ms) {
+    // 소켓/SSL 상태는 잠금 아래에서만 읽고, poll은 잠금 없이 (송신을 막지 않도록)
+    // 다른 스레드가 닫았으면 바로 반환해 readRaw가 잠금 아래에서 종료를 확인하게 함
+    socket_handle_t sock;
+    {
+        std::lock_guard<std::mutex> lock(io_mutex_);
+        if (socket_ == INVALID_SOCKET_HANDLE) return true;
+        if (ssl_ && SSL_pending(ssl_) > 0) return true;
+        sock = socket_;
+    }
+    pollfd pfd;
+    pfd.fd = sock;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    return poll(&pfd, 1, timeout_ms) == 1;
+}
+
+int WebSocketClient::readRaw(char* buffer, size_t length, int timeout_ms) {
+    // 반환값: 읽은 바이트 수, 0은 타임아웃, -1은 연결 종료/오류
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+    while (true) {
+        int remaining = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count());
+        if (!waitReadable(std::max(0, remaining))) {
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> lock(io_mutex_);
+        if (socket_ == INVALID_SOCKET_HANDLE) return -1;
+
+        if (ssl_) {
+            int n = SSL_read(ssl_, buffer, static_cast<int>(length));
+            if (n > 0) return n;
+            int err = SSL_get_error(ssl_, n);
+            if (err == SSL_ERROR_WANT_READ || err == SSL_ERROR_WANT_WRITE) continue;
+            return -1;
+        }
+
+        int n = static_cast<int>(recv(socket_, buffer, static_cast<int>(length), 0));
+        if (n > 0) return n;
+        if (n < 0 && isWouldBlock(socketError())) continue;
+        return -1;
+    }
+}
+
+bool WebSocketClient::writeRaw(const char* data, size_t length) {
+    // io_mutex_를 보유한 상태에서 호출
+    size_t sent = 0;
+    while (sent < length) {
+        if (socket_ == INVALID_SOCKET_HANDLE) return false;
+
+        int n;
+        bool want_read = false;
+        if (ssl_) {
+            n = SSL_write(ssl_, data + sent, static_cast<int>(length - sent));
+            if (n <= 0) {
+                int err = SSL_get_error(ssl_, n);
+                if (err != SSL_ERROR_WANT_READ && err != SSL_ERROR_WANT_WRITE) return false;
+                want_read = (err == SSL_ERROR_WANT_READ);
+                n = 0;
+            }
+        } else {
+            n = static_cast<int>(send(socket_, data + sent, static_cast<int>(length - sent), 0));
+            if (n < 0) {
+                if (!isWouldBlock(socketError())) return false;
+                n = 0;
+            }
+        }
+
+        if (n == 0) {
+            pollfd pfd;
+            pfd.fd = socket_;
+            pfd.events = want_read ? POLLIN : POLLOUT;
+            pfd.revents = 0;
+            if (poll(&pfd, 1, 10000) != 1) return false;
+        }
+        sent += n;
+    }
+    return true;
+}
+
+bool WebSocketClient::sendFrame(int opcode, const char* data, size_t length) {
+    std::lock_guard<std::mutex> lock(io_mutex_);
+
+    std::string frame;
+    frame.reserve(length + 14);
+    frame += static_cast<char>(0x80 | opcode);  // FIN + opcode
+
+    // 클라이언트 프레임은 반드시 마스킹
+    if (length < 126) {
+        frame += static_cast<char>(0x80 | length);
+    } else if (length <= 0xFFFF) {
+        frame += static_cast<char>(0x80 | 126);
+        frame += static_cast<char>((length >> 8) & 0xFF);
+        frame += static_cast<char>(length & 0xFF);
+    } else {
+        frame += static_cast<char>(0x80 | 127);
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            frame += static_cast<char>((static_cast<uint64_t>(length) >> shift) & 0xFF);
+        }
+    }
+
+    // xorshift로 마스킹 키 생성
+    mask_state_ ^= mask_state_ << 13;
+    mask_state_ ^= mask_state_ >> 17;
+    mask_state_ ^= mask_state_ << 5;
+    char mask[4];
+    std::memcpy(mask, &mask_state_, 4);
+    frame.append(mask, 4);
+
+    size_t payload_start = frame.length();
+    frame.append(data, length);
+    for (size_t i = 0; i < length; i++) {
+        frame[payload_start + i] ^= mask[i & 3];
+    }
+
+    return writeRaw(frame.data(), frame.length());
+}
+
+bool WebSocketClient::sendText(const std::string& message) {
+    if (!connected_) return false;
+    return sendFrame(OP_TEXT, message.data(), message.length());
+}
+
+WebSocketClient::ReadResult WebSocketClient::readMessage(std::string& message, int timeout_ms) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+    while (connected_) {
+        // 버퍼에 완전한 프레임이 있는지 확인
+        if (buffer_.length() >= 2) {
+            const unsigned char* header = reinterpret_cast<const unsigned char*>(buffer_.data());
+            bool fin = (header[0] & 0x80) != 0;
+            int opcode = header[0] & 0x0F;
+            bool masked = (header[1] & 0x80) != 0;
+            uint64_t payload_length = header[1] & 0x7F;
+            size_t header_length = 2;
+
+            if (payload_length == 126) {
+                header_length = 4;
+                if (buffer_.length() >= header_length) {
+                    payload_length = (static_cast<uint64_t>(header[2]) << 8) | header[3];
+                }
+            } else if (payload_length == 127) {
+                header_length = 10;
+                if (buffer_.length() >= header_length) {
+                    payload_length = 0;
+                    for (int i = 2; i < 10; i++) {
+                        payload_length = (payload_length << 8) | header[i];
+                    }
+                }
+            }
+            if (masked) header_length += 4;
+
+            if (payload_length > MAX_MESSAGE_SIZE) {
+                setError("수신 프레임이 너무 큽니다");
+                close();
+                return ReadResult::Closed;
+            }
+
+            if (buffer_.length() >= header_length + payload_length) {
+                std::string payload = buffer_.substr(header_length, static_cast<size_t>(payload_length));
+                if (masked) {
+                    const char* mask = buffer_.data() + header_length - 4;
+                    for (size_t i = 0; i < payload.length(); i++) {
+                        payload[i] ^= mask[i & 3];
+                    }
+                }
+                buffer_.erase(0, header_length + static_cast<size_t>(payload_length));
+
+                switch (opcode) {
+                    case OP_PING:
+                        sendFrame(OP_PONG, payload.data(), payload.length());
+                        continue;
+                    case OP_PONG:
+                        continue;
+                    case OP_CLOSE:
+                        setError("서버가 연결을 종료했습니다");
+                        connected_ = false;
+                        sendFrame(OP_CLOSE, payload.data(), std::min<size_t>(payload.length(), 2));
+                        close();
+                        return ReadResult::Closed;
+                    case OP_CONTINUATION:
+                    case OP_TEXT:
+                    case OP_BINARY:
+                        fragments_ += payload;
+                        if (fin) {
+                            message.swap(fragments_);
+                            fragments_.clear();
+                            return ReadResult::Message;
+                        }
+                        continue;
+                    default:
+                        continue;
+                }
+            }
+        }
+
+        int remaining = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count());
+        if (remaining <= 0) {
+            return ReadResult::Timeout;
+        }
+
+        char chunk[16384];
+        int n = readRaw(chunk, sizeof(chunk), remaining);
+        if (n == 0) {
+            return ReadResult::Timeout;
+        }
+        if (n < 0) {
+            setError("연결이 끊어졌습니다");
+            close();
+            return ReadResult::Closed;
+        }
+        buffer_.append(chunk, n);
+    }
+
+    return ReadResult::Closed;
+}
+
+void WebSocketClient::closeSocket() {
+    std::lock_guard<std::mutex> lock(io_mutex_);
+    if (socket_ != INVALID_SOCKET_HANDLE) {
+        // poll 중인 수신 스레드를 먼저 깨움 (close만으로는 poll이 깨어나지 않음)
+        shutdown(socket_, SHUTDOWN_BOTH);
+    }
+    if (ssl_) {
+        SSL_free(ssl_);
+        ssl_ = nullptr;
+    }
+    if (socket_ != INVALID_SOCKET_HANDLE) {
+        closeHandle(socket_);
+        socket_ = INVALID_SOCKET_HANDLE;
+    }
+}
+
+void WebSocketClient::close() {
+    if (connected_.exchange(false)) {
+        // 정상 종료 프레임 (상태 코드 1000)
+        const char status[2] = {0x03, static_cast<char>(0xE8)};
+        sendFrame(OP_CLOSE, status, sizeof(status));
+        std::lock_guard<std::mutex> lock(io_mutex_);
+        if (ssl_) {
+            SSL_shutdown(ssl_);
+        }
+    }
+    // buffer_/fragments_는 수신 스레드 전용이므로 여기서 비우지 않음 (connect에서 초기화)
+    closeSocket();
+}